@@ -71,6 +71,13 @@ public:
     void SetNext(AttributeAccessInterface * aNext) { mNext = aNext; }
     AttributeAccessInterface * GetNext() const { return mNext; }
 
+    /**
+     * The endpoint this AttributeAccessInterface is registered for, Missing
+     * if it is used with all endpoints, and its cluster.
+     */
+    const Optional<EndpointId> & GetEndpointId() const { return mEndpointId; }
+    ClusterId GetClusterId() const { return mClusterId; }
+
     /**
      * Check whether a this AttributeAccessInterface is relevant for a
      * particular endpoint+cluster.  An AttributeAccessInterface will be used
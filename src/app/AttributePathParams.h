@@ -27,8 +27,9 @@ struct AttributePathParams
 {
     enum class Flags : uint8_t
     {
-        kFieldIdValid   = 0x01,
-        kListIndexValid = 0x02,
+        kFieldIdValid     = 0x01,
+        kListIndexValid   = 0x02,
+        kDataVersionValid = 0x04, // mDataVersion holds the version of the cluster the client already has
     };
 
     AttributePathParams(NodeId aNodeId, EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, ListIndex aListIndex,
@@ -37,11 +38,12 @@ struct AttributePathParams
         mEndpointId(aEndpointId), mClusterId(aClusterId), mFieldId(aFieldId), mListIndex(aListIndex), mFlags(aFlags)
     {}
     AttributePathParams() {}
-    NodeId mNodeId         = 0;
-    EndpointId mEndpointId = 0;
-    ClusterId mClusterId   = 0;
-    AttributeId mFieldId   = 0;
-    ListIndex mListIndex   = 0;
+    NodeId mNodeId           = 0;
+    EndpointId mEndpointId   = 0;
+    ClusterId mClusterId     = 0;
+    AttributeId mFieldId     = 0;
+    ListIndex mListIndex     = 0;
+    DataVersion mDataVersion = 0;
     BitFlags<Flags> mFlags;
 };
 } // namespace app
@@ -31,9 +31,10 @@ struct ClusterInfo
 {
     enum class Flags : uint8_t
     {
-        kFieldIdValid   = 0x01,
-        kListIndexValid = 0x02,
-        kEventIdValid   = 0x03,
+        kFieldIdValid     = 0x01,
+        kListIndexValid   = 0x02,
+        kEventIdValid     = 0x03,
+        kDataVersionValid = 0x04, // mDataVersion holds the version of the cluster the reader already has
     };
 
     bool IsAttributePathSupersetOf(const ClusterInfo & other) const
@@ -98,8 +99,12 @@ struct ClusterInfo
     AttributeId mFieldId   = 0;
     EndpointId mEndpointId = 0;
     BitFlags<Flags> mFlags;
-    ClusterInfo * mpNext = nullptr;
-    EventId mEventId     = 0;
+    ClusterInfo * mpNext     = nullptr;
+    EventId mEventId         = 0;
+    DataVersion mDataVersion = 0;
+
+    // Only used by the paths of the reporting engine's dirty set: the dirty generation the path was last marked dirty in.
+    uint64_t mDirtyGeneration = 0;
     /* For better structure alignment
      * Above ordering is by bit-size to ensure least amount of memory alignment padding.
      * Changing order to something more natural (e.g. clusterid before nodeid) will result
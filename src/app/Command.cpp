@@ -70,6 +70,7 @@ CHIP_ERROR Command::Reset()
     MoveToState(CommandState::Initialized);
 
     mCommandIndex = 0;
+    mCommandCount = 0;
 
 exit:
     return err;
@@ -140,6 +141,7 @@ void Command::ShutdownInternal()
     ClearState();
 
     mCommandIndex = 0;
+    mCommandCount = 0;
 }
 
 CHIP_ERROR Command::PrepareCommand(const CommandPathParams & aCommandPathParams, bool aIsStatus)
@@ -147,6 +149,7 @@ CHIP_ERROR Command::PrepareCommand(const CommandPathParams & aCommandPathParams,
     CHIP_ERROR err = CHIP_NO_ERROR;
     CommandDataElement::Builder commandDataElement;
     VerifyOrExit(mState == CommandState::Initialized || mState == CommandState::AddCommand, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mCommandCount < UINT8_MAX, err = CHIP_ERROR_NO_MEMORY);
     commandDataElement = mInvokeCommandBuilder.GetCommandListBuilder().CreateCommandDataElementBuilder();
     err                = commandDataElement.GetError();
     SuccessOrExit(err);
@@ -181,6 +184,7 @@ CHIP_ERROR Command::FinishCommand(bool aIsStatus)
     commandDataElement.EndOfCommandDataElement();
     err = commandDataElement.GetError();
     SuccessOrExit(err);
+    mCommandCount++;
     MoveToState(CommandState::AddCommand);
 
 exit:
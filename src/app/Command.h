@@ -91,9 +91,25 @@ public:
      */
     CHIP_ERROR FinalizeCommandsMessage(System::PacketBufferHandle & commandPacket);
 
+    /**
+     * Start adding a command to the invoke command message. Any number of commands, for any endpoint and cluster, can be added
+     * to a message before it is sent, as long as they fit in it; the peer answers all of them in a single response.
+     */
     CHIP_ERROR PrepareCommand(const CommandPathParams & aCommandPathParams, bool aIsStatus = false);
     TLV::TLVWriter * GetCommandDataElementTLVWriter();
     CHIP_ERROR FinishCommand(bool aIsStatus = false);
+
+    /**
+     * Returns the number of commands added to the invoke command message so far.
+     */
+    uint8_t GetCommandCount() const { return mCommandCount; }
+
+    /**
+     * While a received invoke command message is being processed, returns the index of the command data element being
+     * processed in that message. For a CommandSender, this is also the index of the command it answers in the request, as
+     * commands are answered in order, each with one command data element.
+     */
+    uint8_t GetCurrentCommandIndex() const { return static_cast<uint8_t>(mCommandIndex > 0 ? mCommandIndex - 1 : 0); }
     virtual CHIP_ERROR AddStatusCode(const CommandPathParams & aCommandPathParams,
                                      const Protocols::SecureChannel::GeneralStatusCode aGeneralCode,
                                      const Protocols::Id aProtocolId, const Protocols::InteractionModel::Status aStatus)
@@ -136,6 +152,7 @@ protected:
     Messaging::ExchangeContext * mpExchangeCtx = nullptr;
     InteractionModelDelegate * mpDelegate      = nullptr;
     uint8_t mCommandIndex                      = 0;
+    uint8_t mCommandCount                      = 0;
     CommandState mState                        = CommandState::Uninitialized;
 
 private:
@@ -23,6 +23,7 @@
 #include <lib/core/CHIPTLVUtilities.hpp>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ErrorStr.h>
+#include <lib/support/IntegerHash.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip::TLV;
@@ -129,6 +130,16 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
         current->mProcessEvictedElement = AlwaysFail;
         current->mAppData               = nullptr;
         current->InitCounter(apLogStorageResources[bufferIndex].InitializeCounter());
+
+        if (apLogStorageResources[bufferIndex].mpStateStore != nullptr)
+        {
+            CHIP_ERROR err = current->RestoreState(apLogStorageResources[bufferIndex].mpStateStore);
+            if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+            {
+                ChipLogProgress(EventLogging, "No stored events restored for priority %u: %" CHIP_ERROR_FORMAT,
+                                static_cast<unsigned>(current->GetPriorityLevel()), err.Format());
+            }
+        }
     }
 
     mpEventBuffer = apCircularEventBuffer;
@@ -173,6 +184,8 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    nextBuffer->RecordMovedEvent(*apEventBuffer);
+
     ChipLogProgress(EventLogging, "Copy Event to next buffer with priority %u",
                     static_cast<unsigned>(nextBuffer->GetPriorityLevel()));
 exit:
@@ -211,7 +224,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
             // EvictEvent function
 
-            if (err != CHIP_NO_ERROR)
+            if (err == CHIP_NO_ERROR)
+            {
+                eventBuffer->RecordEvictedEvent();
+            }
+            else
             {
                 VerifyOrExit(ctx.mSpaceNeededForMovedEvent != 0, /* no-op, return err */);
                 VerifyOrExit(eventBuffer->GetNextCircularEventBuffer() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
@@ -234,6 +251,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
                     // caller know that we could not honor the
                     // request
                     SuccessOrExit(err);
+                    eventBuffer->RecordEvictedEvent();
                     continue;
                 }
                 // we cannot copy event outright. We remember the
@@ -551,17 +569,20 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, E
     }
 
     mBytesWritten += writer.GetLengthWritten();
+    mpEventBuffer->RecordEvent(opts.mpEventSchema->mEndpointId, opts.mpEventSchema->mClusterId);
 
 exit:
     if (err != CHIP_NO_ERROR)
     {
         *mpEventBuffer = checkpoint;
+        mpEventBuffer->SaveState();
     }
     else if (opts.mpEventSchema->mPriority >= CHIP_CONFIG_EVENT_GLOBAL_PRIORITY)
     {
         CircularEventBuffer * currentBuffer = GetPriorityBuffer(opts.mpEventSchema->mPriority);
         aEventNumber                        = currentBuffer->VendEventNumber();
         currentBuffer->UpdateFirstLastEventTime(opts.mTimestamp);
+        currentBuffer->SaveState();
 
 #if CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS
         ChipLogDetail(EventLogging,
@@ -572,6 +593,7 @@ exit:
                       ChipLogValueX64(opts.mTimestamp.mValue));
 #endif // CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS
 
+        InteractionModelEngine::GetInstance()->GetReportingEngine().OnEventLogged(*opts.mpEventSchema);
         ScheduleFlushIfNeeded(opts.mUrgent);
     }
 
@@ -692,10 +714,25 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
     return err;
 }
 
+bool EventManagement::MayContainInterestedEventPaths(CircularEventBuffer * apBuffer, ClusterInfo * apClusterInfolist)
+{
+    // FetchEventsSince reads the buffer of the requested priority and every buffer of lesser priority.
+    for (CircularEventBuffer * buf = apBuffer; buf != nullptr; buf = buf->GetPreviousCircularEventBuffer())
+    {
+        for (ClusterInfo * path = apClusterInfolist; path != nullptr; path = path->mpNext)
+        {
+            if (buf->MayContainPath(path->mEndpointId, path->mClusterId))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, ClusterInfo * apClusterInfolist, PriorityLevel aPriority,
                                              EventNumber & aEventNumber, size_t & aEventCount)
 {
-    // TODO: Add particular set of event Paths in FetchEventsSince so that we can filter the interested paths
     CHIP_ERROR err     = CHIP_NO_ERROR;
     const bool recurse = false;
     TLVReader reader;
@@ -712,6 +749,17 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, ClusterInfo *
         buf = buf->GetNextCircularEventBuffer();
     }
 
+    if (!MayContainInterestedEventPaths(buf, apClusterInfolist))
+    {
+        // Nothing would be copied out, only account for the events a full scan would have gone through.
+        context.mCurrentEventNumber = buf->GetFirstEventNumber();
+        for (CircularEventBuffer * scanned = buf; scanned != nullptr; scanned = scanned->GetPreviousCircularEventBuffer())
+        {
+            context.mCurrentEventNumber += scanned->GetEventCount();
+        }
+        ExitNow();
+    }
+
     context.mpInterestedEventPaths    = apClusterInfolist;
     context.mCurrentSystemTime.mValue = buf->GetFirstEventSystemTimestamp();
     context.mCurrentEventNumber       = buf->GetFirstEventNumber();
@@ -823,8 +871,13 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
 
 CHIP_ERROR EventManagement::ScheduleFlushIfNeeded(EventOptions::Type aUrgent)
 {
-    // TODO: Implement ScheduleFlushIfNeeded
-    return CHIP_NO_ERROR;
+    // Other events go out with the next report of the subscriptions interested in them, at the latest once their max interval
+    // is up. Urgent ones only wait for the min interval.
+    if (aUrgent != EventOptions::Type::kUrgent)
+    {
+        return CHIP_NO_ERROR;
+    }
+    return InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
 }
 
 void EventManagement::SetScheduledEventEndpoint(EventNumber * apEventEndpoints)
@@ -857,6 +910,9 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mFirstEventSystemTimestamp = Timestamp::System(0);
     mLastEventSystemTimestamp  = Timestamp::System(0);
     mpEventNumberCounter       = nullptr;
+    mEventCount                = 0;
+    mPathSummary               = 0;
+    mpStateStore               = nullptr;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -879,6 +935,114 @@ void CircularEventBuffer::RemoveEvent(EventNumber aNumEvents)
     mFirstEventNumber = mFirstEventNumber + aNumEvents;
 }
 
+uint64_t CircularEventBuffer::PathSummaryBit(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    return static_cast<uint64_t>(1) << (IntegerHash(aClusterId, aEndpointId) >> 26);
+}
+
+void CircularEventBuffer::RecordEvent(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    mEventCount++;
+    mPathSummary |= PathSummaryBit(aEndpointId, aClusterId);
+    SaveState();
+}
+
+void CircularEventBuffer::RecordMovedEvent(const CircularEventBuffer & aSource)
+{
+    // Which path the moved event had is not known here, the summary of its source covers it.
+    mEventCount++;
+    mPathSummary |= aSource.mPathSummary;
+    SaveState();
+}
+
+void CircularEventBuffer::RecordEvictedEvent()
+{
+    if (mEventCount > 0)
+    {
+        mEventCount--;
+    }
+    if (mEventCount == 0)
+    {
+        mPathSummary = 0;
+    }
+    SaveState();
+}
+
+CHIP_ERROR CircularEventBuffer::RestoreState(EventBufferStateStore * apStateStore)
+{
+    CircularEventBufferState state;
+    CircularTLVReader reader;
+    size_t eventCount = 0;
+    uint64_t now      = 0;
+
+    VerifyOrReturnError(apStateStore != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mpStateStore = apStateStore;
+
+    CHIP_ERROR err = mpStateStore->Load(state);
+    SuccessOrExit(err);
+
+    err = Restore(state.mHeadOffset, state.mDataLength);
+    SuccessOrExit(err);
+
+    // The stored events must still parse, and be as many as the state says.
+    reader.Init(*this);
+    err = TLV::Utilities::Count(reader, eventCount, false /* aRecurse */);
+    SuccessOrExit(err);
+    VerifyOrExit(eventCount == state.mEventCount, err = CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    mFirstEventNumber                 = state.mFirstEventNumber;
+    mLastEventNumber                  = state.mLastEventNumber;
+    mFirstEventSystemTimestamp.mValue = state.mFirstEventSystemTimestamp;
+    mLastEventSystemTimestamp.mValue  = state.mLastEventSystemTimestamp;
+    mEventCount                       = eventCount;
+    mPathSummary                      = state.mPathSummary;
+
+    now = System::Clock::GetMonotonicMilliseconds();
+    if (mLastEventSystemTimestamp.mValue > now)
+    {
+        // The events were timestamped during a previous boot. Only deltas are stored, so shift the whole history back to
+        // keep the deltas of the events logged from now on positive.
+        uint64_t shift = mLastEventSystemTimestamp.mValue - now;
+        mFirstEventSystemTimestamp.mValue =
+            (mFirstEventSystemTimestamp.mValue > shift) ? mFirstEventSystemTimestamp.mValue - shift : 1;
+        mLastEventSystemTimestamp.mValue = now;
+    }
+
+    if (mpEventNumberCounter == &mNonPersistedCounter)
+    {
+        err = mNonPersistedCounter.Init(static_cast<uint32_t>(mLastEventNumber + 1));
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        Restore(0, 0);
+        SaveState();
+    }
+    return err;
+}
+
+void CircularEventBuffer::SaveState()
+{
+    VerifyOrReturn(mpStateStore != nullptr);
+
+    CircularEventBufferState state;
+    state.mFirstEventNumber          = mFirstEventNumber;
+    state.mLastEventNumber           = mLastEventNumber;
+    state.mFirstEventSystemTimestamp = mFirstEventSystemTimestamp.mValue;
+    state.mLastEventSystemTimestamp  = mLastEventSystemTimestamp.mValue;
+    state.mPathSummary               = mPathSummary;
+    state.mHeadOffset                = static_cast<uint32_t>(QueueHead() - GetQueue());
+    state.mDataLength                = DataLength();
+    state.mEventCount                = static_cast<uint32_t>(mEventCount);
+    mpStateStore->Save(state);
+}
+
+bool CircularEventBuffer::MayContainPath(EndpointId aEndpointId, ClusterId aClusterId) const
+{
+    return (mPathSummary & PathSummaryBit(aEndpointId, aClusterId)) != 0;
+}
+
 void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 {
     CircularEventBuffer * prev;
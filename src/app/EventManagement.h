@@ -44,6 +44,44 @@ constexpr size_t kMaxEventSizeReserve  = 512;
 constexpr uint16_t kRequiredEventField = (1 << EventDataElement::kCsTag_PriorityLevel) |
     (1 << EventDataElement::kCsTag_DeltaSystemTimestamp) | (1 << EventDataElement::kCsTag_EventPath);
 
+/**
+ * @brief
+ *   The bookkeeping of a CircularEventBuffer, which is all it takes on top of the content of its backing buffer to pick up
+ *   the events it stored before a restart.
+ */
+struct CircularEventBufferState
+{
+    EventNumber mFirstEventNumber       = 0;
+    EventNumber mLastEventNumber        = 0;
+    uint64_t mFirstEventSystemTimestamp = 0;
+    uint64_t mLastEventSystemTimestamp  = 0;
+    uint64_t mPathSummary               = 0;
+    uint32_t mHeadOffset                = 0;
+    uint32_t mDataLength                = 0;
+    uint32_t mEventCount                = 0;
+};
+
+/**
+ * @brief
+ *   Persists the state of a CircularEventBuffer whose backing buffer outlives the process, e.g. a memory-mapped file.
+ *
+ *   Save is called every time the buffer changes: once the space of evicted events has been given up, before it is
+ *   written again, and once new events have been written. A store that keeps the last state saved whole, whenever the
+ *   process stops, keeps the events it describes readable.
+ */
+class EventBufferStateStore
+{
+public:
+    virtual ~EventBufferStateStore() = default;
+
+    /**
+     * @retval #CHIP_NO_ERROR                                 On success.
+     * @retval #CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND  No state was saved yet.
+     */
+    virtual CHIP_ERROR Load(CircularEventBufferState & aState) = 0;
+    virtual void Save(const CircularEventBufferState & aState) = 0;
+};
+
 /**
  * @brief
  *   Internal event buffer, built around the TLV::CHIPCircularTLVBuffer
@@ -142,6 +180,47 @@ public:
 
     uint64_t GetLastEventSystemTimestamp() { return mLastEventSystemTimestamp.mValue; }
 
+    /**
+     * @brief
+     *   Account for an event of the given path that was just written to this buffer.
+     */
+    void RecordEvent(EndpointId aEndpointId, ClusterId aClusterId);
+
+    /**
+     * @brief
+     *   Account for the head event of apSource that was just copied to this buffer.
+     */
+    void RecordMovedEvent(const CircularEventBuffer & aSource);
+
+    /**
+     * @brief
+     *   Account for the head event that was just evicted from this buffer.
+     */
+    void RecordEvictedEvent();
+
+    /**
+     * @brief
+     *   Check whether this buffer may hold events of the given path. False positives are possible, false negatives are not.
+     */
+    bool MayContainPath(EndpointId aEndpointId, ClusterId aClusterId) const;
+
+    size_t GetEventCount() const { return mEventCount; }
+
+    /**
+     * @brief
+     *   Pick up the events already stored in the backing buffer, as described by the state saved in apStateStore, then keep
+     *   saving the state there. The buffer is left empty when no valid state was saved.
+     *
+     *   Must be called once the event number counter has been initialized.
+     */
+    CHIP_ERROR RestoreState(EventBufferStateStore * apStateStore);
+
+    /**
+     * @brief
+     *   Save the current state of the buffer to its state store, if any.
+     */
+    void SaveState();
+
     virtual ~CircularEventBuffer() = default;
 
 private:
@@ -162,6 +241,17 @@ private:
     EventNumber mLastEventNumber    = 0;  ///< Last event Number vended for this priority
     Timestamp mFirstEventSystemTimestamp; ///< The timestamp of the first event in this buffer
     Timestamp mLastEventSystemTimestamp;  ///< The timestamp of the last event in this buffer
+
+    // The number of events stored in this buffer, whatever their priority.
+    size_t mEventCount = 0;
+
+    // One bit per hash of the (endpoint, cluster) of the events stored since the buffer was last empty, so that fetches can
+    // tell that none of their paths can be found here without decoding a single event.
+    uint64_t mPathSummary = 0;
+
+    EventBufferStateStore * mpStateStore = nullptr;
+
+    static uint64_t PathSummaryBit(EndpointId aEndpointId, ClusterId aClusterId);
 };
 
 class CircularEventReader;
@@ -215,6 +305,8 @@ struct LogStorageResources
     PersistedCounter * mpCounterStorage = nullptr; // application provided storage for persistent counter for this priority level.
     PriorityLevel mPriority =
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
+    EventBufferStateStore * mpStateStore =
+        nullptr; // When not NULL, mpBuffer outlives the process and the events it holds are picked up from the state saved here.
     PersistedCounter * InitializeCounter() const
     {
         if (mpCounterStorage != nullptr && mCounterKey != nullptr && mCounterEpoch != 0)
@@ -518,6 +610,15 @@ private:
      */
     static CHIP_ERROR CopyEventsSince(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+    /**
+     * @brief
+     *   Internal API used to implement #FetchEventsSince
+     *
+     * Check the path summaries of apBuffer and of every buffer of lesser priority against the interested paths. When this
+     * returns false, a scan of these buffers would not copy out any event.
+     */
+    static bool MayContainInterestedEventPaths(CircularEventBuffer * apBuffer, ClusterInfo * apClusterInfolist);
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      *
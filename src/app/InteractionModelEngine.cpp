@@ -49,12 +49,14 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
 
     mReportingEngine.Init();
 
+#if !CHIP_IM_SERVER_POOLS_USE_HEAP
     for (uint32_t index = 0; index < CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS - 1; index++)
     {
         mClusterInfoPool[index].mpNext = &mClusterInfoPool[index + 1];
     }
     mClusterInfoPool[CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS - 1].mpNext = nullptr;
     mpNextAvailableClusterInfo                                      = mClusterInfoPool;
+#endif // !CHIP_IM_SERVER_POOLS_USE_HEAP
 
     return CHIP_NO_ERROR;
 }
@@ -69,13 +71,11 @@ void InteractionModelEngine::Shutdown()
         }
     }
 
-    for (auto & commandHandler : mCommandHandlerObjs)
-    {
-        if (!commandHandler.IsFree())
-        {
-            commandHandler.Shutdown();
-        }
-    }
+    mCommandHandlerObjs.ForEachActiveObject([this](CommandHandler * commandHandler) {
+        commandHandler->Shutdown();
+        mCommandHandlerObjs.ReleaseObject(commandHandler);
+        return true;
+    });
 
     for (auto & readClient : mReadClients)
     {
@@ -85,13 +85,11 @@ void InteractionModelEngine::Shutdown()
         }
     }
 
-    for (auto & readHandler : mReadHandlers)
-    {
-        if (!readHandler.IsFree())
-        {
-            readHandler.Shutdown();
-        }
-    }
+    // Read handlers go back to the pool as they shut down.
+    mReadHandlers.ForEachActiveObject([](ReadHandler * readHandler) {
+        readHandler->Shutdown();
+        return true;
+    });
 
     for (auto & writeClient : mWriteClients)
     {
@@ -101,17 +99,27 @@ void InteractionModelEngine::Shutdown()
         }
     }
 
-    for (auto & writeHandler : mWriteHandlers)
-    {
-        VerifyOrDie(writeHandler.IsFree());
-    }
+    VerifyOrDie(mWriteHandlers.Allocated() == 0);
 
     mReportingEngine.Shutdown();
 
+#if CHIP_IM_SERVER_POOLS_USE_HEAP
+    // The engine outlives the memory allocator, give the heap back while it is still there.
+    mCommandHandlerObjs.ReleaseEmptyChunks();
+    mReadHandlers.ReleaseEmptyChunks();
+    mWriteHandlers.ReleaseEmptyChunks();
+    while (mpClusterInfoChunks != nullptr)
+    {
+        ClusterInfoChunk * next = mpClusterInfoChunks->mpNext;
+        Platform::Delete(mpClusterInfoChunks);
+        mpClusterInfoChunks = next;
+    }
+#else
     for (uint32_t index = 0; index < CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS; index++)
     {
         mClusterInfoPool[index].mpNext = nullptr;
     }
+#endif // CHIP_IM_SERVER_POOLS_USE_HEAP
 
     mpNextAvailableClusterInfo = nullptr;
 
@@ -204,21 +212,18 @@ CHIP_ERROR InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeCon
                                                           const PayloadHeader & aPayloadHeader,
                                                           System::PacketBufferHandle && aPayload)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
+    CHIP_ERROR err                  = CHIP_NO_ERROR;
+    CommandHandler * commandHandler = mCommandHandlerObjs.CreateObject();
 
-    for (auto & commandHandler : mCommandHandlerObjs)
-    {
-        if (commandHandler.IsFree())
-        {
-            err = commandHandler.Init(mpExchangeMgr, mpDelegate);
-            SuccessOrExit(err);
-            err               = commandHandler.OnInvokeCommandRequest(apExchangeContext, aPayloadHeader, std::move(aPayload));
-            apExchangeContext = nullptr;
-            break;
-        }
-    }
+    VerifyOrExit(commandHandler != nullptr, ChipLogProgress(InteractionModel, "no resource for Invoke interaction"));
+    err = commandHandler->Init(mpExchangeMgr, mpDelegate);
+    SuccessOrExit(err);
+    err               = commandHandler->OnInvokeCommandRequest(apExchangeContext, aPayloadHeader, std::move(aPayload));
+    apExchangeContext = nullptr;
 
 exit:
+    // The command handler is done with the request once it has been processed, whether or not the response could be sent.
+    mCommandHandlerObjs.ReleaseObject(commandHandler);
 
     if (nullptr != apExchangeContext)
     {
@@ -237,17 +242,14 @@ CHIP_ERROR InteractionModelEngine::OnReadInitialRequest(Messaging::ExchangeConte
     ChipLogDetail(InteractionModel, "Receive %s request",
                   aInteractionType == ReadHandler::InteractionType::Subscribe ? "Subscribe" : "Read");
 
-    for (auto & readHandler : mReadHandlers)
-    {
-        if (readHandler.IsFree())
-        {
-            err = readHandler.Init(mpExchangeMgr, mpDelegate, apExchangeContext, aInteractionType);
-            SuccessOrExit(err);
-            err               = readHandler.OnReadInitialRequest(std::move(aPayload));
-            apExchangeContext = nullptr;
-            break;
-        }
-    }
+    ReadHandler * readHandler = mReadHandlers.CreateObject();
+    VerifyOrExit(readHandler != nullptr, ChipLogProgress(InteractionModel, "no resource for Read interaction"));
+    err = readHandler->Init(mpExchangeMgr, mpDelegate, apExchangeContext, aInteractionType);
+    VerifyOrExit(err == CHIP_NO_ERROR, mReadHandlers.ReleaseObject(readHandler));
+
+    // From now on, the read handler goes back to the pool when it shuts down.
+    err               = readHandler->OnReadInitialRequest(std::move(aPayload));
+    apExchangeContext = nullptr;
 
 exit:
 
@@ -265,19 +267,16 @@ CHIP_ERROR InteractionModelEngine::OnWriteRequest(Messaging::ExchangeContext * a
 
     ChipLogDetail(InteractionModel, "Receive Write request");
 
-    for (auto & writeHandler : mWriteHandlers)
-    {
-        if (writeHandler.IsFree())
-        {
-            err = writeHandler.Init(mpDelegate);
-            SuccessOrExit(err);
-            err               = writeHandler.OnWriteRequest(apExchangeContext, std::move(aPayload));
-            apExchangeContext = nullptr;
-            break;
-        }
-    }
+    WriteHandler * writeHandler = mWriteHandlers.CreateObject();
+    VerifyOrExit(writeHandler != nullptr, ChipLogProgress(InteractionModel, "no resource for Write interaction"));
+    err = writeHandler->Init(mpDelegate);
+    SuccessOrExit(err);
+    err               = writeHandler->OnWriteRequest(apExchangeContext, std::move(aPayload));
+    apExchangeContext = nullptr;
 
 exit:
+    // The write handler shuts down once the request has been processed.
+    mWriteHandlers.ReleaseObject(writeHandler);
 
     if (nullptr != apExchangeContext)
     {
@@ -404,6 +403,12 @@ void InteractionModelEngine::ReleaseClusterInfoList(ClusterInfo *& aClusterInfo)
 CHIP_ERROR InteractionModelEngine::PushFront(ClusterInfo *& aClusterInfoList, ClusterInfo & aClusterInfo)
 {
     ClusterInfo * last = aClusterInfoList;
+#if CHIP_IM_SERVER_POOLS_USE_HEAP
+    if (mpNextAvailableClusterInfo == nullptr)
+    {
+        ReturnErrorOnFailure(GrowClusterInfoPool());
+    }
+#endif // CHIP_IM_SERVER_POOLS_USE_HEAP
     if (mpNextAvailableClusterInfo == nullptr)
     {
         ChipLogProgress(InteractionModel, "There is no available cluster info in mClusterInfoPool");
@@ -416,6 +421,30 @@ CHIP_ERROR InteractionModelEngine::PushFront(ClusterInfo *& aClusterInfoList, Cl
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_IM_SERVER_POOLS_USE_HEAP
+CHIP_ERROR InteractionModelEngine::GrowClusterInfoPool()
+{
+    ClusterInfoChunk * chunk = Platform::New<ClusterInfoChunk>();
+    VerifyOrReturnError(chunk != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    for (auto & clusterInfo : chunk->mClusterInfos)
+    {
+        clusterInfo.mpNext         = mpNextAvailableClusterInfo;
+        mpNextAvailableClusterInfo = &clusterInfo;
+    }
+    chunk->mpNext       = mpClusterInfoChunks;
+    mpClusterInfoChunks = chunk;
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_IM_SERVER_POOLS_USE_HEAP
+
+void InteractionModelEngine::ReleaseReadHandler(ReadHandler & aReadHandler)
+{
+    // Unit tests drive read handlers of their own.
+    VerifyOrReturn(mReadHandlers.Contains(&aReadHandler));
+    mReadHandlers.ReleaseObject(&aReadHandler);
+}
+
 bool InteractionModelEngine::MergeOverlappedAttributePath(ClusterInfo * apAttributePathList, ClusterInfo & aAttributePath)
 {
     ClusterInfo * runner = apAttributePathList;
@@ -440,26 +469,5 @@ bool InteractionModelEngine::MergeOverlappedAttributePath(ClusterInfo * apAttrib
     return false;
 }
 
-bool InteractionModelEngine::IsOverlappedAttributePath(ClusterInfo & aAttributePath)
-{
-    for (auto & handler : mReadHandlers)
-    {
-        if (handler.IsSubscriptionType() && (handler.IsGeneratingReports() || handler.IsAwaitingReportResponse()))
-        {
-            for (auto clusterInfo = handler.GetAttributeClusterInfolist(); clusterInfo != nullptr;
-                 clusterInfo      = clusterInfo->mpNext)
-            {
-                if (clusterInfo->IsAttributePathSupersetOf(aAttributePath) ||
-                    aAttributePath.IsAttributePathSupersetOf(*clusterInfo))
-                {
-                    return true;
-                }
-            }
-        }
-    }
-    ChipLogDetail(DataManagement, "AttributePath is not interested");
-    return false;
-}
-
 } // namespace app
 } // namespace chip
@@ -29,6 +29,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Pool.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -152,10 +153,16 @@ public:
     // Merges aAttributePath inside apAttributePathList if current path is overlapped with existing path in apAttributePathList
     // Overlap means the path is superset or subset of another path
     bool MergeOverlappedAttributePath(ClusterInfo * apAttributePathList, ClusterInfo & aAttributePath);
-    bool IsOverlappedAttributePath(ClusterInfo & aAttributePath);
+
+    /**
+     *  Returns aReadHandler to the pool of read handlers once it has shut down. Read handlers that were not allocated by the
+     *  engine are left alone.
+     */
+    void ReleaseReadHandler(ReadHandler & aReadHandler);
 
 private:
     friend class reporting::Engine;
+    friend class TestReadInteraction;
     CHIP_ERROR OnUnknownMsgType(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                 System::PacketBufferHandle && aPayload);
     CHIP_ERROR OnInvokeCommandRequest(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
@@ -194,19 +201,35 @@ private:
     CHIP_ERROR NewReadClient(ReadClient ** const apReadClient, ReadClient::InteractionType aInteractionType,
                              uint64_t aAppIdentifier);
 
+#if CHIP_IM_SERVER_POOLS_USE_HEAP
+    /**
+     *  Adds a chunk of CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS path objects to the free list.
+     */
+    CHIP_ERROR GrowClusterInfoPool();
+
+    struct ClusterInfoChunk
+    {
+        ClusterInfo mClusterInfos[CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS];
+        ClusterInfoChunk * mpNext = nullptr;
+    };
+#endif // CHIP_IM_SERVER_POOLS_USE_HEAP
+
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     InteractionModelDelegate * mpDelegate      = nullptr;
 
     // TODO(#8006): investgate if we can disable some IM functions on some compact accessories.
-    // TODO(#8006): investgate if we can provide more flexible object management on devices with more resources.
-    CommandHandler mCommandHandlerObjs[CHIP_IM_MAX_NUM_COMMAND_HANDLER];
+    BitMapOrHeapObjectPool<CommandHandler, CHIP_IM_MAX_NUM_COMMAND_HANDLER, CHIP_IM_SERVER_POOLS_USE_HEAP> mCommandHandlerObjs;
     CommandSender mCommandSenderObjs[CHIP_IM_MAX_NUM_COMMAND_SENDER];
     ReadClient mReadClients[CHIP_IM_MAX_NUM_READ_CLIENT];
-    ReadHandler mReadHandlers[CHIP_IM_MAX_NUM_READ_HANDLER];
+    BitMapOrHeapObjectPool<ReadHandler, CHIP_IM_MAX_NUM_READ_HANDLER, CHIP_IM_SERVER_POOLS_USE_HEAP> mReadHandlers;
     WriteClient mWriteClients[CHIP_IM_MAX_NUM_WRITE_CLIENT];
-    WriteHandler mWriteHandlers[CHIP_IM_MAX_NUM_WRITE_HANDLER];
+    BitMapOrHeapObjectPool<WriteHandler, CHIP_IM_MAX_NUM_WRITE_HANDLER, CHIP_IM_SERVER_POOLS_USE_HEAP> mWriteHandlers;
     reporting::Engine mReportingEngine;
+#if CHIP_IM_SERVER_POOLS_USE_HEAP
+    ClusterInfoChunk * mpClusterInfoChunks = nullptr;
+#else
     ClusterInfo mClusterInfoPool[CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS];
+#endif // CHIP_IM_SERVER_POOLS_USE_HEAP
     ClusterInfo * mpNextAvailableClusterInfo = nullptr;
 };
 
@@ -247,5 +270,14 @@ bool ServerClusterCommandExists(chip::ClusterId aClusterId, chip::CommandId aCom
  */
 CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * apWriter, bool * apDataExists);
 CHIP_ERROR WriteSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVReader & aReader, WriteHandler * apWriteHandler);
+
+/**
+ *  Check whether the data of the given cluster is still at the given data version, in which case a reader that already has that
+ * version does not need the cluster to be reported again.
+ *  This function is implemented by CHIP as a part of cluster data storage & management.
+ *
+ *  @retval  True if the cluster exists on the endpoint and its current data version is aRequiredVersion, false otherwise.
+ */
+bool IsClusterDataVersionEqual(EndpointId aEndpointId, ClusterId aClusterId, DataVersion aRequiredVersion);
 } // namespace app
 } // namespace chip
@@ -0,0 +1,169 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements an event log buffer backed by a memory-mapped file.
+ *
+ */
+
+#include <app/MappedEventLogStorage.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <atomic>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR MappedEventLogStorage::Open(const char * apPath, uint32_t aBufferSize)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct stat fileStat;
+    void * mapping = MAP_FAILED;
+
+    VerifyOrReturnError(mFd < 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(apPath != nullptr && aBufferSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mMappingSize = kHeaderSize + aBufferSize;
+
+    mFd = open(apPath, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrExit(mFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    VerifyOrExit(fstat(mFd, &fileStat) == 0, err = CHIP_ERROR_POSIX(errno));
+    if (static_cast<size_t>(fileStat.st_size) != mMappingSize)
+    {
+        VerifyOrExit(ftruncate(mFd, static_cast<off_t>(mMappingSize)) == 0, err = CHIP_ERROR_POSIX(errno));
+    }
+
+    mapping = mmap(nullptr, mMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+    VerifyOrExit(mapping != MAP_FAILED, err = CHIP_ERROR_POSIX(errno));
+
+    mpMapping   = static_cast<uint8_t *>(mapping);
+    mpHeader    = reinterpret_cast<Header *>(mpMapping);
+    mpBuffer    = mpMapping + kHeaderSize;
+    mBufferSize = aBufferSize;
+
+    if (mpHeader->mMagic != kMagic || mpHeader->mVersion != kVersion || mpHeader->mBufferSize != aBufferSize)
+    {
+        ChipLogProgress(EventLogging, "Starting event log %s over", apPath);
+        *mpHeader = Header();
+        mpHeader->mVersion    = kVersion;
+        mpHeader->mBufferSize = aBufferSize;
+        // Only mark the file as ours once the rest of the header is.
+        std::atomic_thread_fence(std::memory_order_release);
+        mpHeader->mMagic = kMagic;
+    }
+
+    mLastSequence = 0;
+    for (uint8_t i = 0; i < ArraySize(mpHeader->mSlots); i++)
+    {
+        const StateSlot & slot = mpHeader->mSlots[i];
+        // Sequence numbers wrap around, compare them by distance.
+        if (IsComplete(slot) && (mLastSequence == 0 || static_cast<int32_t>(slot.mSequence - mLastSequence) > 0))
+        {
+            mLastSequence = slot.mSequence;
+            mLastSlot     = i;
+        }
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Failed to map event log %s: %" CHIP_ERROR_FORMAT, apPath, err.Format());
+        Close();
+    }
+    return err;
+}
+
+void MappedEventLogStorage::Close()
+{
+    if (mpMapping != nullptr)
+    {
+        munmap(mpMapping, mMappingSize);
+    }
+    if (mFd >= 0)
+    {
+        close(mFd);
+    }
+
+    mFd           = -1;
+    mpMapping     = nullptr;
+    mMappingSize  = 0;
+    mpHeader      = nullptr;
+    mpBuffer      = nullptr;
+    mBufferSize   = 0;
+    mLastSequence = 0;
+    mLastSlot     = 0;
+}
+
+CHIP_ERROR MappedEventLogStorage::Sync()
+{
+    VerifyOrReturnError(mpMapping != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(msync(mpMapping, mMappingSize, MS_SYNC) == 0, CHIP_ERROR_POSIX(errno));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MappedEventLogStorage::Load(CircularEventBufferState & aState)
+{
+    VerifyOrReturnError(mpHeader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mLastSequence != 0, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    aState = mpHeader->mSlots[mLastSlot].mState;
+    return CHIP_NO_ERROR;
+}
+
+void MappedEventLogStorage::Save(const CircularEventBufferState & aState)
+{
+    VerifyOrReturn(mpHeader != nullptr);
+
+    // Overwrite the other slot, so that the latest complete one stays untouched until this one is complete.
+    uint8_t slotIndex = (mLastSequence == 0) ? 0 : static_cast<uint8_t>(1 - mLastSlot);
+    uint32_t sequence = mLastSequence + 1;
+    if (sequence == 0)
+    {
+        sequence = 1;
+    }
+    StateSlot & slot = mpHeader->mSlots[slotIndex];
+
+    slot.mSequence = 0;
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.mState = aState;
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.mSequenceCheck = sequence;
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.mSequence = sequence;
+
+    mLastSequence = sequence;
+    mLastSlot     = slotIndex;
+}
+
+bool MappedEventLogStorage::IsComplete(const StateSlot & aSlot)
+{
+    return aSlot.mSequence != 0 && aSlot.mSequence == aSlot.mSequenceCheck;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines an event log buffer backed by a memory-mapped file, so that the events it holds survive a restart.
+ *
+ */
+
+#pragma once
+
+#include <app/EventManagement.h>
+#include <lib/core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/*
+ *  @class MappedEventLogStorage
+ *
+ *  @brief Maps a file holding the backing buffer of one CircularEventBuffer, followed by the state of that buffer.
+ *
+ *         Pass GetBuffer(), GetBufferSize() and the storage itself as mpBuffer, mBufferSize and mpStateStore of the
+ *         LogStorageResources of a priority level. Events are then read and written in place in the file, and
+ *         EventManagement::Init picks up the events the file already holds.
+ *
+ *         The state is saved in two alternating slots, each tagged with a sequence number written before and after it.
+ *         The latest complete slot is the one loaded, so that the process may stop at any time. The mapping is shared, so
+ *         the kernel writes it back on its own; call Sync() to have it on disk at a given point, e.g. before a planned
+ *         power off.
+ */
+class MappedEventLogStorage : public EventBufferStateStore
+{
+public:
+    MappedEventLogStorage() = default;
+    ~MappedEventLogStorage() override { Close(); }
+
+    MappedEventLogStorage(const MappedEventLogStorage &) = delete;
+    MappedEventLogStorage & operator=(const MappedEventLogStorage &) = delete;
+
+    /**
+     * Maps apPath, creating it when needed. A file created with another buffer size, or not created by this class, is
+     * started over.
+     */
+    CHIP_ERROR Open(const char * apPath, uint32_t aBufferSize);
+    void Close();
+
+    /**
+     * Writes the buffer and its state back to the file and waits for it to be done.
+     */
+    CHIP_ERROR Sync();
+
+    uint8_t * GetBuffer() const { return mpBuffer; }
+    uint32_t GetBufferSize() const { return mBufferSize; }
+
+    // EventBufferStateStore implementation
+    CHIP_ERROR Load(CircularEventBufferState & aState) override;
+    void Save(const CircularEventBufferState & aState) override;
+
+private:
+    struct StateSlot
+    {
+        uint32_t mSequence;
+        uint32_t mReserved;
+        CircularEventBufferState mState;
+        uint32_t mSequenceCheck;
+        uint32_t mReserved2;
+    };
+
+    struct Header
+    {
+        uint32_t mMagic;
+        uint32_t mVersion;
+        uint32_t mBufferSize;
+        uint32_t mReserved;
+        StateSlot mSlots[2];
+    };
+
+    static constexpr uint32_t kMagic   = 0x4C564543; // "CEVL"
+    static constexpr uint32_t kVersion = 1;
+
+    // Keeps the buffer page aligned.
+    static constexpr size_t kHeaderSize = 4096;
+
+    static_assert(sizeof(Header) <= kHeaderSize, "The header must fit before the buffer");
+
+    static bool IsComplete(const StateSlot & aSlot);
+
+    int mFd                = -1;
+    uint8_t * mpMapping    = nullptr;
+    size_t mMappingSize    = 0;
+    Header * mpHeader      = nullptr;
+    uint8_t * mpBuffer     = nullptr;
+    uint32_t mBufferSize   = 0;
+    uint32_t mLastSequence = 0;
+    uint8_t mLastSlot      = 0;
+};
+
+} // namespace app
+} // namespace chip
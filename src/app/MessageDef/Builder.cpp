@@ -42,7 +42,7 @@ void Builder::Init(chip::TLV::TLVWriter * const apWriter, chip::TLV::TLVType aOu
 
 void Builder::ResetError()
 {
-    ResetError(CHIP_NO_ERROR);
+    mError = CHIP_NO_ERROR;
 }
 
 void Builder::ResetError(CHIP_ERROR aErr)
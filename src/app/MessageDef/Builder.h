@@ -44,7 +44,9 @@ public:
     void Init(chip::TLV::TLVWriter * const apWriter, chip::TLV::TLVType aOuterContainerType);
 
     /**
-     *  @brief Reset the Error
+     *  @brief Reset the Error, keeping the container this builder has open.
+     *
+     *  Used to keep writing into the container after rolling back an element that failed to encode.
      *
      */
     void ResetError();
@@ -45,6 +45,7 @@ CHIP_ERROR ReadClient::Init(Messaging::ExchangeManager * apExchangeMgr, Interact
     mMaxIntervalCeilingSeconds = 0;
     mSubscriptionId            = 0;
     mInitialReport             = true;
+    mPendingMoreChunks         = false;
     mInteractionType           = aInteractionType;
     AbortExistingExchangeContext();
 
@@ -83,6 +84,7 @@ void ReadClient::ShutdownInternal(CHIP_ERROR aError)
     mpExchangeMgr              = nullptr;
     mpExchangeCtx              = nullptr;
     mInitialReport             = true;
+    mPendingMoreChunks         = false;
     MoveToState(ClientState::Uninitialized);
 }
 
@@ -160,6 +162,15 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
             err = GenerateAttributePathList(attributePathListBuilder, aReadPrepareParams.mpAttributePathParamsList,
                                             aReadPrepareParams.mAttributePathParamsListSize);
             SuccessOrExit(err);
+
+            if (HasDataVersion(aReadPrepareParams.mpAttributePathParamsList, aReadPrepareParams.mAttributePathParamsListSize))
+            {
+                AttributeDataVersionList::Builder & dataVersionListBuilder = request.CreateAttributeDataVersionListBuilder();
+                SuccessOrExit(err = dataVersionListBuilder.GetError());
+                err = GenerateAttributeDataVersionList(dataVersionListBuilder, aReadPrepareParams.mpAttributePathParamsList,
+                                                       aReadPrepareParams.mAttributePathParamsListSize);
+                SuccessOrExit(err);
+            }
         }
 
         request.EndOfReadRequest();
@@ -212,19 +223,20 @@ CHIP_ERROR ReadClient::SendStatusResponse(CHIP_ERROR aError)
 
     if (IsSubscriptionType())
     {
-        if (IsAwaitingInitialReport())
+        if (IsAwaitingInitialReport() && !mPendingMoreChunks)
         {
             MoveToState(ClientState::AwaitingSubscribeResponse);
         }
-        else
+        else if (!IsAwaitingInitialReport())
         {
             RefreshLivenessCheckTimer();
         }
     }
-    ReturnLogErrorOnFailure(
-        mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::StatusResponse, std::move(msgBuf),
-                                   Messaging::SendFlags(IsAwaitingSubscribeResponse() ? Messaging::SendMessageFlags::kExpectResponse
-                                                                                      : Messaging::SendMessageFlags::kNone)));
+    // The next chunk of a report, like the subscribe response, comes back on this exchange.
+    bool expectResponse = IsAwaitingSubscribeResponse() || mPendingMoreChunks;
+    ReturnLogErrorOnFailure(mpExchangeCtx->SendMessage(
+        Protocols::InteractionModel::MsgType::StatusResponse, std::move(msgBuf),
+        Messaging::SendFlags(expectResponse ? Messaging::SendMessageFlags::kExpectResponse : Messaging::SendMessageFlags::kNone)));
     return CHIP_NO_ERROR;
 }
 
@@ -281,6 +293,38 @@ CHIP_ERROR ReadClient::GenerateAttributePathList(AttributePathList::Builder & aA
     return aAttributePathListBuilder.GetError();
 }
 
+bool ReadClient::HasDataVersion(const AttributePathParams * apAttributePathParamsList, size_t aAttributePathParamsListSize)
+{
+    for (size_t index = 0; index < aAttributePathParamsListSize; index++)
+    {
+        if (apAttributePathParamsList[index].mFlags.Has(AttributePathParams::Flags::kDataVersionValid))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR ReadClient::GenerateAttributeDataVersionList(AttributeDataVersionList::Builder & aAttributeDataVersionListBuilder,
+                                                        const AttributePathParams * apAttributePathParamsList,
+                                                        size_t aAttributePathParamsListSize)
+{
+    // The versions are matched with the attribute paths by position, the paths without a known version get a null.
+    for (size_t index = 0; index < aAttributePathParamsListSize; index++)
+    {
+        if (apAttributePathParamsList[index].mFlags.Has(AttributePathParams::Flags::kDataVersionValid))
+        {
+            aAttributeDataVersionListBuilder.AddVersion(apAttributePathParamsList[index].mDataVersion);
+        }
+        else
+        {
+            aAttributeDataVersionListBuilder.AddNull();
+        }
+    }
+    aAttributeDataVersionListBuilder.EndOfAttributeDataVersionList();
+    return aAttributeDataVersionListBuilder.GetError();
+}
+
 CHIP_ERROR ReadClient::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                          System::PacketBufferHandle && aPayload)
 {
@@ -304,7 +348,7 @@ CHIP_ERROR ReadClient::OnMessageReceived(Messaging::ExchangeContext * apExchange
     }
 
 exit:
-    if (!IsSubscriptionType() || err != CHIP_NO_ERROR)
+    if ((!IsSubscriptionType() && !mPendingMoreChunks) || err != CHIP_NO_ERROR)
     {
         ShutdownInternal(err);
     }
@@ -397,6 +441,7 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload)
         err = CHIP_NO_ERROR;
     }
     SuccessOrExit(err);
+    mPendingMoreChunks = moreChunkedMessages;
 
     err                = report.GetEventDataList(&eventList);
     isEventListPresent = (err == CHIP_NO_ERROR);
@@ -421,7 +466,7 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload)
         err = CHIP_NO_ERROR;
     }
     SuccessOrExit(err);
-    if (isAttributeDataListPresent && nullptr != mpDelegate && !moreChunkedMessages)
+    if (isAttributeDataListPresent && nullptr != mpDelegate)
     {
         chip::TLV::TLVReader attributeDataListReader;
         attributeDataList.GetReader(&attributeDataListReader);
@@ -435,17 +480,25 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload)
         // are multiple reports
     }
 
-    if (err == CHIP_NO_ERROR)
+    // A chunked report is complete once its last chunk has been processed.
+    if (err == CHIP_NO_ERROR && !moreChunkedMessages)
     {
         mpDelegate->ReportProcessed(this);
     }
 exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        mPendingMoreChunks = false;
+    }
     SendStatusResponse(err);
-    if (!mInitialReport)
+    if (!mPendingMoreChunks)
     {
-        mpExchangeCtx = nullptr;
+        if (!mInitialReport)
+        {
+            mpExchangeCtx = nullptr;
+        }
+        mInitialReport = false;
     }
-    mInitialReport = false;
     return err;
 }
 
@@ -630,6 +683,15 @@ CHIP_ERROR ReadClient::SendSubscribeRequest(ReadPrepareParams & aReadPreparePara
         err = GenerateAttributePathList(attributePathListBuilder, aReadPrepareParams.mpAttributePathParamsList,
                                         aReadPrepareParams.mAttributePathParamsListSize);
         SuccessOrExit(err);
+
+        if (HasDataVersion(aReadPrepareParams.mpAttributePathParamsList, aReadPrepareParams.mAttributePathParamsListSize))
+        {
+            AttributeDataVersionList::Builder & dataVersionListBuilder = request.CreateAttributeDataVersionListBuilder();
+            SuccessOrExit(err = dataVersionListBuilder.GetError());
+            err = GenerateAttributeDataVersionList(dataVersionListBuilder, aReadPrepareParams.mpAttributePathParamsList,
+                                                   aReadPrepareParams.mAttributePathParamsListSize);
+            SuccessOrExit(err);
+        }
     }
 
     request.MinIntervalSeconds(aReadPrepareParams.mMinIntervalFloorSeconds)
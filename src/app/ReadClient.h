@@ -150,6 +150,10 @@ private:
                                      size_t aEventPathParamsListSize);
     CHIP_ERROR GenerateAttributePathList(AttributePathList::Builder & aAttributeathListBuilder,
                                          AttributePathParams * apAttributePathParamsList, size_t aAttributePathParamsListSize);
+    static bool HasDataVersion(const AttributePathParams * apAttributePathParamsList, size_t aAttributePathParamsListSize);
+    CHIP_ERROR GenerateAttributeDataVersionList(AttributeDataVersionList::Builder & aAttributeDataVersionListBuilder,
+                                                const AttributePathParams * apAttributePathParamsList,
+                                                size_t aAttributePathParamsListSize);
     CHIP_ERROR ProcessAttributeDataList(TLV::TLVReader & aAttributeDataListReader);
 
     void ClearExchangeContext() { mpExchangeCtx = nullptr; }
@@ -178,6 +182,8 @@ private:
     uint16_t mMaxIntervalCeilingSeconds        = 0;
     uint64_t mSubscriptionId                   = 0;
     InteractionType mInteractionType           = InteractionType::Read;
+    // The last ReportData received announced more chunks of the same report.
+    bool mPendingMoreChunks = false;
 };
 
 }; // namespace app
@@ -32,6 +32,8 @@
 #include <app/reporting/Engine.h>
 #include <lib/support/RandUtils.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace app {
 CHIP_ERROR ReadHandler::Init(Messaging::ExchangeManager * apExchangeMgr, InteractionModelDelegate * apDelegate,
@@ -49,11 +51,18 @@ CHIP_ERROR ReadHandler::Init(Messaging::ExchangeManager * apExchangeMgr, Interac
     mCurrentPriority           = PriorityLevel::Invalid;
     mInitialReport             = true;
     MoveToState(HandlerState::Initialized);
-    mpDelegate       = apDelegate;
-    mSubscriptionId  = 0;
-    mHoldReport      = false;
-    mDirty           = false;
-    mInteractionType = aInteractionType;
+    mpDelegate                  = apDelegate;
+    mSubscriptionId             = 0;
+    mHoldReport                 = false;
+    mDirty                      = false;
+    mMoreChunkedMessages        = false;
+    mDirtyDuringChunkedReport   = false;
+    mEventsLogged               = false;
+    mpAttributeResumePath       = nullptr;
+    mpDirtyResumePath           = nullptr;
+    mReportedDirtyGeneration    = 0;
+    mReportStartDirtyGeneration = 0;
+    mInteractionType            = aInteractionType;
     if (apExchangeContext != nullptr)
     {
         apExchangeContext->SetDelegate(this);
@@ -68,6 +77,8 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
     {
         InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
             OnRefreshSubscribeTimerSyncCallback, this);
+        InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
+            OnMaxIntervalTimerCallback, this);
     }
     if (aOptions == ShutdownOptions::AbortCurrentExchange)
     {
@@ -77,11 +88,20 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
             mpExchangeCtx = nullptr;
         }
     }
+    else if (mpExchangeCtx != nullptr)
+    {
+        // The exchange closes once the message being handled is done with, possibly after this handler went back to the pool.
+        mpExchangeCtx->SetDelegate(nullptr);
+    }
 
     if (IsAwaitingReportResponse())
     {
         InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
     }
+    if (IsSubscriptionType())
+    {
+        InteractionModelEngine::GetInstance()->GetReportingEngine().UnregisterInterest(*this);
+    }
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpAttributeClusterInfoList);
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpEventClusterInfoList);
     mSubscriptionId            = 0;
@@ -90,13 +110,24 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
     mInteractionType           = InteractionType::Read;
     mpExchangeCtx              = nullptr;
     MoveToState(HandlerState::Uninitialized);
-    mpAttributeClusterInfoList = nullptr;
-    mpEventClusterInfoList     = nullptr;
-    mCurrentPriority           = PriorityLevel::Invalid;
-    mInitialReport             = false;
-    mpDelegate                 = nullptr;
-    mHoldReport                = false;
-    mDirty                     = false;
+    mpAttributeClusterInfoList  = nullptr;
+    mpEventClusterInfoList      = nullptr;
+    mCurrentPriority            = PriorityLevel::Invalid;
+    mInitialReport              = false;
+    mpDelegate                  = nullptr;
+    mHoldReport                 = false;
+    mMaxIntervalElapsed         = false;
+    mDirty                      = false;
+    mMoreChunkedMessages        = false;
+    mDirtyDuringChunkedReport   = false;
+    mEventsLogged               = false;
+    mpAttributeResumePath       = nullptr;
+    mpDirtyResumePath           = nullptr;
+    mReportedDirtyGeneration    = 0;
+    mReportStartDirtyGeneration = 0;
+
+    // Must come last, this handler may not be used past it.
+    InteractionModelEngine::GetInstance()->ReleaseReadHandler(*this);
 }
 
 CHIP_ERROR ReadHandler::OnReadInitialRequest(System::PacketBufferHandle && aPayload)
@@ -145,7 +176,16 @@ CHIP_ERROR ReadHandler::OnStatusResponse(Messaging::ExchangeContext * apExchange
     switch (mState)
     {
     case HandlerState::AwaitingReportResponse:
-        if (IsSubscriptionType())
+        if (IsChunkedReport())
+        {
+            // The next chunk goes out on this same exchange as soon as the reporting engine gets to it.
+            InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
+            MoveToState(HandlerState::GeneratingReports);
+            err = InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+            SuccessOrExit(err);
+            mpExchangeCtx->WillSendMessage();
+        }
+        else if (IsSubscriptionType())
         {
             InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
             if (IsInitialReport())
@@ -155,6 +195,8 @@ CHIP_ERROR ReadHandler::OnStatusResponse(Messaging::ExchangeContext * apExchange
             }
             else
             {
+                // The exchange closes once this status response has been handled, the next report opens a new one.
+                mpExchangeCtx = nullptr;
                 MoveToState(HandlerState::GeneratingReports);
             }
         }
@@ -180,16 +222,18 @@ exit:
 
 CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload)
 {
-    VerifyOrReturnLogError(IsReportable(), CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnLogError(mpExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    // The reporting engine has already checked IsReportable(), which no longer holds once the last chunk has been built.
+    VerifyOrReturnLogError(IsGeneratingReports(), CHIP_ERROR_INCORRECT_STATE);
     if (IsInitialReport())
     {
         VerifyOrReturnLogError(mpExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
         mSessionHandle.SetValue(mpExchangeCtx->GetSecureSession());
     }
-    else
+    else if (mpExchangeCtx == nullptr)
     {
+        // Only the first chunk of a subscription report opens an exchange, the following chunks reuse it.
         mpExchangeCtx = mpExchangeMgr->NewContext(mSessionHandle.Value(), this);
+        VerifyOrReturnLogError(mpExchangeCtx != nullptr, CHIP_ERROR_NO_MEMORY);
         mpExchangeCtx->SetResponseTimeout(kImMessageTimeoutMsec);
     }
     VerifyOrReturnLogError(mpExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
@@ -203,7 +247,17 @@ CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload)
             err = RefreshSubscribeSyncTimer();
         }
     }
-    ClearDirty();
+    if (!IsChunkedReport())
+    {
+        // Paths dirtied while a chunked report was being sent may have been skipped by it, the handler stays dirty to
+        // report them. Only those are reported again, the paths dirtied before the report started are covered by it.
+        mReportedDirtyGeneration = mReportStartDirtyGeneration;
+        if (!mDirtyDuringChunkedReport)
+        {
+            ClearDirty();
+        }
+        mDirtyDuringChunkedReport = false;
+    }
     return err;
 }
 
@@ -267,7 +321,9 @@ CHIP_ERROR ReadHandler::ProcessReadRequest(System::PacketBufferHandle && aPayloa
     else
     {
         SuccessOrExit(err);
-        err = ProcessAttributePathList(attributePathListParser);
+        AttributeDataVersionList::Parser dataVersionListParser;
+        bool hasDataVersions = (readRequestParser.GetAttributeDataVersionList(&dataVersionListParser) == CHIP_NO_ERROR);
+        err = ProcessAttributePathList(attributePathListParser, hasDataVersions ? &dataVersionListParser : nullptr);
     }
     SuccessOrExit(err);
     err = readRequestParser.GetEventPathList(&eventPathListParser);
@@ -307,7 +363,8 @@ exit:
     return err;
 }
 
-CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser)
+CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser,
+                                                 AttributeDataVersionList::Parser * apDataVersionListParser)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     TLV::TLVReader reader;
@@ -349,6 +406,16 @@ CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathList::Parser & aAt
             err = CHIP_NO_ERROR;
         }
         SuccessOrExit(err);
+
+        // The data versions are matched with the paths by position, a null one means the client has no version for that path.
+        if (apDataVersionListParser != nullptr && apDataVersionListParser->Next() == CHIP_NO_ERROR &&
+            !apDataVersionListParser->IsNull())
+        {
+            err = apDataVersionListParser->GetVersion(&(clusterInfo.mDataVersion));
+            SuccessOrExit(err);
+            clusterInfo.mFlags.Set(ClusterInfo::Flags::kDataVersionValid);
+        }
+
         err = InteractionModelEngine::GetInstance()->PushFront(mpAttributeClusterInfoList, clusterInfo);
         SuccessOrExit(err);
         mInitialReport = true;
@@ -434,10 +501,65 @@ void ReadHandler::MoveToState(const HandlerState aTargetState)
     ChipLogDetail(DataManagement, "IM RH moving to [%s]", GetStateStr());
 }
 
+bool ReadHandler::IsReportable()
+{
+    if (!IsGeneratingReports())
+    {
+        return false;
+    }
+
+    // The remaining chunks of a report are sent as soon as the previous one is acknowledged, regardless of the min interval.
+    if (mMoreChunkedMessages)
+    {
+        return true;
+    }
+
+    // Changes that happen within the min interval all go out in the report sent once it is over.
+    if (mHoldReport)
+    {
+        return false;
+    }
+
+    return !IsSubscriptionType() || IsInitialReport() || mDirty || mMaxIntervalElapsed || HasNewEvents();
+}
+
+bool ReadHandler::HasNewEvents()
+{
+    if (mpEventClusterInfoList == nullptr)
+    {
+        return false;
+    }
+
+    if (mCurrentPriority != PriorityLevel::Invalid)
+    {
+        // An event upload is in the middle of a priority level.
+        return true;
+    }
+
+    return mEventsLogged;
+}
+
+void ReadHandler::OnEventLogged(const EventSchema & aEventSchema)
+{
+    // Same match as the one FetchEventsSince uses to pick the events of a report.
+    for (ClusterInfo * clusterInfo = mpEventClusterInfoList; clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        if (clusterInfo->mNodeId == aEventSchema.mNodeId && clusterInfo->mEndpointId == aEventSchema.mEndpointId &&
+            clusterInfo->mClusterId == aEventSchema.mClusterId && clusterInfo->mEventId == aEventSchema.mEventId)
+        {
+            mEventsLogged = true;
+            return;
+        }
+    }
+}
+
 bool ReadHandler::CheckEventClean(EventManagement & aEventManager)
 {
     if (mCurrentPriority == PriorityLevel::Invalid)
     {
+        // The upload starting here covers every event logged so far.
+        mEventsLogged = false;
+
         // Upload is not in middle, previous mLastScheduledEventNumber is not valid, Check for new events from Critical high
         // priority to Debug low priority, and set a checkpoint when there is dirty events
         for (int index = ArraySize(mSelfProcessedEvents) - 1; index >= 0; index--)
@@ -503,7 +625,10 @@ CHIP_ERROR ReadHandler::SendSubscribeResponse()
     {
         mpDelegate->SubscriptionEstablished(this);
     }
-    return mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::SubscribeResponse, std::move(packet));
+    CHIP_ERROR err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::SubscribeResponse, std::move(packet));
+    // The exchange closes after the subscribe response, the reports that follow open their own.
+    mpExchangeCtx = nullptr;
+    return err;
 }
 
 CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aPayload)
@@ -526,7 +651,10 @@ CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aP
     }
     else if (err == CHIP_NO_ERROR)
     {
-        ReturnLogErrorOnFailure(ProcessAttributePathList(attributePathListParser));
+        AttributeDataVersionList::Parser dataVersionListParser;
+        bool hasDataVersions = (subscribeRequestParser.GetAttributeDataVersionList(&dataVersionListParser) == CHIP_NO_ERROR);
+        ReturnLogErrorOnFailure(
+            ProcessAttributePathList(attributePathListParser, hasDataVersions ? &dataVersionListParser : nullptr));
     }
     ReturnLogErrorOnFailure(err);
 
@@ -551,6 +679,7 @@ CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aP
     // SuccessOrExit(err);
     mSubscriptionId = GetRandU64();
 
+    InteractionModelEngine::GetInstance()->GetReportingEngine().RegisterInterest(*this);
     MoveToState(HandlerState::GeneratingReports);
 
     InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
@@ -563,6 +692,18 @@ CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aP
     return CHIP_NO_ERROR;
 }
 
+bool ReadHandler::IsInterestedIn(const ClusterInfo & aAttributePath) const
+{
+    for (auto clusterInfo = mpAttributeClusterInfoList; clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        if (clusterInfo->IsAttributePathSupersetOf(aAttributePath) || aAttributePath.IsAttributePathSupersetOf(*clusterInfo))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void ReadHandler::OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLayer, void * apAppState)
 {
     ReadHandler * aReadHandler = static_cast<ReadHandler *>(apAppState);
@@ -570,14 +711,30 @@ void ReadHandler::OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLa
     InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
 }
 
+void ReadHandler::OnMaxIntervalTimerCallback(System::Layer * apSystemLayer, void * apAppState)
+{
+    ReadHandler * aReadHandler        = static_cast<ReadHandler *>(apAppState);
+    aReadHandler->mHoldReport         = false;
+    aReadHandler->mMaxIntervalElapsed = true;
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+}
+
 CHIP_ERROR ReadHandler::RefreshSubscribeSyncTimer()
 {
+    System::Layer * systemLayer = InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer();
+
     ChipLogProgress(DataManagement, "ReadHandler::Refresh Subscribe Sync Timer with %d seconds", mMinIntervalFloorSeconds);
-    InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
-        OnRefreshSubscribeTimerSyncCallback, this);
-    mHoldReport = true;
-    return InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->StartTimer(
-        mMinIntervalFloorSeconds * kMillisecondsPerSecond, OnRefreshSubscribeTimerSyncCallback, this);
+    systemLayer->CancelTimer(OnRefreshSubscribeTimerSyncCallback, this);
+    systemLayer->CancelTimer(OnMaxIntervalTimerCallback, this);
+    mHoldReport         = true;
+    mMaxIntervalElapsed = false;
+    ReturnErrorOnFailure(
+        systemLayer->StartTimer(mMinIntervalFloorSeconds * kMillisecondsPerSecond, OnRefreshSubscribeTimerSyncCallback, this));
+
+    // Without a max interval there is nothing to keep alive. A max interval below the min interval is taken as the min one.
+    VerifyOrReturnError(mMaxIntervalCeilingSeconds != 0, CHIP_NO_ERROR);
+    uint32_t maxIntervalSeconds = std::max(mMinIntervalFloorSeconds, mMaxIntervalCeilingSeconds);
+    return systemLayer->StartTimer(maxIntervalSeconds * kMillisecondsPerSecond, OnMaxIntervalTimerCallback, this);
 }
 } // namespace app
 } // namespace chip
@@ -27,6 +27,7 @@
 #include <app/ClusterInfo.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelDelegate.h>
+#include <app/reporting/InterestIndex.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLVDebug.hpp>
 #include <lib/support/CodeUtils.h>
@@ -78,7 +79,9 @@ public:
 
     /**
      *  Shut down the ReadHandler. This terminates this instance
-     *  of the object and releases all held resources.
+     *  of the object and releases all held resources. A handler
+     *  allocated by the InteractionModelEngine goes back to its pool,
+     *  and must not be used after this call.
      *
      */
     void Shutdown(ShutdownOptions aOptions = ShutdownOptions::KeepCurrentExchange);
@@ -105,13 +108,27 @@ public:
     CHIP_ERROR SendReportData(System::PacketBufferHandle && aPayload);
 
     bool IsFree() const { return mState == HandlerState::Uninitialized; }
-    bool IsReportable() const { return mState == HandlerState::GeneratingReports && !mHoldReport; }
+
+    /**
+     *  Whether the reporting engine should send a report now. Past its min interval, a subscription only reports once one of
+     *  its attributes is dirty, new events were logged, or its max interval is up, in which case the report keeps the
+     *  subscription alive even if empty.
+     */
+    bool IsReportable();
     bool IsGeneratingReports() const { return mState == HandlerState::GeneratingReports; }
     bool IsAwaitingReportResponse() const { return mState == HandlerState::AwaitingReportResponse; }
     virtual ~ReadHandler() = default;
 
     ClusterInfo * GetAttributeClusterInfolist() { return mpAttributeClusterInfoList; }
+    /**
+     * Returns whether one of the attribute paths of this handler intersects aAttributePath.
+     */
+    bool IsInterestedIn(const ClusterInfo & aAttributePath) const;
     ClusterInfo * GetEventClusterInfolist() { return mpEventClusterInfoList; }
+    /**
+     * Records that an event of aEventSchema was logged, if one of the event paths of this handler matches it.
+     */
+    void OnEventLogged(const EventSchema & aEventSchema);
     EventNumber * GetVendedEventNumberList() { return mSelfProcessedEvents; }
     PriorityLevel GetCurrentPriority() { return mCurrentPriority; }
 
@@ -120,6 +137,10 @@ public:
     // sanpshotted last event, check with latest last event number, re-setup snapshoted checkpoint, and compare again.
     bool CheckEventClean(EventManagement & aEventManager);
 
+    // Whether events of interest were logged since the last report. Unlike CheckEventClean, this does not snapshot anything,
+    // and events that match none of the event paths of this handler do not count.
+    bool HasNewEvents();
+
     // Move to the next dirty priority from critical high priority to debug low priority, where last schedule event number
     // is larger than current self vended event number
     void MoveToNextScheduledDirtyPriority();
@@ -129,10 +150,49 @@ public:
     bool IsInitialReport() { return mInitialReport; }
     CHIP_ERROR OnSubscribeRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
     void GetSubscriptionId(uint64_t & aSubscriptionId) { aSubscriptionId = mSubscriptionId; }
-    void SetDirty() { mDirty = true; }
+    void SetDirty()
+    {
+        mDirty = true;
+        // A chunked report may already have sent, or moved past, the paths dirtied now: they are reported again next.
+        mDirtyDuringChunkedReport = mDirtyDuringChunkedReport || IsChunkedReport();
+    }
     void ClearDirty() { mDirty = false; }
     bool IsDirty() { return mDirty; }
 
+    /**
+     *  The dirty generation of the reporting engine covered by the last complete report of this handler: dirty paths last
+     *  marked dirty in it or before are not reported again. The generation a report starts at becomes the covered one once
+     *  its last chunk is sent.
+     */
+    uint64_t GetReportedDirtyGeneration() const { return mReportedDirtyGeneration; }
+    void SetReportStartDirtyGeneration(uint64_t aGeneration) { mReportStartDirtyGeneration = aGeneration; }
+
+    /**
+     *  Whether the last ReportData sent, or the one being built, has more chunks following it. While this is set, the
+     *  attribute iteration resumes from the saved cursor instead of restarting from the head of the path list.
+     */
+    bool IsChunkedReport() const { return mMoreChunkedMessages; }
+    void SetMoreChunkedMessages(bool aMoreChunkedMessages) { mMoreChunkedMessages = aMoreChunkedMessages; }
+
+    /**
+     *  The cursor of a chunked report: the path of this handler to resume from and, for reports generated from the global
+     *  dirty set, the dirty path to resume from within it. Both are null when the next report starts from the beginning.
+     */
+    ClusterInfo * GetAttributeResumePath() { return mpAttributeResumePath; }
+    ClusterInfo * GetDirtyResumePath() { return mpDirtyResumePath; }
+    void SetResumePaths(ClusterInfo * apAttributePath, ClusterInfo * apDirtyPath)
+    {
+        mpAttributeResumePath = apAttributePath;
+        mpDirtyResumePath     = apDirtyPath;
+    }
+
+    /**
+     *  The index of this subscription in the interest index of the reporting engine, or InterestIndex::kInvalidHandlerIndex
+     *  when it has none and its paths have to be checked one by one.
+     */
+    uint8_t GetInterestIndex() const { return mInterestIndex; }
+    void SetInterestIndex(uint8_t aInterestIndex) { mInterestIndex = aInterestIndex; }
+
 private:
     friend class TestReadInteraction;
     enum class HandlerState
@@ -145,11 +205,13 @@ private:
     };
 
     static void OnRefreshSubscribeTimerSyncCallback(System::Layer * apSystemLayer, void * apAppState);
+    static void OnMaxIntervalTimerCallback(System::Layer * apSystemLayer, void * apAppState);
     CHIP_ERROR RefreshSubscribeSyncTimer();
     CHIP_ERROR SendSubscribeResponse();
     CHIP_ERROR ProcessSubscribeRequest(System::PacketBufferHandle && aPayload);
     CHIP_ERROR ProcessReadRequest(System::PacketBufferHandle && aPayload);
-    CHIP_ERROR ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser);
+    CHIP_ERROR ProcessAttributePathList(AttributePathList::Parser & aAttributePathListParser,
+                                        AttributeDataVersionList::Parser * apDataVersionListParser);
     CHIP_ERROR ProcessEventPathList(EventPathList::Parser & aEventPathListParser);
     CHIP_ERROR OnStatusResponse(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
@@ -174,10 +236,10 @@ private:
     PriorityLevel mCurrentPriority = PriorityLevel::Invalid;
 
     // The event number of the last processed event for each priority level
-    EventNumber mSelfProcessedEvents[kNumPriorityLevel];
+    EventNumber mSelfProcessedEvents[kNumPriorityLevel] = { 0 };
 
     // The last schedule event number snapshoted in the beginning when preparing to fill new events to reports
-    EventNumber mLastScheduledEventNumber[kNumPriorityLevel];
+    EventNumber mLastScheduledEventNumber[kNumPriorityLevel] = { 0 };
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
     InteractionModelDelegate * mpDelegate      = nullptr;
     bool mInitialReport                        = false;
@@ -186,8 +248,17 @@ private:
     uint16_t mMinIntervalFloorSeconds          = 0;
     uint16_t mMaxIntervalCeilingSeconds        = 0;
     Optional<SessionHandle> mSessionHandle;
-    bool mHoldReport = false;
-    bool mDirty      = false;
+    bool mHoldReport                     = false;
+    bool mMaxIntervalElapsed             = false;
+    bool mDirty                          = false;
+    bool mMoreChunkedMessages            = false;
+    bool mDirtyDuringChunkedReport       = false;
+    bool mEventsLogged                   = false;
+    ClusterInfo * mpAttributeResumePath  = nullptr;
+    ClusterInfo * mpDirtyResumePath      = nullptr;
+    uint64_t mReportedDirtyGeneration    = 0;
+    uint64_t mReportStartDirtyGeneration = 0;
+    uint8_t mInterestIndex               = reporting::InterestIndex::kInvalidHandlerIndex;
 };
 } // namespace app
 } // namespace chip
@@ -30,21 +30,33 @@
 namespace chip {
 namespace app {
 namespace reporting {
+namespace {
+// Space kept free in every ReportData for the MoreChunkedMessages flag: control byte, context tag.
+constexpr uint32_t kReservedSizeForMoreChunksFlag = 2;
+
+// The errors the TLV writer reports when the ReportData being built has no room left.
+bool IsReportFull(CHIP_ERROR aError)
+{
+    return aError == CHIP_ERROR_BUFFER_TOO_SMALL || aError == CHIP_ERROR_NO_MEMORY;
+}
+} // namespace
+
 CHIP_ERROR Engine::Init()
 {
-    mMoreChunkedMessages = false;
-    mNumReportsInFlight  = 0;
-    mCurReadHandlerIdx   = 0;
+    mNumReportsInFlight = 0;
+    mCurReadHandlerIdx  = 0;
+    mRunScheduled       = false;
     return CHIP_NO_ERROR;
 }
 
 void Engine::Shutdown()
 {
-    mMoreChunkedMessages = false;
-    mNumReportsInFlight  = 0;
-    mCurReadHandlerIdx   = 0;
+    mNumReportsInFlight = 0;
+    mCurReadHandlerIdx  = 0;
+    mRunScheduled       = false;
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpGlobalDirtySet);
     mpGlobalDirtySet = nullptr;
+    mInterestIndex.Clear();
 }
 
 EventNumber Engine::CountEvents(ReadHandler * apReadHandler, EventNumber * apInitialEvents)
@@ -64,7 +76,9 @@ EventNumber Engine::CountEvents(ReadHandler * apReadHandler, EventNumber * apIni
 CHIP_ERROR
 Engine::RetrieveClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo)
 {
-    CHIP_ERROR err                                            = CHIP_NO_ERROR;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVWriter backup;
+    aAttributeDataList.Checkpoint(backup);
     AttributeDataElement::Builder attributeDataElementBuilder = aAttributeDataList.CreateAttributeDataElementBuilder();
     AttributePath::Builder attributePathBuilder               = attributeDataElementBuilder.CreateAttributePathBuilder();
     attributePathBuilder.NodeId(aClusterInfo.mNodeId)
@@ -86,6 +100,12 @@ Engine::RetrieveClusterData(AttributeDataList::Builder & aAttributeDataList, Clu
 
 exit:
     if (err != CHIP_NO_ERROR)
+    {
+        // Drop the partially encoded element so that the list can be closed, or retried in the next chunk.
+        aAttributeDataList.Rollback(backup);
+        aAttributeDataList.ResetError();
+    }
+    if (err != CHIP_NO_ERROR && !IsReportFull(err))
     {
         ChipLogError(DataManagement, "Error retrieving data from clusterId: " ChipLogFormatMEI ", err = %" CHIP_ERROR_FORMAT,
                      ChipLogValueMEI(aClusterInfo.mClusterId), err.Format());
@@ -94,29 +114,106 @@ exit:
     return err;
 }
 
+CHIP_ERROR Engine::RetrieveClusterStatus(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo,
+                                         Protocols::InteractionModel::Status aStatus)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVWriter backup;
+    aAttributeDataList.Checkpoint(backup);
+    AttributeDataElement::Builder attributeDataElementBuilder = aAttributeDataList.CreateAttributeDataElementBuilder();
+    AttributePath::Builder attributePathBuilder               = attributeDataElementBuilder.CreateAttributePathBuilder();
+    attributePathBuilder.NodeId(aClusterInfo.mNodeId)
+        .EndpointId(aClusterInfo.mEndpointId)
+        .ClusterId(aClusterInfo.mClusterId)
+        .FieldId(aClusterInfo.mFieldId)
+        .EndOfAttributePath();
+    err = attributePathBuilder.GetError();
+    SuccessOrExit(err);
+
+    err = attributeDataElementBuilder.GetWriter()->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Status), aStatus);
+    SuccessOrExit(err);
+    attributeDataElementBuilder.MoreClusterData(false);
+    attributeDataElementBuilder.EndOfAttributeDataElement();
+    err = attributeDataElementBuilder.GetError();
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        aAttributeDataList.Rollback(backup);
+        aAttributeDataList.ResetError();
+    }
+    return err;
+}
+
+CHIP_ERROR Engine::RetrieveOversizedClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo)
+{
+    // Nothing else is in this chunk yet, so the data of this path cannot fit in any chunk: tell the reader instead of
+    // leaving the path out of the report.
+    ChipLogError(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Field %" PRIx32 " is too big for a report",
+                 aClusterInfo.mClusterId, aClusterInfo.mFieldId);
+    return RetrieveClusterStatus(aAttributeDataList, aClusterInfo, Protocols::InteractionModel::Status::ResourceExhausted);
+}
+
 CHIP_ERROR Engine::BuildSingleReportDataAttributeDataList(ReportData::Builder & aReportDataBuilder, ReadHandler * apReadHandler)
 {
     CHIP_ERROR err      = CHIP_NO_ERROR;
     bool attributeClean = true;
+    bool moreChunks     = false;
     TLV::TLVWriter backup;
+    // Resume where the previous chunk of this report stopped, if any.
+    ClusterInfo * clusterInfo = apReadHandler->GetAttributeResumePath();
+    ClusterInfo * dirtyPath   = apReadHandler->GetDirtyResumePath();
+    if (clusterInfo == nullptr)
+    {
+        clusterInfo = apReadHandler->GetAttributeClusterInfolist();
+        dirtyPath   = nullptr;
+        apReadHandler->SetReportStartDirtyGeneration(mDirtyGeneration);
+    }
+    apReadHandler->SetResumePaths(nullptr, nullptr);
+
     aReportDataBuilder.Checkpoint(backup);
     AttributeDataList::Builder attributeDataList = aReportDataBuilder.CreateAttributeDataListBuilder();
     SuccessOrExit(err = aReportDataBuilder.GetError());
-    // TODO: Need to handle multiple chunk of message
-    for (auto clusterInfo = apReadHandler->GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    for (; clusterInfo != nullptr && !moreChunks; clusterInfo = clusterInfo->mpNext)
     {
         if (apReadHandler->IsInitialReport())
         {
+            if (clusterInfo->mFlags.Has(ClusterInfo::Flags::kDataVersionValid) &&
+                IsClusterDataVersionEqual(clusterInfo->mEndpointId, clusterInfo->mClusterId, clusterInfo->mDataVersion))
+            {
+                // The reader already has the current data of this cluster.
+                continue;
+            }
+
             // Retrieve data for this cluster instance and clear its dirty flag.
             err = RetrieveClusterData(attributeDataList, *clusterInfo);
+            if (IsReportFull(err) && !attributeClean)
+            {
+                apReadHandler->SetResumePaths(clusterInfo, nullptr);
+                moreChunks = true;
+                err        = CHIP_NO_ERROR;
+                break;
+            }
+            if (IsReportFull(err))
+            {
+                err = RetrieveOversizedClusterData(attributeDataList, *clusterInfo);
+            }
             VerifyOrExit(err == CHIP_NO_ERROR,
                          ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting"));
             attributeClean = false;
         }
-        else
+        else if (apReadHandler->IsDirty())
         {
-            for (auto path = mpGlobalDirtySet; path != nullptr; path = path->mpNext)
+            // The dirty set is shared by all the subscriptions, a handler that is not dirty has already reported its paths.
+            ClusterInfo * path = (dirtyPath != nullptr) ? dirtyPath : mpGlobalDirtySet;
+            dirtyPath          = nullptr;
+            for (; path != nullptr; path = path->mpNext)
             {
+                if (path->mDirtyGeneration <= apReadHandler->GetReportedDirtyGeneration())
+                {
+                    // Already reported by an earlier report of this handler, and not dirtied again since.
+                    continue;
+                }
                 if (clusterInfo->IsAttributePathSupersetOf(*path))
                 {
                     err = RetrieveClusterData(attributeDataList, *path);
@@ -131,6 +228,18 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeDataList(ReportData::Builder &
                     // common.
                     continue;
                 }
+                if (IsReportFull(err) && !attributeClean)
+                {
+                    apReadHandler->SetResumePaths(clusterInfo, path);
+                    moreChunks = true;
+                    err        = CHIP_NO_ERROR;
+                    break;
+                }
+                if (IsReportFull(err))
+                {
+                    err = RetrieveOversizedClusterData(attributeDataList,
+                                                       clusterInfo->IsAttributePathSupersetOf(*path) ? *path : *clusterInfo);
+                }
                 VerifyOrExit(err == CHIP_NO_ERROR,
                              ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting"));
                 attributeClean = false;
@@ -139,6 +248,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeDataList(ReportData::Builder &
     }
     attributeDataList.EndOfAttributeDataList();
     err = attributeDataList.GetError();
+    apReadHandler->SetMoreChunkedMessages(moreChunks);
 
 exit:
     if (attributeClean || err != CHIP_NO_ERROR)
@@ -148,7 +258,8 @@ exit:
     return err;
 }
 
-CHIP_ERROR Engine::BuildSingleReportDataEventList(ReportData::Builder & aReportDataBuilder, ReadHandler * apReadHandler)
+CHIP_ERROR Engine::BuildSingleReportDataEventList(ReportData::Builder & aReportDataBuilder, ReadHandler * apReadHandler,
+                                                  bool aHasAttributeData)
 {
     CHIP_ERROR err    = CHIP_NO_ERROR;
     size_t eventCount = 0;
@@ -165,9 +276,6 @@ CHIP_ERROR Engine::BuildSingleReportDataEventList(ReportData::Builder & aReportD
     VerifyOrExit(clusterInfoList != nullptr, );
     VerifyOrExit(apReadHandler != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
 
-    eventList = aReportDataBuilder.CreateEventDataListBuilder();
-    SuccessOrExit(err = eventList.GetError());
-
     memcpy(initialEvents, eventNumberList, sizeof(initialEvents));
     // If the eventManager is not valid or has not been initialized,
     // skip the rest of processing
@@ -190,6 +298,16 @@ CHIP_ERROR Engine::BuildSingleReportDataEventList(ReportData::Builder & aReportD
         ExitNow(); // Read clean, move along
     }
 
+    eventList = aReportDataBuilder.CreateEventDataListBuilder();
+    err       = eventList.GetError();
+    if (IsReportFull(err) && aHasAttributeData)
+    {
+        // The attribute data took up this chunk, the events go out in the next one.
+        apReadHandler->SetMoreChunkedMessages(true);
+        ExitNow(err = CHIP_NO_ERROR);
+    }
+    SuccessOrExit(err);
+
     while (apReadHandler->GetCurrentPriority() != PriorityLevel::Invalid)
     {
         uint8_t priorityIndex = static_cast<uint8_t>(apReadHandler->GetCurrentPriority());
@@ -203,12 +321,11 @@ CHIP_ERROR Engine::BuildSingleReportDataEventList(ReportData::Builder & aReportD
             // priority level.
             err = CHIP_NO_ERROR;
             apReadHandler->MoveToNextScheduledDirtyPriority();
-            mMoreChunkedMessages = false;
         }
         else if ((err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_ERROR_NO_MEMORY))
         {
-            // when first cluster event is too big to fit in the packet, ignore that cluster event.
-            if (eventCount == 0)
+            // when first cluster event is too big to fit in an otherwise empty packet, ignore that cluster event.
+            if (eventCount == 0 && !aHasAttributeData)
             {
                 eventNumberList[priorityIndex]++;
                 ChipLogDetail(DataManagement, "<RE:Run> first cluster event is too big so that it fails to fit in the packet!");
@@ -216,18 +333,18 @@ CHIP_ERROR Engine::BuildSingleReportDataEventList(ReportData::Builder & aReportD
             }
             else
             {
-                // `FetchEventsSince` has filled the available space
-                // within the allowed buffer before it fit all the
-                // available events.  This is an expected condition,
+                // `FetchEventsSince` (or the attribute data before it)
+                // has filled the available space within the allowed
+                // buffer before it fit all the available events.  This is an expected condition,
                 // so we do not propagate the error to higher levels;
                 // instead, we terminate the event processing for now
                 // (we will get another chance immediately afterwards,
-                // with a ew buffer) and do not advance the processing
+                // with a new buffer) and do not advance the processing
                 // to the next priority level.
                 err = CHIP_NO_ERROR;
+                apReadHandler->SetMoreChunkedMessages(true);
                 break;
             }
-            mMoreChunkedMessages = true;
         }
         else
         {
@@ -257,10 +374,21 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportData::Builder reportDataBuilder;
     chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    uint32_t reservedSize                      = kReservedSizeForMoreChunksFlag;
+    uint32_t attributeDataStart                = 0;
+    // A chunked report whose attribute data was all sent already only has events left to carry.
+    bool attributeDataComplete = apReadHandler->IsChunkedReport() && apReadHandler->GetAttributeResumePath() == nullptr;
 
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
+    // Chunks are cut at kMaxSecureSduLengthBytes even if the buffer happens to be larger.
+    if (bufHandle->AvailableDataLength() > kMaxSecureSduLengthBytes)
+    {
+        reservedSize += static_cast<uint32_t>(bufHandle->AvailableDataLength() - kMaxSecureSduLengthBytes);
+    }
     reportDataWriter.Init(std::move(bufHandle));
+    SuccessOrExit(err = reportDataWriter.ReserveBuffer(reservedSize));
+    apReadHandler->SetMoreChunkedMessages(false);
 
     // Create a report data.
     err = reportDataBuilder.Init(&reportDataWriter);
@@ -273,17 +401,26 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
         reportDataBuilder.SubscriptionId(subscriptionId);
     }
 
-    err = BuildSingleReportDataAttributeDataList(reportDataBuilder, apReadHandler);
-    SuccessOrExit(err);
+    attributeDataStart = reportDataWriter.GetLengthWritten();
+    if (!attributeDataComplete)
+    {
+        err = BuildSingleReportDataAttributeDataList(reportDataBuilder, apReadHandler);
+        SuccessOrExit(err);
+    }
 
-    err = BuildSingleReportDataEventList(reportDataBuilder, apReadHandler);
-    SuccessOrExit(err);
+    // Events are only added once all the attribute data has gone out.
+    if (!apReadHandler->IsChunkedReport())
+    {
+        err = BuildSingleReportDataEventList(reportDataBuilder, apReadHandler,
+                                             reportDataWriter.GetLengthWritten() != attributeDataStart);
+        SuccessOrExit(err);
+    }
 
     // TODO: Add mechanism to set mSuppressResponse to handle status reports for multiple reports
-    // TODO: Add more chunk message support, currently mMoreChunkedMessages is always false.
-    if (mMoreChunkedMessages)
+    SuccessOrExit(err = reportDataWriter.UnreserveBuffer(kReservedSizeForMoreChunksFlag));
+    if (apReadHandler->IsChunkedReport())
     {
-        reportDataBuilder.MoreChunkedMessages(mMoreChunkedMessages);
+        reportDataBuilder.MoreChunkedMessages(true);
     }
 
     reportDataBuilder.EndOfReportData();
@@ -315,7 +452,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
     ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
-                  mCurReadHandlerIdx, mMoreChunkedMessages ? "more messages" : "no more messages");
+                  mCurReadHandlerIdx, apReadHandler->IsChunkedReport() ? "more messages" : "no more messages");
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -328,15 +465,24 @@ exit:
 void Engine::Run(System::Layer * aSystemLayer, void * apAppState)
 {
     Engine * const pEngine = reinterpret_cast<Engine *>(apAppState);
+    pEngine->mRunScheduled = false;
     pEngine->Run();
 }
 
 CHIP_ERROR Engine::ScheduleRun()
 {
+    if (mRunScheduled)
+    {
+        // The pending run serves every handler that is reportable by then.
+        return CHIP_NO_ERROR;
+    }
+
     if (InteractionModelEngine::GetInstance()->GetExchangeManager() != nullptr)
     {
-        return InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->ScheduleWork(Run,
-                                                                                                                             this);
+        Messaging::ExchangeManager * exchangeManager = InteractionModelEngine::GetInstance()->GetExchangeManager();
+        CHIP_ERROR err = exchangeManager->GetSessionManager()->SystemLayer()->ScheduleWork(Run, this);
+        mRunScheduled = (err == CHIP_NO_ERROR);
+        return err;
     }
     else
     {
@@ -346,37 +492,52 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
-    uint32_t numReadHandled = 0;
-
     InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
-    ReadHandler * readHandler         = imEngine->mReadHandlers + mCurReadHandlerIdx;
-
-    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < CHIP_IM_MAX_NUM_READ_HANDLER))
+    const size_t numReadHandlers      = imEngine->mReadHandlers.Allocated();
+    size_t numReadHandled             = 0;
+    bool sendFailed                   = false;
+
+    // The handlers are served round robin, in the order the pool iterates over them: this run starts where the previous one
+    // stopped, wrapping around once it reaches the end.
+    const size_t firstReadHandlerIdx = (mCurReadHandlerIdx < numReadHandlers) ? mCurReadHandlerIdx : 0;
+    for (size_t pass = 0; pass < 2 && !sendFailed; pass++)
     {
-        if (readHandler->IsReportable())
-        {
-            CHIP_ERROR err = BuildAndSendSingleReportData(readHandler);
-            if (err != CHIP_NO_ERROR)
+        size_t readHandlerIdx = 0;
+        imEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * readHandler) {
+            const bool inPass = (pass == 0) ? (readHandlerIdx >= firstReadHandlerIdx) : (readHandlerIdx < firstReadHandlerIdx);
+            readHandlerIdx++;
+            if (!inPass)
             {
-                return;
+                return true;
             }
-        }
-        numReadHandled++;
-        mCurReadHandlerIdx = (mCurReadHandlerIdx + 1) % CHIP_IM_MAX_NUM_READ_HANDLER;
-        readHandler        = imEngine->mReadHandlers + mCurReadHandlerIdx;
+            if (mNumReportsInFlight >= CHIP_IM_MAX_REPORTS_IN_FLIGHT || numReadHandled >= numReadHandlers)
+            {
+                return false;
+            }
+            mCurReadHandlerIdx = static_cast<uint32_t>(readHandlerIdx - 1);
+            // The handler shuts down, and goes back to the pool, when its report cannot be sent.
+            if (readHandler->IsReportable() && BuildAndSendSingleReportData(readHandler) != CHIP_NO_ERROR)
+            {
+                sendFailed = true;
+                return false;
+            }
+            numReadHandled++;
+            mCurReadHandlerIdx = static_cast<uint32_t>(readHandlerIdx);
+            return true;
+        });
     }
 
-    bool allReadClean = true;
-    for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
+    if (sendFailed)
     {
-        UpdateReadHandlerDirty(handler);
-        if (handler.IsDirty())
-        {
-            allReadClean = false;
-            break;
-        }
+        return;
     }
 
+    bool allReadClean = true;
+    imEngine->mReadHandlers.ForEachActiveObject([&allReadClean](ReadHandler * readHandler) {
+        allReadClean = !readHandler->IsDirty();
+        return allReadClean;
+    });
+
     if (allReadClean)
     {
         InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpGlobalDirtySet);
@@ -385,48 +546,91 @@ void Engine::Run()
 
 CHIP_ERROR Engine::SetDirty(ClusterInfo & aClusterInfo)
 {
-    for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
+    InteractionModelEngine * imEngine     = InteractionModelEngine::GetInstance();
+    InterestIndex::HandlerMask candidates = mInterestIndex.GetInterestedHandlers(aClusterInfo);
+    bool anyInterested                    = false;
+
+    // Subscriptions without an index could not be filed in mInterestIndex, their paths are checked one by one.
+    auto isInterested = [&](ReadHandler * handler) {
+        const uint8_t index  = handler->GetInterestIndex();
+        const bool candidate = (index == InterestIndex::kInvalidHandlerIndex) ||
+            ((candidates & (static_cast<InterestIndex::HandlerMask>(1) << index)) != 0);
+        return candidate && handler->IsSubscriptionType() &&
+            (handler->IsGeneratingReports() || handler->IsAwaitingReportResponse()) && handler->IsInterestedIn(aClusterInfo);
+    };
+
+    imEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        anyInterested = isInterested(handler);
+        return !anyInterested;
+    });
+
+    if (!anyInterested)
     {
-        if (handler.IsSubscriptionType() && (handler.IsGeneratingReports() || handler.IsAwaitingReportResponse()))
-        {
-            handler.SetDirty();
-        }
+        ChipLogDetail(DataManagement, "AttributePath is not interested");
+        return CHIP_NO_ERROR;
     }
-    if (!InteractionModelEngine::GetInstance()->MergeOverlappedAttributePath(mpGlobalDirtySet, aClusterInfo) &&
-        InteractionModelEngine::GetInstance()->IsOverlappedAttributePath(aClusterInfo))
+
+    if (!imEngine->MergeOverlappedAttributePath(mpGlobalDirtySet, aClusterInfo))
     {
-        ReturnLogErrorOnFailure(InteractionModelEngine::GetInstance()->PushFront(mpGlobalDirtySet, aClusterInfo));
+        ReturnLogErrorOnFailure(imEngine->PushFront(mpGlobalDirtySet, aClusterInfo));
     }
-    return CHIP_NO_ERROR;
-}
 
-void Engine::UpdateReadHandlerDirty(ReadHandler & aReadHandler)
-{
-    if (!aReadHandler.IsDirty())
+    // Stamp the dirty path that now covers aClusterInfo, so that handlers which reported it before report it again.
+    mDirtyGeneration++;
+    for (ClusterInfo * path = mpGlobalDirtySet; path != nullptr; path = path->mpNext)
     {
-        return;
+        if (path->IsAttributePathSupersetOf(aClusterInfo))
+        {
+            path->mDirtyGeneration = mDirtyGeneration;
+        }
     }
-    if (!aReadHandler.IsSubscriptionType())
+
+    // Only mark the handlers dirty once the path is in the dirty set, so that a dirty handler always has something to report.
+    imEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        if (isInterested(handler))
+        {
+            handler->SetDirty();
+        }
+        return true;
+    });
+
+    // Subscriptions past their min interval report right away, the others once their min interval is over.
+    return ScheduleRun();
+}
+
+void Engine::OnEventLogged(const EventSchema & aEventSchema)
+{
+    InteractionModelEngine::GetInstance()->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        handler->OnEventLogged(aEventSchema);
+        return true;
+    });
+}
+
+void Engine::RegisterInterest(ReadHandler & aReadHandler)
+{
+    uint8_t index = mInterestIndex.GetFreeHandlerIndex();
+    if (index == InterestIndex::kInvalidHandlerIndex)
     {
+        ChipLogProgress(DataManagement, "No index left for subscription paths, they are checked one by one");
         return;
     }
-    for (auto clusterInfo = aReadHandler.GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+
+    aReadHandler.SetInterestIndex(index);
+    CHIP_ERROR err = mInterestIndex.Add(index, aReadHandler.GetAttributeClusterInfolist());
+    if (err != CHIP_NO_ERROR)
     {
-        bool intersected = false;
-        for (auto path = mpGlobalDirtySet; path != nullptr; path = path->mpNext)
-        {
-            if (path->IsAttributePathSupersetOf(*clusterInfo) || clusterInfo->IsAttributePathSupersetOf(*path))
-            {
-                intersected = true;
-            }
-        }
-        if (!intersected)
-        {
-            aReadHandler.ClearDirty();
-        }
+        // SetDirty still finds this subscription, it just has to look at all of them.
+        ChipLogProgress(DataManagement, "Failed to index subscription paths: %" CHIP_ERROR_FORMAT, err.Format());
     }
 }
 
+void Engine::UnregisterInterest(ReadHandler & aReadHandler)
+{
+    VerifyOrReturn(aReadHandler.GetInterestIndex() != InterestIndex::kInvalidHandlerIndex);
+    mInterestIndex.Remove(aReadHandler.GetInterestIndex(), aReadHandler.GetAttributeClusterInfolist());
+    aReadHandler.SetInterestIndex(InterestIndex::kInvalidHandlerIndex);
+}
+
 CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -26,6 +26,7 @@
 
 #include <app/MessageDef/ReportData.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/InterestIndex.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -33,6 +34,7 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
+#include <protocols/interaction_model/Constants.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
@@ -75,7 +77,8 @@ public:
     void OnReportConfirm();
 
     /**
-     * Main work-horse function that executes the run-loop asynchronously on the CHIP thread
+     * Main work-horse function that executes the run-loop asynchronously on the CHIP thread. Requests made before the run
+     * happens are coalesced into it, so that a single run serves every read handler that became reportable meanwhile.
      */
     CHIP_ERROR ScheduleRun();
 
@@ -84,25 +87,39 @@ public:
      */
     CHIP_ERROR SetDirty(ClusterInfo & aClusterInfo);
 
+    /**
+     * Called by EventManagement once an event is logged, so that only the subscriptions with a matching event path become
+     * reportable for it.
+     */
+    void OnEventLogged(const EventSchema & aEventSchema);
+
+    /**
+     * Files the attribute paths of a subscription in the index SetDirty uses to find the subscriptions interested in a path.
+     * Should be called once the paths of the subscription are known, and undone with UnregisterInterest before they are
+     * released.
+     */
+    void RegisterInterest(ReadHandler & aReadHandler);
+    void UnregisterInterest(ReadHandler & aReadHandler);
+
 private:
     friend class TestReportingEngine;
     /**
-     * Build Single Report Data including attribute changes and event data stream, and send out
+     * Build Single Report Data including attribute changes and event data stream, and send out. When the data does not fit
+     * in one message, the report is split into chunks: the read handler keeps where this chunk stopped, and the next one
+     * is built once the current one has been acknowledged.
      *
      */
     CHIP_ERROR BuildAndSendSingleReportData(ReadHandler * apReadHandler);
 
     CHIP_ERROR BuildSingleReportDataAttributeDataList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler);
-    CHIP_ERROR BuildSingleReportDataEventList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler);
+    CHIP_ERROR BuildSingleReportDataEventList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler,
+                                              bool aHasAttributeData);
     CHIP_ERROR RetrieveClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo);
+    CHIP_ERROR RetrieveClusterStatus(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo,
+                                     Protocols::InteractionModel::Status aStatus);
+    CHIP_ERROR RetrieveOversizedClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo);
     EventNumber CountEvents(ReadHandler * apReadHandler, EventNumber * apInitialEvents);
 
-    /**
-     * Check all active subscription, if the subscription has no paths that intersect with global dirty set,
-     * it would clear dirty flag for that subscription
-     *
-     */
-    void UpdateReadHandlerDirty(ReadHandler & aReadHandler);
     /**
      * Send Report via ReadHandler
      *
@@ -115,12 +132,6 @@ private:
      */
     static void Run(System::Layer * aSystemLayer, void * apAppState);
 
-    /**
-     * Boolean to show if more chunk message on the way
-     *
-     */
-    bool mMoreChunkedMessages = false;
-
     /**
      * The number of report date request in flight
      *
@@ -133,6 +144,12 @@ private:
      */
     uint32_t mCurReadHandlerIdx = 0;
 
+    /**
+     *  Whether a run has been scheduled on the CHIP thread and has not happened yet.
+     *
+     */
+    bool mRunScheduled = false;
+
     /**
      *  mpGlobalDirtySet is used to track the dirty cluster info application modified for attributes during
      *  post-subscription via SetDirty API, and further form the report. This reporting engine acquires this global dirty
@@ -141,6 +158,21 @@ private:
      *
      */
     ClusterInfo * mpGlobalDirtySet = nullptr;
+
+    /**
+     *  mDirtyGeneration counts the SetDirty calls. Every path of mpGlobalDirtySet carries the generation it was last dirtied
+     *  in, and every read handler the generation its last complete report covers, so that a handler only reports the dirty
+     *  paths that changed since.
+     *
+     */
+    uint64_t mDirtyGeneration = 0;
+
+    /**
+     *  mInterestIndex maps the attribute paths of the active subscriptions to their read handlers, so that SetDirty only
+     *  marks dirty, and only keeps the path of, the subscriptions that are interested in it.
+     *
+     */
+    InterestIndex mInterestIndex;
 };
 
 }; // namespace reporting
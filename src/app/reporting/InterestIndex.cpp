@@ -0,0 +1,212 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the index the reporting engine uses to find the subscriptions interested in a dirty attribute
+ *      path.
+ *
+ */
+
+#include <app/reporting/InterestIndex.h>
+#include <lib/support/IntegerHash.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+CHIP_ERROR InterestIndex::Add(uint8_t aHandlerIndex, const ClusterInfo * apAttributePathList)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrReturnError(aHandlerIndex < kMaxHandlers, CHIP_ERROR_INVALID_ARGUMENT);
+    HandlerMask handler = static_cast<HandlerMask>(1) << aHandlerIndex;
+    mRegistered |= handler;
+
+    // Once overflowed, lookups return every registered handler anyway.
+    for (const ClusterInfo * path = apAttributePathList; path != nullptr && !mOverflowed; path = path->mpNext)
+    {
+        if (IsWildcard(*path))
+        {
+            err = Insert(path->mEndpointId, path->mClusterId, 0, EntryType::kWildcard, handler);
+        }
+        else
+        {
+            err = Insert(path->mEndpointId, path->mClusterId, path->mFieldId, EntryType::kAttribute, handler);
+        }
+        if (err == CHIP_NO_ERROR)
+        {
+            err = Insert(path->mEndpointId, path->mClusterId, 0, EntryType::kCluster, handler);
+        }
+        mOverflowed = (err != CHIP_NO_ERROR);
+    }
+
+    return mOverflowed ? CHIP_ERROR_NO_MEMORY : CHIP_NO_ERROR;
+}
+
+void InterestIndex::Remove(uint8_t aHandlerIndex, const ClusterInfo * apAttributePathList)
+{
+    VerifyOrReturn(aHandlerIndex < kMaxHandlers);
+    HandlerMask handler = static_cast<HandlerMask>(1) << aHandlerIndex;
+    VerifyOrReturn((mRegistered & handler) != 0);
+    mRegistered &= ~handler;
+
+    if (mRegistered == 0)
+    {
+        // Also takes care of the removed entries and of the overflow.
+        Clear();
+        return;
+    }
+
+    for (const ClusterInfo * path = apAttributePathList; path != nullptr; path = path->mpNext)
+    {
+        if (IsWildcard(*path))
+        {
+            Erase(path->mEndpointId, path->mClusterId, 0, EntryType::kWildcard, handler);
+        }
+        else
+        {
+            Erase(path->mEndpointId, path->mClusterId, path->mFieldId, EntryType::kAttribute, handler);
+        }
+        Erase(path->mEndpointId, path->mClusterId, 0, EntryType::kCluster, handler);
+    }
+}
+
+InterestIndex::HandlerMask InterestIndex::GetInterestedHandlers(const ClusterInfo & aAttributePath) const
+{
+    if (mOverflowed)
+    {
+        return mRegistered;
+    }
+
+    if (IsWildcard(aAttributePath))
+    {
+        return Lookup(aAttributePath.mEndpointId, aAttributePath.mClusterId, 0, EntryType::kCluster);
+    }
+
+    return Lookup(aAttributePath.mEndpointId, aAttributePath.mClusterId, aAttributePath.mFieldId, EntryType::kAttribute) |
+        Lookup(aAttributePath.mEndpointId, aAttributePath.mClusterId, 0, EntryType::kWildcard);
+}
+
+uint8_t InterestIndex::GetFreeHandlerIndex() const
+{
+    for (uint8_t index = 0; index < kMaxHandlers; index++)
+    {
+        if ((mRegistered & (static_cast<HandlerMask>(1) << index)) == 0)
+        {
+            return index;
+        }
+    }
+    return kInvalidHandlerIndex;
+}
+
+void InterestIndex::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+    mRegistered = 0;
+    mOverflowed = false;
+}
+
+bool InterestIndex::IsWildcard(const ClusterInfo & aAttributePath)
+{
+    // A path without an attribute id only intersects other paths without one, or the ones on kRootAttributeId. Filing it as
+    // a wildcard keeps the lookups a superset of the exact matches.
+    return !aAttributePath.mFlags.Has(ClusterInfo::Flags::kFieldIdValid) || aAttributePath.mFieldId == kRootAttributeId;
+}
+
+size_t InterestIndex::Hash(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType)
+{
+    return IntegerHash(aClusterId, (static_cast<uint32_t>(aEndpointId) << 8) ^ static_cast<uint32_t>(aType) ^ aFieldId) % kSize;
+}
+
+size_t InterestIndex::Find(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType) const
+{
+    size_t slot = Hash(aEndpointId, aClusterId, aFieldId, aType);
+    for (size_t probe = 0; probe < kSize; probe++, slot = (slot + 1) % kSize)
+    {
+        const Entry & entry = mEntries[slot];
+        if (entry.mType == EntryType::kFree)
+        {
+            break;
+        }
+        if (entry.mType == aType && entry.mEndpointId == aEndpointId && entry.mClusterId == aClusterId &&
+            entry.mFieldId == aFieldId)
+        {
+            return slot;
+        }
+    }
+    return kSize;
+}
+
+CHIP_ERROR InterestIndex::Insert(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType,
+                                 HandlerMask aHandler)
+{
+    size_t slot = Find(aEndpointId, aClusterId, aFieldId, aType);
+    if (slot != kSize)
+    {
+        mEntries[slot].mHandlers |= aHandler;
+        return CHIP_NO_ERROR;
+    }
+
+    slot = Hash(aEndpointId, aClusterId, aFieldId, aType);
+    for (size_t probe = 0; probe < kSize; probe++, slot = (slot + 1) % kSize)
+    {
+        Entry & entry = mEntries[slot];
+        if (entry.mType == EntryType::kFree || entry.mType == EntryType::kRemoved)
+        {
+            entry.mEndpointId = aEndpointId;
+            entry.mClusterId  = aClusterId;
+            entry.mFieldId    = aFieldId;
+            entry.mType       = aType;
+            entry.mHandlers   = aHandler;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    ChipLogProgress(DataManagement, "Interest index is full, dirty paths are matched against every subscription");
+    return CHIP_ERROR_NO_MEMORY;
+}
+
+void InterestIndex::Erase(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType,
+                          HandlerMask aHandler)
+{
+    size_t slot = Find(aEndpointId, aClusterId, aFieldId, aType);
+    VerifyOrReturn(slot != kSize);
+
+    Entry & entry = mEntries[slot];
+    entry.mHandlers &= ~aHandler;
+    if (entry.mHandlers == 0)
+    {
+        // Keep the slot occupied so that the entries probed past it can still be found.
+        entry.mType = EntryType::kRemoved;
+    }
+}
+
+InterestIndex::HandlerMask InterestIndex::Lookup(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId,
+                                                 EntryType aType) const
+{
+    size_t slot = Find(aEndpointId, aClusterId, aFieldId, aType);
+    return (slot != kSize) ? mEntries[slot].mHandlers : 0;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
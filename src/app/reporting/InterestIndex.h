@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the index the reporting engine uses to find the subscriptions interested in a dirty attribute path.
+ *
+ */
+
+#pragma once
+
+#include <app/ClusterInfo.h>
+#include <app/util/basic-types.h>
+#include <lib/core/CHIPCore.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/*
+ *  @class InterestIndex
+ *
+ *  @brief Maps attribute paths to the read handlers that subscribed to them, so that a dirty path only needs to be
+ *         compared against the subscriptions that may actually be interested in it.
+ *
+ *         Every subscribed path is filed under its endpoint and cluster, both in the bucket of its attribute (or the wildcard
+ *         bucket when it covers every attribute of the cluster) and in the bucket of the whole cluster:
+ *
+ *           - a dirty path on one attribute is looked up in the bucket of that attribute and in the wildcard bucket,
+ *           - a dirty path covering the whole cluster is looked up in the cluster bucket.
+ *
+ *         The buckets live in a fixed-size open addressing table. The result of a lookup is a superset of the interested
+ *         handlers: list indices are not indexed, and once the table is full every registered handler is returned.
+ */
+class InterestIndex
+{
+public:
+    /**
+     * A set of read handlers, bit i standing for the read handler at index i of the InteractionModelEngine pool.
+     */
+    using HandlerMask = uint32_t;
+
+    static constexpr size_t kMaxHandlers = sizeof(HandlerMask) * 8;
+
+    /**
+     * Stands for a read handler that has no index, e.g. because all of them were taken when it subscribed.
+     */
+    static constexpr uint8_t kInvalidHandlerIndex = UINT8_MAX;
+
+    /**
+     * Files every path of apAttributePathList under aHandlerIndex.
+     *
+     * @retval #CHIP_NO_ERROR         On success.
+     * @retval #CHIP_ERROR_NO_MEMORY  The table is full. The handler is still registered, and lookups return every
+     *                                registered handler until all of them have been removed.
+     */
+    CHIP_ERROR Add(uint8_t aHandlerIndex, const ClusterInfo * apAttributePathList);
+
+    /**
+     * Removes aHandlerIndex from the buckets of every path of apAttributePathList, which must be the list it was added with.
+     */
+    void Remove(uint8_t aHandlerIndex, const ClusterInfo * apAttributePathList);
+
+    /**
+     * Returns the handlers that may have subscribed to a path intersecting aAttributePath.
+     */
+    HandlerMask GetInterestedHandlers(const ClusterInfo & aAttributePath) const;
+
+    /**
+     * Returns a handler index that has not been added, or kInvalidHandlerIndex when all of them have.
+     */
+    uint8_t GetFreeHandlerIndex() const;
+
+    bool IsOverflowed() const { return mOverflowed; }
+
+    void Clear();
+
+private:
+    enum class EntryType : uint8_t
+    {
+        kFree = 0,
+        kRemoved,
+        kAttribute,
+        kWildcard,
+        kCluster,
+    };
+
+    struct Entry
+    {
+        ClusterId mClusterId   = 0;
+        AttributeId mFieldId   = 0;
+        HandlerMask mHandlers  = 0;
+        EndpointId mEndpointId = 0;
+        EntryType mType        = EntryType::kFree;
+    };
+
+    static constexpr size_t kSize = CHIP_IM_SERVER_INTEREST_INDEX_SIZE;
+
+    static bool IsWildcard(const ClusterInfo & aAttributePath);
+    static size_t Hash(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType);
+
+    size_t Find(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType) const;
+    CHIP_ERROR Insert(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType, HandlerMask aHandler);
+    void Erase(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType, HandlerMask aHandler);
+    HandlerMask Lookup(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId, EntryType aType) const;
+
+    Entry mEntries[kSize];
+    HandlerMask mRegistered = 0;
+    bool mOverflowed        = false;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -56,6 +56,8 @@ static TransportMgr<Transport::UDP> gTransportManager;
 static secure_channel::MessageCounterManager gMessageCounterManager;
 static FabricIndex gFabricIndex = 0;
 static bool isCommandDispatched = false;
+static uint8_t gResponseCommandIndices[4];
+static uint8_t gResponseCommandCount = 0;
 
 namespace {
 constexpr EndpointId kTestEndpointId = 1;
@@ -89,7 +91,12 @@ void DispatchSingleClusterResponseCommand(chip::ClusterId aClusterId, chip::Comm
 {
     ChipLogDetail(Controller, "Received Cluster Command: Cluster=%" PRIx32 " Command=%" PRIx32 " Endpoint=%" PRIx16, aClusterId,
                   aCommandId, aEndPointId);
-    // Nothing todo.
+
+    if (chip::gResponseCommandCount < ArraySize(chip::gResponseCommandIndices))
+    {
+        chip::gResponseCommandIndices[chip::gResponseCommandCount] = apCommandObj->GetCurrentCommandIndex();
+    }
+    chip::gResponseCommandCount++;
 }
 
 bool ServerClusterCommandExists(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId)
@@ -106,6 +113,7 @@ public:
     static void TestCommandSenderWithSendCommand(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendEmptyCommand(nlTestSuite * apSuite, void * apContext);
     static void TestCommandSenderWithProcessReceivedMsg(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderWithBatchedCommands(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithProcessReceivedNotExistCommand(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendSimpleCommandData(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithSendSimpleStatusCode(nlTestSuite * apSuite, void * apContext);
@@ -116,7 +124,8 @@ public:
 private:
     static void GenerateReceivedCommand(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
                                         bool aNeedCommandData, EndpointId aEndpointId = kTestEndpointId,
-                                        ClusterId aClusterId = kTestClusterId, CommandId aCommandId = kTestCommandId);
+                                        ClusterId aClusterId = kTestClusterId, CommandId aCommandId = kTestCommandId,
+                                        uint8_t aCommandCount = 1);
     static void AddCommandDataElement(nlTestSuite * apSuite, void * apContext, Command * apCommand, bool aNeedStatusCode);
     static void ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode);
 };
@@ -134,7 +143,7 @@ class TestExchangeDelegate : public Messaging::ExchangeDelegate
 
 void TestCommandInteraction::GenerateReceivedCommand(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
                                                      bool aNeedCommandData, EndpointId aEndpointId, ClusterId aClusterId,
-                                                     CommandId aCommandId)
+                                                     CommandId aCommandId, uint8_t aCommandCount)
 
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -148,31 +157,34 @@ void TestCommandInteraction::GenerateReceivedCommand(nlTestSuite * apSuite, void
     CommandList::Builder commandList = invokeCommandBuilder.CreateCommandListBuilder();
     NL_TEST_ASSERT(apSuite, invokeCommandBuilder.GetError() == CHIP_NO_ERROR);
 
-    CommandDataElement::Builder commandDataElementBuilder = commandList.CreateCommandDataElementBuilder();
-    NL_TEST_ASSERT(apSuite, commandList.GetError() == CHIP_NO_ERROR);
-    CommandPath::Builder commandPathBuilder = commandDataElementBuilder.CreateCommandPathBuilder();
-    NL_TEST_ASSERT(apSuite, commandDataElementBuilder.GetError() == CHIP_NO_ERROR);
-    commandPathBuilder.EndpointId(aEndpointId).ClusterId(aClusterId).CommandId(aCommandId).EndOfCommandPath();
-    NL_TEST_ASSERT(apSuite, commandPathBuilder.GetError() == CHIP_NO_ERROR);
-
-    if (aNeedCommandData)
+    for (uint8_t i = 0; i < aCommandCount; i++)
     {
-        chip::TLV::TLVWriter * pWriter = commandDataElementBuilder.GetWriter();
-        chip::TLV::TLVType dummyType   = chip::TLV::kTLVType_NotSpecified;
-        err = pWriter->StartContainer(chip::TLV::ContextTag(CommandDataElement::kCsTag_Data), chip::TLV::kTLVType_Structure,
-                                      dummyType);
-        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
-
-        err = pWriter->PutBoolean(chip::TLV::ContextTag(1), true);
-        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
-
-        err = pWriter->EndContainer(dummyType);
-        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        CommandDataElement::Builder commandDataElementBuilder = commandList.CreateCommandDataElementBuilder();
+        NL_TEST_ASSERT(apSuite, commandList.GetError() == CHIP_NO_ERROR);
+        CommandPath::Builder commandPathBuilder = commandDataElementBuilder.CreateCommandPathBuilder();
+        NL_TEST_ASSERT(apSuite, commandDataElementBuilder.GetError() == CHIP_NO_ERROR);
+        commandPathBuilder.EndpointId(aEndpointId).ClusterId(aClusterId).CommandId(aCommandId).EndOfCommandPath();
+        NL_TEST_ASSERT(apSuite, commandPathBuilder.GetError() == CHIP_NO_ERROR);
+
+        if (aNeedCommandData)
+        {
+            chip::TLV::TLVWriter * pWriter = commandDataElementBuilder.GetWriter();
+            chip::TLV::TLVType dummyType   = chip::TLV::kTLVType_NotSpecified;
+            err = pWriter->StartContainer(chip::TLV::ContextTag(CommandDataElement::kCsTag_Data), chip::TLV::kTLVType_Structure,
+                                          dummyType);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+            err = pWriter->PutBoolean(chip::TLV::ContextTag(1), true);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+            err = pWriter->EndContainer(dummyType);
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        }
+
+        commandDataElementBuilder.EndOfCommandDataElement();
+        NL_TEST_ASSERT(apSuite, commandDataElementBuilder.GetError() == CHIP_NO_ERROR);
     }
 
-    commandDataElementBuilder.EndOfCommandDataElement();
-    NL_TEST_ASSERT(apSuite, commandDataElementBuilder.GetError() == CHIP_NO_ERROR);
-
     commandList.EndOfCommandList();
     NL_TEST_ASSERT(apSuite, commandList.GetError() == CHIP_NO_ERROR);
 
@@ -322,6 +334,38 @@ void TestCommandInteraction::TestCommandSenderWithProcessReceivedMsg(nlTestSuite
     commandSender.Shutdown();
 }
 
+void TestCommandInteraction::TestCommandSenderWithBatchedCommands(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    app::CommandSender commandSender;
+
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    err                            = commandSender.Init(&gExchangeManager, nullptr);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        AddCommandDataElement(apSuite, apContext, &commandSender, false);
+        NL_TEST_ASSERT(apSuite, commandSender.GetCommandCount() == i + 1);
+    }
+
+    // The response answers each command of the request with one command data element, in order.
+    gResponseCommandCount = 0;
+    GenerateReceivedCommand(apSuite, apContext, buf, true /*aNeedCommandData*/, kTestEndpointId, kTestClusterId, kTestCommandId,
+                            3 /* aCommandCount */);
+    err = commandSender.ProcessCommandMessage(std::move(buf), Command::CommandRoleId::SenderId);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, gResponseCommandCount == 3);
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        NL_TEST_ASSERT(apSuite, gResponseCommandIndices[i] == i);
+    }
+
+    commandSender.Shutdown();
+    NL_TEST_ASSERT(apSuite, commandSender.GetCommandCount() == 0);
+}
+
 void TestCommandInteraction::ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -446,6 +490,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandSenderWithSendCommand", chip::app::TestCommandInteraction::TestCommandSenderWithSendCommand),
     NL_TEST_DEF("TestCommandHandlerWithSendEmptyCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithSendEmptyCommand),
     NL_TEST_DEF("TestCommandSenderWithProcessReceivedMsg", chip::app::TestCommandInteraction::TestCommandSenderWithProcessReceivedMsg),
+    NL_TEST_DEF("TestCommandSenderWithBatchedCommands", chip::app::TestCommandInteraction::TestCommandSenderWithBatchedCommands),
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleCommandData", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleCommandData),
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleStatusCode", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleStatusCode),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedMsg),
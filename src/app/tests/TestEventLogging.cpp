@@ -288,12 +288,70 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+static void CheckFetchEventsWithUnmatchedPaths(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid;
+    chip::app::EventSchema schema = { kTestDeviceNodeId1, kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent,
+                                      chip::app::PriorityLevel::Info };
+    chip::app::EventOptions options;
+    TestEventGenerator testEventGenerator;
+    chip::TLV::TLVWriter writer;
+    uint8_t backingStore[1024];
+
+    options.mpEventSchema                = &schema;
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    testEventGenerator.SetStatus(0);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Same cluster but another event: the buffers have to be scanned, nothing is copied out.
+    chip::app::ClusterInfo scannedClusterInfo;
+    scannedClusterInfo.mNodeId     = kTestDeviceNodeId1;
+    scannedClusterInfo.mEndpointId = kTestEndpointId;
+    scannedClusterInfo.mClusterId  = kLivenessClusterId;
+    scannedClusterInfo.mEventId    = kLivenessChangeEvent + 1;
+    // No event was ever logged on this endpoint: the buffers are skipped.
+    chip::app::ClusterInfo skippedClusterInfo;
+    skippedClusterInfo.mNodeId     = kTestDeviceNodeId1;
+    skippedClusterInfo.mEndpointId = kTestEndpointId + 1;
+    skippedClusterInfo.mClusterId  = kLivenessClusterId;
+    skippedClusterInfo.mEventId    = kLivenessChangeEvent;
+
+    size_t scannedEventCount             = 0;
+    chip::EventNumber scannedEventNumber = 0;
+    writer.Init(backingStore, sizeof(backingStore));
+    err = logMgmt.FetchEventsSince(writer, &scannedClusterInfo, chip::app::PriorityLevel::Info, scannedEventNumber,
+                                   scannedEventCount);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, scannedEventCount == 0 && writer.GetLengthWritten() == 0);
+
+    size_t skippedEventCount             = 0;
+    chip::EventNumber skippedEventNumber = 0;
+    writer.Init(backingStore, sizeof(backingStore));
+    err = logMgmt.FetchEventsSince(writer, &skippedClusterInfo, chip::app::PriorityLevel::Info, skippedEventNumber,
+                                   skippedEventCount);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, skippedEventCount == 0 && writer.GetLengthWritten() == 0);
+    NL_TEST_ASSERT(apSuite, skippedEventNumber == scannedEventNumber);
+
+    // The latest event is still found once its path is asked for.
+    chip::app::ClusterInfo testClusterInfo;
+    testClusterInfo.mNodeId     = kTestDeviceNodeId1;
+    testClusterInfo.mEndpointId = kTestEndpointId;
+    testClusterInfo.mClusterId  = kLivenessClusterId;
+    testClusterInfo.mEventId    = kLivenessChangeEvent;
+    CheckLogReadOut(apSuite, logMgmt, chip::app::PriorityLevel::Info, eid, 1, &testClusterInfo);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("CheckFetchEventsWithUnmatchedPaths", CheckFetchEventsWithUnmatchedPaths),
+                          NL_TEST_SENTINEL() };
 } // namespace
 
 int TestEventLogging()
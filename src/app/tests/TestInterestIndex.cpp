@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the reporting engine InterestIndex
+ *
+ */
+
+#include <app/reporting/InterestIndex.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+namespace chip {
+namespace app {
+namespace TestInterestIndex {
+using reporting::InterestIndex;
+
+constexpr EndpointId kTestEndpointId = 1;
+constexpr ClusterId kTestClusterId   = 6;
+
+ClusterInfo MakePath(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aFieldId)
+{
+    ClusterInfo path;
+    path.mEndpointId = aEndpointId;
+    path.mClusterId  = aClusterId;
+    path.mFieldId    = aFieldId;
+    path.mFlags.Set(ClusterInfo::Flags::kFieldIdValid);
+    return path;
+}
+
+InterestIndex::HandlerMask Handler(uint8_t aHandlerIndex)
+{
+    return static_cast<InterestIndex::HandlerMask>(1) << aHandlerIndex;
+}
+
+void TestAttributePaths(nlTestSuite * apSuite, void * apContext)
+{
+    InterestIndex index;
+    ClusterInfo paths0[] = { MakePath(kTestEndpointId, kTestClusterId, 1), MakePath(kTestEndpointId, kTestClusterId, 2) };
+    ClusterInfo paths1[] = { MakePath(kTestEndpointId, kTestClusterId, 2) };
+    paths0[0].mpNext     = &paths0[1];
+
+    NL_TEST_ASSERT(apSuite, index.Add(0, paths0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, index.Add(1, paths1) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 1)) == Handler(0));
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 2)) == (Handler(0) | Handler(1)));
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 3)) == 0);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId + 1, kTestClusterId, 1)) == 0);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId + 1, 1)) == 0);
+
+    // A dirty path covering the whole cluster concerns every subscription to the cluster.
+    NL_TEST_ASSERT(apSuite,
+                   index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, kRootAttributeId)) ==
+                       (Handler(0) | Handler(1)));
+
+    index.Remove(0, paths0);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 1)) == 0);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 2)) == Handler(1));
+    NL_TEST_ASSERT(apSuite,
+                   index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, kRootAttributeId)) == Handler(1));
+
+    index.Remove(1, paths1);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 2)) == 0);
+}
+
+void TestWildcardPaths(nlTestSuite * apSuite, void * apContext)
+{
+    InterestIndex index;
+    ClusterInfo paths0[] = { MakePath(kTestEndpointId, kTestClusterId, kRootAttributeId) };
+    ClusterInfo paths1[] = { MakePath(kTestEndpointId, kTestClusterId, 1) };
+    // A path without an attribute id is filed as a wildcard.
+    ClusterInfo paths2[] = { MakePath(kTestEndpointId, kTestClusterId + 1, 0) };
+    paths2[0].mFlags.Clear(ClusterInfo::Flags::kFieldIdValid);
+
+    NL_TEST_ASSERT(apSuite, index.Add(0, paths0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, index.Add(1, paths1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, index.Add(2, paths2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, index.GetFreeHandlerIndex() == 3);
+
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 1)) == (Handler(0) | Handler(1)));
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 5)) == Handler(0));
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId + 1, 5)) == Handler(2));
+
+    index.Remove(0, paths0);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 5)) == 0);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, 1)) == Handler(1));
+    NL_TEST_ASSERT(apSuite, index.GetFreeHandlerIndex() == 0);
+}
+
+void TestManySubscriptions(nlTestSuite * apSuite, void * apContext)
+{
+    // Every handler subscribes to one attribute of its own and to one shared attribute, which takes three entries per handler
+    // plus the shared ones.
+    constexpr uint8_t kNumHandlers = static_cast<uint8_t>(CHIP_IM_SERVER_INTEREST_INDEX_SIZE / 4);
+    InterestIndex index;
+    ClusterInfo paths[kNumHandlers][2];
+
+    for (uint8_t i = 0; i < kNumHandlers; i++)
+    {
+        paths[i][0]        = MakePath(kTestEndpointId, kTestClusterId, static_cast<AttributeId>(100 + i));
+        paths[i][1]        = MakePath(kTestEndpointId, kTestClusterId, 1);
+        paths[i][0].mpNext = &paths[i][1];
+        NL_TEST_ASSERT(apSuite, index.Add(i, paths[i]) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, !index.IsOverflowed());
+
+    for (uint8_t i = 0; i < kNumHandlers; i++)
+    {
+        NL_TEST_ASSERT(apSuite,
+                       index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, static_cast<AttributeId>(100 + i))) ==
+                           Handler(i));
+    }
+
+    // Removing handlers leaves removed entries behind, the remaining ones must still be found past them.
+    for (uint8_t i = 0; i < kNumHandlers; i += 2)
+    {
+        index.Remove(i, paths[i]);
+    }
+    for (uint8_t i = 0; i < kNumHandlers; i++)
+    {
+        InterestIndex::HandlerMask expected = (i % 2 == 0) ? 0 : Handler(i);
+        NL_TEST_ASSERT(apSuite,
+                       index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId, static_cast<AttributeId>(100 + i))) ==
+                           expected);
+    }
+}
+
+void TestOverflow(nlTestSuite * apSuite, void * apContext)
+{
+    InterestIndex index;
+    ClusterInfo paths0[CHIP_IM_SERVER_INTEREST_INDEX_SIZE];
+    ClusterInfo paths1[] = { MakePath(kTestEndpointId, kTestClusterId + 1, 1) };
+
+    NL_TEST_ASSERT(apSuite, index.Add(1, paths1) == CHIP_NO_ERROR);
+
+    // Every path takes an attribute entry, so this list cannot fit.
+    for (size_t i = 0; i < CHIP_IM_SERVER_INTEREST_INDEX_SIZE; i++)
+    {
+        paths0[i] = MakePath(kTestEndpointId, kTestClusterId, static_cast<AttributeId>(i));
+        if (i > 0)
+        {
+            paths0[i - 1].mpNext = &paths0[i];
+        }
+    }
+    NL_TEST_ASSERT(apSuite, index.Add(0, paths0) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(apSuite, index.IsOverflowed());
+
+    // Once overflowed, every registered handler may be interested.
+    NL_TEST_ASSERT(apSuite,
+                   index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId + 2, 1)) == (Handler(0) | Handler(1)));
+
+    index.Remove(0, paths0);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId + 2, 1)) == Handler(1));
+
+    // The index starts over once every handler has been removed.
+    index.Remove(1, paths1);
+    NL_TEST_ASSERT(apSuite, !index.IsOverflowed());
+    NL_TEST_ASSERT(apSuite, index.Add(1, paths1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId + 1, 1)) == Handler(1));
+    NL_TEST_ASSERT(apSuite, index.GetInterestedHandlers(MakePath(kTestEndpointId, kTestClusterId + 2, 1)) == 0);
+}
+} // namespace TestInterestIndex
+} // namespace app
+} // namespace chip
+
+namespace {
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestAttributePaths", chip::app::TestInterestIndex::TestAttributePaths),
+    NL_TEST_DEF("TestWildcardPaths", chip::app::TestInterestIndex::TestWildcardPaths),
+    NL_TEST_DEF("TestManySubscriptions", chip::app::TestInterestIndex::TestManySubscriptions),
+    NL_TEST_DEF("TestOverflow", chip::app::TestInterestIndex::TestOverflow),
+    NL_TEST_SENTINEL()
+};
+}
+
+int TestInterestIndex()
+{
+    nlTestSuite theSuite = { "InterestIndex", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestInterestIndex)
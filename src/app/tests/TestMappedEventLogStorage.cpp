@@ -0,0 +1,192 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the event log backed by a memory-mapped file
+ *
+ */
+
+#include <app/EventManagement.h>
+#include <app/MappedEventLogStorage.h>
+#include <lib/core/CHIPTLVUtilities.hpp>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+constexpr NodeId kTestNodeId         = 0x18B4300000000001ULL;
+constexpr EndpointId kTestEndpointId = 2;
+constexpr ClusterId kTestClusterId   = 0x00000022;
+constexpr EventId kTestEventId       = 1;
+constexpr uint32_t kBufferSize       = 512;
+
+CircularEventBuffer gCircularEventBuffer[1];
+
+class TestEventGenerator : public EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override { return aWriter.Put(TLV::ContextTag(1), mStatus); }
+
+    void SetStatus(int32_t aStatus) { mStatus = aStatus; }
+
+private:
+    int32_t mStatus = 0;
+};
+
+class TemporaryFile
+{
+public:
+    TemporaryFile()
+    {
+        int fd = mkstemp(mPath);
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+    ~TemporaryFile() { unlink(mPath); }
+
+    const char * GetPath() const { return mPath; }
+
+private:
+    char mPath[32] = "/tmp/chip-event-log-XXXXXX";
+};
+
+void StartEventLogging(MappedEventLogStorage & aStorage)
+{
+    LogStorageResources logStorageResources[1];
+    logStorageResources[0].mpBuffer     = aStorage.GetBuffer();
+    logStorageResources[0].mBufferSize  = aStorage.GetBufferSize();
+    logStorageResources[0].mpStateStore = &aStorage;
+    logStorageResources[0].mPriority    = PriorityLevel::Info;
+
+    EventManagement::CreateEventManagement(nullptr, ArraySize(logStorageResources), gCircularEventBuffer, logStorageResources);
+}
+
+CHIP_ERROR LogTestEvent(EventNumber & aEventNumber)
+{
+    EventSchema schema = { kTestNodeId, kTestEndpointId, kTestClusterId, kTestEventId, PriorityLevel::Info };
+    EventOptions options;
+    TestEventGenerator generator;
+
+    options.mpEventSchema = &schema;
+    return EventManagement::GetInstance().LogEvent(&generator, options, aEventNumber);
+}
+
+size_t CountStoredEvents()
+{
+    ClusterInfo path;
+    path.mNodeId     = kTestNodeId;
+    path.mEndpointId = kTestEndpointId;
+    path.mClusterId  = kTestClusterId;
+    path.mEventId    = kTestEventId;
+
+    uint8_t backingStore[1024];
+    TLV::TLVWriter writer;
+    EventNumber eventNumber = 0;
+    size_t eventCount       = 0;
+
+    writer.Init(backingStore, sizeof(backingStore));
+    EventManagement::GetInstance().FetchEventsSince(writer, &path, PriorityLevel::Info, eventNumber, eventCount);
+    return eventCount;
+}
+
+void TestEventsSurviveRestart(nlTestSuite * apSuite, void * apContext)
+{
+    TemporaryFile file;
+    MappedEventLogStorage storage;
+    EventNumber eventNumbers[4];
+
+    NL_TEST_ASSERT(apSuite, storage.Open(file.GetPath(), kBufferSize) == CHIP_NO_ERROR);
+    StartEventLogging(storage);
+    for (size_t i = 0; i < 3; i++)
+    {
+        NL_TEST_ASSERT(apSuite, LogTestEvent(eventNumbers[i]) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, CountStoredEvents() == 3);
+    EventManagement::DestroyEventManagement();
+    storage.Close();
+
+    // The events are picked up from the file, and the event numbers carry on.
+    NL_TEST_ASSERT(apSuite, storage.Open(file.GetPath(), kBufferSize) == CHIP_NO_ERROR);
+    StartEventLogging(storage);
+    NL_TEST_ASSERT(apSuite, CountStoredEvents() == 3);
+    NL_TEST_ASSERT(apSuite, EventManagement::GetInstance().GetLastEventNumber(PriorityLevel::Info) == eventNumbers[2]);
+    NL_TEST_ASSERT(apSuite, LogTestEvent(eventNumbers[3]) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventNumbers[3] == eventNumbers[2] + 1);
+    NL_TEST_ASSERT(apSuite, CountStoredEvents() == 4);
+    EventManagement::DestroyEventManagement();
+    storage.Close();
+}
+
+void TestDamagedLogStartsOver(nlTestSuite * apSuite, void * apContext)
+{
+    TemporaryFile file;
+    MappedEventLogStorage storage;
+    EventNumber eventNumber;
+
+    NL_TEST_ASSERT(apSuite, storage.Open(file.GetPath(), kBufferSize) == CHIP_NO_ERROR);
+    StartEventLogging(storage);
+    NL_TEST_ASSERT(apSuite, LogTestEvent(eventNumber) == CHIP_NO_ERROR);
+    EventManagement::DestroyEventManagement();
+
+    // Events that do not parse anymore are dropped rather than reported.
+    memset(storage.GetBuffer(), 0xFF, storage.GetBufferSize());
+    storage.Close();
+
+    NL_TEST_ASSERT(apSuite, storage.Open(file.GetPath(), kBufferSize) == CHIP_NO_ERROR);
+    StartEventLogging(storage);
+    NL_TEST_ASSERT(apSuite, CountStoredEvents() == 0);
+    NL_TEST_ASSERT(apSuite, LogTestEvent(eventNumber) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, CountStoredEvents() == 1);
+    EventManagement::DestroyEventManagement();
+    storage.Close();
+
+    // So is a log of another size.
+    NL_TEST_ASSERT(apSuite, storage.Open(file.GetPath(), kBufferSize * 2) == CHIP_NO_ERROR);
+    StartEventLogging(storage);
+    NL_TEST_ASSERT(apSuite, CountStoredEvents() == 0);
+    EventManagement::DestroyEventManagement();
+    storage.Close();
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestEventsSurviveRestart", TestEventsSurviveRestart),
+                          NL_TEST_DEF("TestDamagedLogStartsOver", TestDamagedLogStartsOver), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestMappedEventLogStorage()
+{
+    nlTestSuite theSuite = { "MappedEventLogStorage", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMappedEventLogStorage)
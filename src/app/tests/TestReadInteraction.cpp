@@ -66,6 +66,19 @@ uint64_t kTestEventTag                = 1;
 using TestContext                     = chip::Test::MessagingContext;
 TestContext sContext;
 
+// Reading this attribute returns kTestLargeValueLength bytes, so that a few of them do not fit in one ReportData.
+constexpr chip::AttributeId kTestLargeFieldId = 5;
+constexpr size_t kTestLargeValueLength        = 300;
+constexpr size_t kTestChunkedPathCount        = 4;
+
+// Reading this attribute returns more data than fits in any ReportData.
+constexpr chip::AttributeId kTestOversizedFieldId = 6;
+constexpr size_t kTestOversizedValueLength        = 2048;
+
+// The data version of the test cluster, as seen by IsClusterDataVersionEqual.
+constexpr chip::DataVersion kTestDataVersion1 = 3;
+constexpr chip::DataVersion kTestDataVersion2 = 5;
+
 void InitializeEventLogging(chip::Messaging::ExchangeManager & aExchangeManager)
 {
     chip::app::LogStorageResources logStorageResources[] = {
@@ -152,7 +165,8 @@ public:
     {
         CHIP_ERROR err = CHIP_NO_ERROR;
         chip::TLV::TLVReader reader;
-        int numDataElementIndex = 0;
+        int numDataElementIndex   = 0;
+        uint8_t lastPriorityLevel = static_cast<uint8_t>(chip::app::PriorityLevel::Critical);
         reader.Init(*apEventListReader);
         while (CHIP_NO_ERROR == (err = reader.Next()))
         {
@@ -160,16 +174,15 @@ public:
             chip::app::EventDataElement::Parser event;
             ReturnErrorOnFailure(event.Init(reader));
             ReturnErrorOnFailure(event.GetPriorityLevel(&priorityLevel));
+            // A new read handler starts from the oldest event in the log, so events of earlier tests may come first; only
+            // check that the most urgent events are sent first.
             if (numDataElementIndex == 0)
             {
                 VerifyOrReturnError(priorityLevel == static_cast<uint8_t>(chip::app::PriorityLevel::Critical),
                                     CHIP_ERROR_INCORRECT_STATE);
             }
-            else if (numDataElementIndex == 1)
-            {
-                VerifyOrReturnError(priorityLevel == static_cast<uint8_t>(chip::app::PriorityLevel::Info),
-                                    CHIP_ERROR_INCORRECT_STATE);
-            }
+            VerifyOrReturnError(priorityLevel <= lastPriorityLevel, CHIP_ERROR_INCORRECT_STATE);
+            lastPriorityLevel = priorityLevel;
             ++numDataElementIndex;
         }
         if (CHIP_END_OF_TLV == err)
@@ -187,6 +200,11 @@ public:
         {
             mNumAttributeResponse++;
         }
+        else
+        {
+            mNumAttributeStatus++;
+            mLastAttributeStatus = status;
+        }
     }
 
     CHIP_ERROR ReportProcessed(const chip::app::ReadClient * apReadClient) override
@@ -209,11 +227,13 @@ public:
         return CHIP_ERROR_NOT_IMPLEMENTED;
     }
 
-    bool mGotEventResponse                 = false;
-    int mNumAttributeResponse              = 0;
-    bool mGotReport                        = false;
-    bool mReadError                        = false;
-    chip::app::ReadHandler * mpReadHandler = nullptr;
+    bool mGotEventResponse                                         = false;
+    int mNumAttributeResponse                                      = 0;
+    int mNumAttributeStatus                                        = 0;
+    chip::Protocols::InteractionModel::Status mLastAttributeStatus = chip::Protocols::InteractionModel::Status::Success;
+    bool mGotReport                                                = false;
+    bool mReadError                                                = false;
+    chip::app::ReadHandler * mpReadHandler                         = nullptr;
 };
 } // namespace
 
@@ -241,10 +261,28 @@ CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * ap
                              chip::Protocols::InteractionModel::Status::UnsupportedAttribute);
     }
 
-    ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), kTestFieldValue1));
+    if (aClusterInfo.mFieldId == kTestLargeFieldId)
+    {
+        uint8_t largeValue[kTestLargeValueLength] = { 0 };
+        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), ByteSpan(largeValue)));
+    }
+    else if (aClusterInfo.mFieldId == kTestOversizedFieldId)
+    {
+        static uint8_t sOversizedValue[kTestOversizedValueLength] = { 0 };
+        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), ByteSpan(sOversizedValue)));
+    }
+    else
+    {
+        ReturnErrorOnFailure(apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_Data), kTestFieldValue1));
+    }
     return apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion), version);
 }
 
+bool IsClusterDataVersionEqual(EndpointId aEndpointId, ClusterId aClusterId, DataVersion aRequiredVersion)
+{
+    return aEndpointId == kTestEndpointId && aClusterId == kTestClusterId && aRequiredVersion == kTestDataVersion1;
+}
+
 class TestReadInteraction
 {
 public:
@@ -262,8 +300,16 @@ public:
     static void TestSubscribeRoundtrip(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeInvalidAttributePathRoundtrip(nlTestSuite * apSuite, void * apContext);
     static void TestReadInvalidAttributePathRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestReadChunking(nlTestSuite * apSuite, void * apContext);
+    static void TestReadDataVersionFilter(nlTestSuite * apSuite, void * apContext);
+    static void TestReadOversizedAttribute(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeChunking(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeChunkingDirtyDuringReport(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeManyHandlers(nlTestSuite * apSuite, void * apContext);
 
 private:
+    static void SetLargeAttributePaths(chip::app::AttributePathParams * apAttributePathParams);
+    static int RunUntilReported(MockInteractionModelApp & aDelegate);
     static void GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
                                    bool aNeedInvalidReport = false);
 };
@@ -714,6 +760,70 @@ void TestReadInteraction::TestReadRoundtrip(nlTestSuite * apSuite, void * apCont
     engine->Shutdown();
 }
 
+void TestReadInteraction::TestReadDataVersionFilter(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The client already has the current version of the cluster for the first path only.
+    chip::app::AttributePathParams attributePathParams[2];
+    attributePathParams[0].mNodeId      = chip::kTestDeviceNodeId;
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mFieldId     = 1;
+    attributePathParams[0].mDataVersion = kTestDataVersion1;
+    attributePathParams[0].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+    attributePathParams[0].mFlags.Set(chip::app::AttributePathParams::Flags::kDataVersionValid);
+
+    attributePathParams[1].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[1].mEndpointId = kTestEndpointId;
+    attributePathParams[1].mClusterId  = kTestClusterId;
+    attributePathParams[1].mFieldId    = 2;
+    attributePathParams[1].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+
+    {
+        ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+        readPrepareParams.mAttributePathParamsListSize = 2;
+        err = chip::app::InteractionModelEngine::GetInstance()->SendReadRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+
+    InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
+
+    // A stale version does not filter anything.
+    delegate.mGotReport                 = false;
+    delegate.mNumAttributeResponse      = 0;
+    attributePathParams[0].mDataVersion = kTestDataVersion2;
+    {
+        ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+        readPrepareParams.mAttributePathParamsListSize = 2;
+        err = chip::app::InteractionModelEngine::GetInstance()->SendReadRequest(readPrepareParams);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+
+    InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    engine->Shutdown();
+}
+
 void TestReadInteraction::TestReadInvalidAttributePathRoundtrip(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -755,6 +865,264 @@ void TestReadInteraction::TestReadInvalidAttributePathRoundtrip(nlTestSuite * ap
     engine->Shutdown();
 }
 
+void TestReadInteraction::SetLargeAttributePaths(chip::app::AttributePathParams * apAttributePathParams)
+{
+    for (size_t i = 0; i < kTestChunkedPathCount; i++)
+    {
+        apAttributePathParams[i].mNodeId     = chip::kTestDeviceNodeId;
+        apAttributePathParams[i].mEndpointId = kTestEndpointId;
+        apAttributePathParams[i].mClusterId  = kTestClusterId;
+        apAttributePathParams[i].mFieldId    = kTestLargeFieldId;
+        apAttributePathParams[i].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+    }
+}
+
+int TestReadInteraction::RunUntilReported(MockInteractionModelApp & aDelegate)
+{
+    // The loopback transport delivers synchronously, so every run sends one chunk and gets it acknowledged.
+    int numRuns = 0;
+    while (!aDelegate.mGotReport && !aDelegate.mReadError && numRuns < 10)
+    {
+        InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+        numRuns++;
+    }
+    return numRuns;
+}
+
+void TestReadInteraction::TestReadChunking(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[kTestChunkedPathCount];
+    SetLargeAttributePaths(attributePathParams);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = kTestChunkedPathCount;
+    err                                            = engine->SendReadRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The attribute data needs more than one ReportData.
+    NL_TEST_ASSERT(apSuite, RunUntilReported(delegate) > 1);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == static_cast<int>(kTestChunkedPathCount));
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    // By now we should have closed all exchanges and sent all pending acks, so
+    // there should be no queued-up things in the retransmit table.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestReadOversizedAttribute(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[2];
+    attributePathParams[0].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[0].mEndpointId = kTestEndpointId;
+    attributePathParams[0].mClusterId  = kTestClusterId;
+    attributePathParams[0].mFieldId    = kTestOversizedFieldId;
+    attributePathParams[0].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+
+    attributePathParams[1].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[1].mEndpointId = kTestEndpointId;
+    attributePathParams[1].mClusterId  = kTestClusterId;
+    attributePathParams[1].mFieldId    = 1;
+    attributePathParams[1].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 2;
+    err                                            = engine->SendReadRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The attribute that does not fit in any ReportData is reported with a status instead of being left out.
+    RunUntilReported(delegate);
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeStatus == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mLastAttributeStatus == chip::Protocols::InteractionModel::Status::ResourceExhausted);
+    // By now we should have closed all exchanges and sent all pending acks, so
+    // there should be no queued-up things in the retransmit table.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestSubscribeChunking(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[kTestChunkedPathCount];
+    SetLargeAttributePaths(attributePathParams);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = kTestChunkedPathCount;
+    readPrepareParams.mMinIntervalFloorSeconds     = 2;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 5;
+    err                                            = engine->SendSubscribeRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The subscription is only established once the last chunk of the priming report has been acknowledged.
+    NL_TEST_ASSERT(apSuite, RunUntilReported(delegate) > 1);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == static_cast<int>(kTestChunkedPathCount));
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler != nullptr);
+
+    // A report generated from the dirty set is chunked the same way.
+    chip::app::ClusterInfo dirtyPath;
+    dirtyPath.mClusterId  = kTestClusterId;
+    dirtyPath.mEndpointId = kTestEndpointId;
+    dirtyPath.mFlags.Set(chip::app::ClusterInfo::Flags::kFieldIdValid);
+    dirtyPath.mFieldId = kTestLargeFieldId;
+
+    if (delegate.mpReadHandler != nullptr)
+    {
+        delegate.mpReadHandler->mHoldReport = false;
+        delegate.mGotReport                 = false;
+        delegate.mNumAttributeResponse      = 0;
+        err                                 = engine->GetReportingEngine().SetDirty(dirtyPath);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, RunUntilReported(delegate) > 1);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == static_cast<int>(kTestChunkedPathCount));
+        NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+        NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->IsDirty());
+
+        // A path dirtied after the first chunk is merged into one that was already sent, so the subscription is reported
+        // again once the chunked report is complete.
+        delegate.mpReadHandler->mHoldReport = false;
+        delegate.mGotReport                 = false;
+        delegate.mNumAttributeResponse      = 0;
+        err                                 = engine->GetReportingEngine().SetDirty(dirtyPath);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        engine->GetReportingEngine().Run();
+        NL_TEST_ASSERT(apSuite, !delegate.mGotReport);
+        err = engine->GetReportingEngine().SetDirty(dirtyPath);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        RunUntilReported(delegate);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == static_cast<int>(kTestChunkedPathCount));
+        NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->IsDirty());
+
+        delegate.mpReadHandler->mHoldReport = false;
+        delegate.mGotReport                 = false;
+        delegate.mNumAttributeResponse      = 0;
+        NL_TEST_ASSERT(apSuite, RunUntilReported(delegate) > 1);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == static_cast<int>(kTestChunkedPathCount));
+        NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+        NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->IsDirty());
+    }
+
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestSubscribeChunkingDirtyDuringReport(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The large attribute, to get a chunked report, and a small one.
+    chip::app::AttributePathParams attributePathParams[kTestChunkedPathCount + 1];
+    SetLargeAttributePaths(attributePathParams);
+    attributePathParams[kTestChunkedPathCount].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[kTestChunkedPathCount].mEndpointId = kTestEndpointId;
+    attributePathParams[kTestChunkedPathCount].mClusterId  = kTestClusterId;
+    attributePathParams[kTestChunkedPathCount].mFieldId    = 1;
+    attributePathParams[kTestChunkedPathCount].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = kTestChunkedPathCount + 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 2;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 5;
+    err                                            = engine->SendSubscribeRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, RunUntilReported(delegate) > 1);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == static_cast<int>(kTestChunkedPathCount + 1));
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler != nullptr);
+
+    chip::app::ClusterInfo largePath;
+    largePath.mClusterId  = kTestClusterId;
+    largePath.mEndpointId = kTestEndpointId;
+    largePath.mFlags.Set(chip::app::ClusterInfo::Flags::kFieldIdValid);
+    largePath.mFieldId = kTestLargeFieldId;
+
+    chip::app::ClusterInfo smallPath = largePath;
+    smallPath.mFieldId               = 1;
+
+    if (delegate.mpReadHandler != nullptr)
+    {
+        // The small attribute changes while the report of the large one is being chunked.
+        delegate.mpReadHandler->mHoldReport = false;
+        delegate.mGotReport                 = false;
+        delegate.mNumAttributeResponse      = 0;
+        err                                 = engine->GetReportingEngine().SetDirty(largePath);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        engine->GetReportingEngine().Run();
+        NL_TEST_ASSERT(apSuite, !delegate.mGotReport);
+        err = engine->GetReportingEngine().SetDirty(smallPath);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        RunUntilReported(delegate);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse >= static_cast<int>(kTestChunkedPathCount));
+        NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->IsDirty());
+
+        // Only the path dirtied during the chunked report is reported again, the large one has not changed since.
+        delegate.mpReadHandler->mHoldReport = false;
+        delegate.mGotReport                 = false;
+        delegate.mNumAttributeResponse      = 0;
+        RunUntilReported(delegate);
+        NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
+        NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+        NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->IsDirty());
+    }
+
+    engine->Shutdown();
+}
+
 void TestReadInteraction::TestProcessSubscribeResponse(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err    = CHIP_NO_ERROR;
@@ -981,14 +1349,48 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
     NL_TEST_ASSERT(apSuite, delegate.mGotReport);
     NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
 
-    // Test empty report
+    // Nothing changed since the last report: past the min interval, nothing is sent
     delegate.mpReadHandler->mHoldReport = false;
     delegate.mGotReport                 = false;
     delegate.mNumAttributeResponse      = 0;
     engine->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, !delegate.mGotReport);
+
+    // An event none of the event paths of the subscription asked for does not make it reportable either
+    {
+        chip::EventNumber eid;
+        chip::app::EventSchema schema = { kTestNodeId, kTestEndpointId, kInvalidTestClusterId, kTestEventIdDebug,
+                                          chip::app::PriorityLevel::Info };
+        chip::app::EventOptions options;
+        TestEventGenerator testEventGenerator;
+        options.mpEventSchema = &schema;
+        testEventGenerator.SetStatus(0);
+        err = chip::app::EventManagement::GetInstance().LogEvent(&testEventGenerator, options, eid);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->IsReportable());
+    engine->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, !delegate.mGotReport);
+
+    // Events of a subscribed path make it reportable, until the report that picks them up
+    GenerateEvents(apSuite, apContext);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->IsReportable());
+    engine->GetReportingEngine().Run();
     NL_TEST_ASSERT(apSuite, delegate.mGotReport);
     NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
 
+    delegate.mpReadHandler->mHoldReport = false;
+    delegate.mGotReport                 = false;
+    engine->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, !delegate.mGotReport);
+
+    // Test empty report, sent to keep the subscription alive once the max interval is up
+    delegate.mpReadHandler->mMaxIntervalElapsed = true;
+    engine->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
+    NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->mMaxIntervalElapsed && delegate.mpReadHandler->mHoldReport);
+
     // Test multiple subscriptipn
     delegate.mNumAttributeResponse = 0;
     delegate.mGotReport            = false;
@@ -1072,12 +1474,97 @@ void TestReadInteraction::TestSubscribeInvalidAttributePathRoundtrip(nlTestSuite
     delegate.mNumAttributeResponse = 0;
     InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
     NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
-    delegate.mpReadHandler->mHoldReport = false;
+    delegate.mpReadHandler->mHoldReport         = false;
+    delegate.mpReadHandler->mMaxIntervalElapsed = true;
     InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
     NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
     engine->Shutdown();
 }
 
+void TestReadInteraction::TestSubscribeManyHandlers(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+#if CHIP_IM_SERVER_POOLS_USE_HEAP
+    // More subscriptions than the interest index has room for.
+    constexpr size_t kNumSubscriptions = 3 * reporting::InterestIndex::kMaxHandlers;
+#else
+    constexpr size_t kNumSubscriptions = CHIP_IM_MAX_NUM_READ_HANDLER;
+#endif // CHIP_IM_SERVER_POOLS_USE_HEAP
+
+    chip::app::InteractionModelDelegate delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ReadHandler * readHandlers[kNumSubscriptions];
+    for (size_t i = 0; i < kNumSubscriptions; i++)
+    {
+        System::PacketBufferTLVWriter writer;
+        System::PacketBufferHandle subscribeRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+        SubscribeRequest::Builder subscribeRequestBuilder;
+
+        writer.Init(std::move(subscribeRequestbuf));
+        err = subscribeRequestBuilder.Init(&writer);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        // Every other subscription is to field 1, the others to field 2.
+        AttributePathList::Builder attributePathListBuilder = subscribeRequestBuilder.CreateAttributePathListBuilder();
+        AttributePath::Builder attributePathBuilder         = attributePathListBuilder.CreateAttributePathBuilder();
+        attributePathBuilder.NodeId(kTestNodeId)
+            .EndpointId(kTestEndpointId)
+            .ClusterId(kTestClusterId)
+            .FieldId(static_cast<AttributeId>(i % 2 + 1))
+            .EndOfAttributePath();
+        attributePathListBuilder.EndOfAttributePathList();
+        subscribeRequestBuilder.MinIntervalSeconds(2).MaxIntervalSeconds(3).EndOfSubscribeRequest();
+        NL_TEST_ASSERT(apSuite, subscribeRequestBuilder.GetError() == CHIP_NO_ERROR);
+        err = writer.Finalize(&subscribeRequestbuf);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        readHandlers[i] = engine->mReadHandlers.CreateObject();
+        NL_TEST_ASSERT(apSuite, readHandlers[i] != nullptr);
+        if (readHandlers[i] == nullptr)
+        {
+            engine->Shutdown();
+            return;
+        }
+        err = readHandlers[i]->Init(&ctx.GetExchangeManager(), nullptr, nullptr, ReadHandler::InteractionType::Subscribe);
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = readHandlers[i]->ProcessSubscribeRequest(std::move(subscribeRequestbuf));
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, engine->mReadHandlers.Allocated() == kNumSubscriptions);
+
+    chip::app::ClusterInfo dirtyPath;
+    dirtyPath.mEndpointId = kTestEndpointId;
+    dirtyPath.mClusterId  = kTestClusterId;
+    dirtyPath.mFieldId    = 1;
+    dirtyPath.mFlags.Set(chip::app::ClusterInfo::Flags::kFieldIdValid);
+    err = engine->GetReportingEngine().SetDirty(dirtyPath);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Only the subscriptions to field 1 are dirty, whether or not they got a slot in the interest index.
+    size_t numUnindexed = 0;
+    for (size_t i = 0; i < kNumSubscriptions; i++)
+    {
+        NL_TEST_ASSERT(apSuite, readHandlers[i]->IsDirty() == (i % 2 == 0));
+        if (readHandlers[i]->GetInterestIndex() == reporting::InterestIndex::kInvalidHandlerIndex)
+        {
+            numUnindexed++;
+        }
+    }
+#if CHIP_IM_SERVER_POOLS_USE_HEAP
+    NL_TEST_ASSERT(apSuite, numUnindexed == kNumSubscriptions - reporting::InterestIndex::kMaxHandlers);
+#else
+    NL_TEST_ASSERT(apSuite, numUnindexed == 0);
+#endif // CHIP_IM_SERVER_POOLS_USE_HEAP
+
+    // Shutting the engine down hands every read handler back to the pool.
+    engine->Shutdown();
+    NL_TEST_ASSERT(apSuite, engine->mReadHandlers.Allocated() == 0);
+}
+
 } // namespace app
 } // namespace chip
 
@@ -1104,6 +1591,12 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestSubscribeRoundtrip", chip::app::TestReadInteraction::TestSubscribeRoundtrip),
     NL_TEST_DEF("TestSubscribeInvalidAttributePathRoundtrip", chip::app::TestReadInteraction::TestSubscribeInvalidAttributePathRoundtrip),
     NL_TEST_DEF("TestReadInvalidAttributePathRoundtrip", chip::app::TestReadInteraction::TestReadInvalidAttributePathRoundtrip),
+    NL_TEST_DEF("TestReadChunking", chip::app::TestReadInteraction::TestReadChunking),
+    NL_TEST_DEF("TestReadDataVersionFilter", chip::app::TestReadInteraction::TestReadDataVersionFilter),
+    NL_TEST_DEF("TestReadOversizedAttribute", chip::app::TestReadInteraction::TestReadOversizedAttribute),
+    NL_TEST_DEF("TestSubscribeChunking", chip::app::TestReadInteraction::TestSubscribeChunking),
+    NL_TEST_DEF("TestSubscribeChunkingDirtyDuringReport", chip::app::TestReadInteraction::TestSubscribeChunkingDirtyDuringReport),
+    NL_TEST_DEF("TestSubscribeManyHandlers", chip::app::TestReadInteraction::TestSubscribeManyHandlers),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -531,6 +531,11 @@ typedef struct
      * Meta-data about the endpoint
      */
     EmberAfEndpointBitmask bitmask;
+    /**
+     * Data versions of the clusters of this endpoint, indexed like endpointType->cluster. May be NULL, in which case the
+     * clusters of this endpoint report no data version.
+     */
+    chip::DataVersion * dataVersions;
 } EmberAfDefinedEndpoint;
 
 // Cluster specific types
@@ -42,6 +42,8 @@
 #include "app/util/common.h"
 #include <app/util/af.h>
 #include <app/util/attribute-storage.h>
+#include <lib/support/IntegerHash.h>
+#include <lib/support/RandUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 #include <app-common/zap-generated/attribute-type.h>
@@ -110,8 +112,202 @@ const uint16_t attributeManufacturerCodeCount                   = GENERATED_ATTR
 #define endpointNetworkIndex(x) fixedNetworks[x]
 #endif
 
+#if !defined(EMBER_SCRIPTED_TEST) && defined(GENERATED_CLUSTER_COUNT) && GENERATED_CLUSTER_COUNT > 0
+#define FIXED_DATA_VERSION_COUNT GENERATED_CLUSTER_COUNT
+#else
+#define FIXED_DATA_VERSION_COUNT 1
+#endif
+
 namespace {
 app::AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
+
+// Finds the AttributeAccessInterface registered for an endpoint and cluster, or for all the endpoints of a cluster, in a
+// single probe sequence. Overrides cannot overlap, so at most one of them matches a given endpoint and cluster.
+app::AttributeAccessInterface * gAttributeAccessOverrideTable[EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE];
+bool gAttributeAccessOverrideTableOverflowed = false;
+
+// Data versions of the clusters of the fixed endpoints.
+DataVersion fixedEndpointDataVersions[FIXED_DATA_VERSION_COUNT];
+
+// Data versions start at a random value so that a client holding versions from before a reboot does not mistake the new
+// contents of a cluster for the ones it has.
+void initDataVersions(DataVersion * dataVersions, uint8_t clusterCount)
+{
+    for (uint8_t i = 0; i < clusterCount; i++)
+    {
+        dataVersions[i] = GetRandU32();
+    }
+}
+
+// Maps an endpoint id to the index of the first entry of emAfEndpoints with that id. Twice as many slots as endpoints keep
+// the probe sequences short.
+constexpr uint16_t kEndpointIndexTableSize = 2 * MAX_ENDPOINT_COUNT;
+constexpr uint16_t kNoEndpointIndex        = 0xFFFF;
+uint16_t endpointIndexTable[kEndpointIndexTableSize];
+
+// Caches where the attributes that were looked up live, so that repeated reads and writes do not have to walk every
+// endpoint, cluster and attribute before them. A lookup only probes a few slots, a miss that finds them all taken evicts the
+// entry in its home slot. Cleared whenever the endpoints change.
+struct AttributeCacheEntry
+{
+    EmberAfCluster * cluster; // NULL for an empty entry
+    EmberAfAttributeMetadata * metadata;
+    AttributeId attributeId;
+    ClusterId clusterId;
+    uint16_t manufacturerCode;
+    uint16_t dataOffset;
+    EndpointId endpoint;
+    EmberAfClusterMask clusterMask;
+};
+constexpr uint16_t kAttributeCacheMaxProbes = 4;
+AttributeCacheEntry attributeCache[EMBER_AF_ATTRIBUTE_CACHE_SIZE];
+
+uint16_t hashAttributeRecord(const EmberAfAttributeSearchRecord * attRecord)
+{
+    uint32_t endpointAndAttribute =
+        (static_cast<uint32_t>(attRecord->endpoint) << 16) ^ attRecord->manufacturerCode ^ attRecord->attributeId;
+    uint32_t hash = IntegerHash(attRecord->clusterId, endpointAndAttribute);
+    return static_cast<uint16_t>((hash ^ attRecord->clusterMask) % EMBER_AF_ATTRIBUTE_CACHE_SIZE);
+}
+
+bool matchesAttributeRecord(const AttributeCacheEntry & entry, const EmberAfAttributeSearchRecord * attRecord)
+{
+    return entry.cluster != NULL && entry.endpoint == attRecord->endpoint && entry.clusterId == attRecord->clusterId &&
+        entry.attributeId == attRecord->attributeId && entry.manufacturerCode == attRecord->manufacturerCode &&
+        entry.clusterMask == attRecord->clusterMask;
+}
+
+// Caches the clusters found by emberAfFindClusterWithMfgCode, with the same eviction as attributeCache. Cleared whenever the
+// endpoints change.
+struct ClusterCacheEntry
+{
+    EmberAfCluster * cluster; // NULL for an empty entry
+    ClusterId clusterId;
+    uint16_t manufacturerCode;
+    EndpointId endpoint;
+    EmberAfClusterMask mask;
+};
+constexpr uint16_t kClusterCacheMaxProbes = 4;
+ClusterCacheEntry clusterCache[EMBER_AF_CLUSTER_CACHE_SIZE];
+
+uint16_t hashClusterKey(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask, uint16_t manufacturerCode)
+{
+    uint32_t hash = IntegerHash(clusterId, (static_cast<uint32_t>(endpoint) << 16) ^ manufacturerCode ^ mask);
+    return static_cast<uint16_t>(hash % EMBER_AF_CLUSTER_CACHE_SIZE);
+}
+
+void clearLookupCaches()
+{
+    for (auto & entry : attributeCache)
+    {
+        entry.cluster = NULL;
+    }
+    for (auto & entry : clusterCache)
+    {
+        entry.cluster = NULL;
+    }
+}
+
+uint16_t hashAttributeAccessOverrideKey(bool anyEndpoint, EndpointId endpoint, ClusterId clusterId)
+{
+    // Endpoint ids are offset by one so that endpoint 0 does not hash like all endpoints.
+    uint32_t hash = IntegerHash(clusterId, anyEndpoint ? 0 : static_cast<uint32_t>(endpoint) + 1);
+    return static_cast<uint16_t>(hash % EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE);
+}
+
+bool attributeAccessOverrideHasKey(const app::AttributeAccessInterface * attrOverride, bool anyEndpoint, EndpointId endpoint,
+                                   ClusterId clusterId)
+{
+    const Optional<EndpointId> & overrideEndpoint = attrOverride->GetEndpointId();
+    return attrOverride->GetClusterId() == clusterId && overrideEndpoint.HasValue() != anyEndpoint &&
+        (anyEndpoint || overrideEndpoint.Value() == endpoint);
+}
+
+bool insertAttributeAccessOverride(app::AttributeAccessInterface * attrOverride)
+{
+    const Optional<EndpointId> & endpoint = attrOverride->GetEndpointId();
+    uint16_t slot = hashAttributeAccessOverrideKey(!endpoint.HasValue(), endpoint.ValueOr(0), attrOverride->GetClusterId());
+    for (uint16_t probe = 0; probe < EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE; probe++)
+    {
+        if (gAttributeAccessOverrideTable[slot] == nullptr)
+        {
+            gAttributeAccessOverrideTable[slot] = attrOverride;
+            return true;
+        }
+        slot = static_cast<uint16_t>((slot + 1) % EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE);
+    }
+    return false;
+}
+
+app::AttributeAccessInterface * lookupAttributeAccessOverride(bool anyEndpoint, EndpointId endpoint, ClusterId clusterId)
+{
+    uint16_t slot = hashAttributeAccessOverrideKey(anyEndpoint, endpoint, clusterId);
+    for (uint16_t probe = 0; probe < EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE; probe++)
+    {
+        app::AttributeAccessInterface * cur = gAttributeAccessOverrideTable[slot];
+        if (cur == nullptr || attributeAccessOverrideHasKey(cur, anyEndpoint, endpoint, clusterId))
+        {
+            return cur;
+        }
+        slot = static_cast<uint16_t>((slot + 1) % EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE);
+    }
+    return nullptr;
+}
+
+// Overrides are only ever removed when an endpoint is disabled, rebuilding the table then keeps it free of removed entries.
+void rebuildAttributeAccessOverrideTable()
+{
+    for (auto & slot : gAttributeAccessOverrideTable)
+    {
+        slot = nullptr;
+    }
+    gAttributeAccessOverrideTableOverflowed = false;
+
+    for (auto * cur = gAttributeAccessOverrides; cur && !gAttributeAccessOverrideTableOverflowed; cur = cur->GetNext())
+    {
+        gAttributeAccessOverrideTableOverflowed = !insertAttributeAccessOverride(cur);
+    }
+}
+
+void rebuildEndpointIndex()
+{
+    for (auto & slot : endpointIndexTable)
+    {
+        slot = kNoEndpointIndex;
+    }
+
+    for (uint16_t epi = 0; epi < emberAfEndpointCount(); epi++)
+    {
+        EndpointId endpoint = emAfEndpoints[epi].endpoint;
+        uint16_t slot       = static_cast<uint16_t>(endpoint % kEndpointIndexTableSize);
+        while (endpointIndexTable[slot] != kNoEndpointIndex && emAfEndpoints[endpointIndexTable[slot]].endpoint != endpoint)
+        {
+            slot = static_cast<uint16_t>((slot + 1) % kEndpointIndexTableSize);
+        }
+        // Like the linear search it replaces, the index returns the first endpoint with a given id.
+        if (endpointIndexTable[slot] == kNoEndpointIndex)
+        {
+            endpointIndexTable[slot] = epi;
+        }
+    }
+
+    clearLookupCaches();
+}
+
+uint16_t lookupEndpointIndex(EndpointId endpoint)
+{
+    uint16_t slot = static_cast<uint16_t>(endpoint % kEndpointIndexTableSize);
+    for (uint16_t probe = 0; probe < kEndpointIndexTableSize; probe++)
+    {
+        uint16_t epi = endpointIndexTable[slot];
+        if (epi == kNoEndpointIndex || emAfEndpoints[epi].endpoint == endpoint)
+        {
+            return epi;
+        }
+        slot = static_cast<uint16_t>((slot + 1) % kEndpointIndexTableSize);
+    }
+    return kNoEndpointIndex;
+}
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -139,6 +335,8 @@ void emberAfEndpointConfigure(void)
     uint8_t fixedNetworks[]             = FIXED_NETWORKS;
 #endif
 
+    size_t dataVersionsUsed = 0;
+
     emberEndpointCount = FIXED_ENDPOINT_COUNT;
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
@@ -148,6 +346,16 @@ void emberAfEndpointConfigure(void)
         emAfEndpoints[ep].endpointType  = endpointTypeMacro(ep);
         emAfEndpoints[ep].networkIndex  = endpointNetworkIndex(ep);
         emAfEndpoints[ep].bitmask       = EMBER_AF_ENDPOINT_ENABLED;
+        emAfEndpoints[ep].dataVersions  = NULL;
+
+        // Endpoint types shared by several endpoints may make the clusters outnumber the generated ones.
+        uint8_t clusterCount = emAfEndpoints[ep].endpointType->clusterCount;
+        if (dataVersionsUsed + clusterCount <= FIXED_DATA_VERSION_COUNT)
+        {
+            emAfEndpoints[ep].dataVersions = &fixedEndpointDataVersions[dataVersionsUsed];
+            initDataVersions(emAfEndpoints[ep].dataVersions, clusterCount);
+            dataVersionsUsed += clusterCount;
+        }
     }
 
 #ifdef DYNAMIC_ENDPOINT_COUNT
@@ -159,11 +367,14 @@ void emberAfEndpointConfigure(void)
                sizeof(EmberAfDefinedEndpoint) * (MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT));
     }
 #endif
+
+    rebuildEndpointIndex();
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
 {
     emberEndpointCount = static_cast<uint16_t>(FIXED_ENDPOINT_COUNT + dynamicEndpointCount);
+    rebuildEndpointIndex();
 }
 
 uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
@@ -180,7 +391,7 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
 }
 
 EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, EmberAfEndpointType * ep, uint16_t deviceId,
-                                        uint8_t deviceVersion)
+                                        uint8_t deviceVersion, Span<DataVersion> dataVersionStorage)
 {
     auto realIndex = index + FIXED_ENDPOINT_COUNT;
 
@@ -203,9 +414,16 @@ EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, EmberAfEn
     emAfEndpoints[index].deviceVersion = deviceVersion;
     emAfEndpoints[index].endpointType  = ep;
     emAfEndpoints[index].networkIndex  = 0;
+    emAfEndpoints[index].dataVersions  = NULL;
+    if (dataVersionStorage.size() >= ep->clusterCount)
+    {
+        emAfEndpoints[index].dataVersions = dataVersionStorage.data();
+        initDataVersions(emAfEndpoints[index].dataVersions, ep->clusterCount);
+    }
     // Start the endpoint off as disabled.
     emAfEndpoints[index].bitmask = EMBER_AF_ENDPOINT_DISABLED;
 
+    // Also indexes the new endpoint.
     emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
 
     // Now enable the endpoint.
@@ -229,6 +447,7 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
             emberAfSetDeviceEnabled(ep, false);
             emberAfEndpointEnableDisable(ep, false);
             emAfEndpoints[index].endpoint = 0;
+            rebuildEndpointIndex();
         }
     }
 
@@ -594,22 +813,33 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
              (emAfGetManufacturerCodeForAttribute(cluster, am) == attRecord->manufacturerCode)));
 }
 
-// When reading non-string attributes, this function returns an error when destination
-// buffer isn't large enough to accommodate the attribute type.  For strings, the
-// function will copy at most readLength bytes.  This means the resulting string
-// may be truncated.  The length byte(s) in the resulting string will reflect
-// any truncation.  If readLength is zero, we are working with backwards-
-// compatibility wrapper functions and we just cross our fingers and hope for
-// the best.
-//
-// When writing attributes, readLength is ignored.  For non-string attributes,
-// this function assumes the source buffer is the same size as the attribute
-// type.  For strings, the function will copy as many bytes as will fit in the
-// attribute.  This means the resulting string may be truncated.  The length
-// byte(s) in the resulting string will reflect any truncated.
-EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
-                                       uint8_t * buffer, uint16_t readLength, bool write, int32_t index)
+// Finds the attribute matching attRecord, along with its cluster and the offset of its data in attributeData. The attributes
+// that were found before come from attributeCache, the other ones are searched for in every endpoint, cluster and
+// attribute before them.
+static bool findAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster ** foundCluster,
+                          EmberAfAttributeMetadata ** foundMetadata, uint16_t * dataOffset)
 {
+    uint16_t home      = hashAttributeRecord(attRecord);
+    uint16_t slot      = home;
+    bool foundFreeSlot = false;
+    for (uint16_t probe = 0; probe < kAttributeCacheMaxProbes; probe++)
+    {
+        uint16_t current                  = static_cast<uint16_t>((home + probe) % EMBER_AF_ATTRIBUTE_CACHE_SIZE);
+        const AttributeCacheEntry & entry = attributeCache[current];
+        if (matchesAttributeRecord(entry, attRecord))
+        {
+            *foundCluster  = entry.cluster;
+            *foundMetadata = entry.metadata;
+            *dataOffset    = entry.dataOffset;
+            return true;
+        }
+        if (entry.cluster == NULL && !foundFreeSlot)
+        {
+            slot          = current;
+            foundFreeSlot = true;
+        }
+    }
+
     uint8_t i;
     uint16_t attributeOffsetIndex = 0;
 
@@ -634,63 +864,28 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
                         EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
                         if (emAfMatchAttribute(cluster, am, attRecord))
                         { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != NULL)
-                            {
-                                *metadata = am;
-                            }
-
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                             am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == NULL)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                            am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-
-                                return (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE
-                                            ? (write) ? emberAfExternalAttributeWriteCallback(
-                                                            attRecord->endpoint, attRecord->clusterId, am,
-                                                            emAfGetManufacturerCodeForAttribute(cluster, am), buffer, index)
-                                                      : emberAfExternalAttributeReadCallback(
-                                                            attRecord->endpoint, attRecord->clusterId, am,
-                                                            emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
-                                                            emberAfAttributeSize(am), index)
-                                            : typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index));
-                            }
+                            // Takes the first free slot of the probe sequence, or evicts the entry in the home slot.
+                            AttributeCacheEntry & entry = attributeCache[slot];
+                            entry.cluster               = cluster;
+                            entry.metadata              = am;
+                            entry.attributeId           = attRecord->attributeId;
+                            entry.clusterId             = attRecord->clusterId;
+                            entry.manufacturerCode      = attRecord->manufacturerCode;
+                            entry.dataOffset            = attributeOffsetIndex;
+                            entry.endpoint              = attRecord->endpoint;
+                            entry.clusterMask           = attRecord->clusterMask;
+
+                            *foundCluster  = cluster;
+                            *foundMetadata = am;
+                            *dataOffset    = attributeOffsetIndex;
+                            return true;
                         }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
+
+                        // Not the attribute we are looking for
+                        // Increase the index if attribute is not externally stored
+                        if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                        {
+                            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
                         }
                     }
                 }
@@ -709,7 +904,76 @@ EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord,
             }
         }
     }
-    return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+    return false;
+}
+
+// When reading non-string attributes, this function returns an error when destination
+// buffer isn't large enough to accommodate the attribute type.  For strings, the
+// function will copy at most readLength bytes.  This means the resulting string
+// may be truncated.  The length byte(s) in the resulting string will reflect
+// any truncation.  If readLength is zero, we are working with backwards-
+// compatibility wrapper functions and we just cross our fingers and hope for
+// the best.
+//
+// When writing attributes, readLength is ignored.  For non-string attributes,
+// this function assumes the source buffer is the same size as the attribute
+// type.  For strings, the function will copy as many bytes as will fit in the
+// attribute.  This means the resulting string may be truncated.  The length
+// byte(s) in the resulting string will reflect any truncated.
+EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
+                                       uint8_t * buffer, uint16_t readLength, bool write, int32_t index)
+{
+    EmberAfCluster * cluster;
+    EmberAfAttributeMetadata * am;
+    uint16_t attributeOffsetIndex;
+
+    if (!findAttribute(attRecord, &cluster, &am, &attributeOffsetIndex))
+    {
+        return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+    }
+
+    // If passed metadata location is not null, populate
+    if (metadata != NULL)
+    {
+        *metadata = am;
+    }
+
+    uint8_t * attributeLocation =
+        (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am) : attributeData + attributeOffsetIndex);
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                 emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+    else
+    {
+        if (buffer == NULL)
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+
+    return (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE
+                ? (write) ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                  emAfGetManufacturerCodeForAttribute(cluster, am), buffer, index)
+                          : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                 emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
+                                                                 emberAfAttributeSize(am), index)
+                : typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index));
 }
 
 // Check if a cluster is implemented or not. If yes, the cluster is returned.
@@ -741,6 +1005,29 @@ EmberAfCluster * emberAfFindClusterInTypeWithMfgCode(EmberAfEndpointType * endpo
     return NULL;
 }
 
+DataVersion * emberAfDataVersionStorage(EndpointId endpoint, ClusterId clusterId)
+{
+    uint16_t index = emberAfIndexFromEndpoint(endpoint);
+    if (index == 0xFFFF)
+    {
+        return NULL;
+    }
+
+    EmberAfDefinedEndpoint * de = &(emAfEndpoints[index]);
+    if (de->dataVersions == NULL || de->endpointType == NULL)
+    {
+        return NULL;
+    }
+
+    EmberAfCluster * cluster = emberAfFindClusterInType(de->endpointType, clusterId, CLUSTER_MASK_SERVER);
+    if (cluster == NULL)
+    {
+        return NULL;
+    }
+
+    return &(de->dataVersions[cluster - de->endpointType->cluster]);
+}
+
 // This functions wraps emberAfFindClusterInTypeWithMfgCode with
 // a manufacturerCode of EMBER_AF_NULL_MANUFACTURER_CODE.
 EmberAfCluster * emberAfFindClusterInType(EmberAfEndpointType * endpointType, ClusterId clusterId, EmberAfClusterMask mask)
@@ -812,15 +1099,43 @@ bool emberAfContainsClient(EndpointId endpoint, ClusterId clusterId)
 EmberAfCluster * emberAfFindClusterWithMfgCode(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask,
                                                uint16_t manufacturerCode)
 {
+    uint16_t home = hashClusterKey(endpoint, clusterId, mask, manufacturerCode);
+    uint16_t slot = home;
+    for (uint16_t probe = 0; probe < kClusterCacheMaxProbes; probe++)
+    {
+        uint16_t current                = static_cast<uint16_t>((home + probe) % EMBER_AF_CLUSTER_CACHE_SIZE);
+        const ClusterCacheEntry & entry = clusterCache[current];
+        if (entry.cluster == NULL)
+        {
+            slot = current;
+            break;
+        }
+        if (entry.endpoint == endpoint && entry.clusterId == clusterId && entry.mask == mask &&
+            entry.manufacturerCode == manufacturerCode)
+        {
+            return entry.cluster;
+        }
+    }
+
     uint16_t ep = emberAfIndexFromEndpoint(endpoint);
     if (ep == 0xFFFF)
     {
         return NULL;
     }
-    else
+
+    EmberAfCluster * cluster =
+        emberAfFindClusterInTypeWithMfgCode(emAfEndpoints[ep].endpointType, clusterId, mask, manufacturerCode);
+    if (cluster != NULL)
     {
-        return emberAfFindClusterInTypeWithMfgCode(emAfEndpoints[ep].endpointType, clusterId, mask, manufacturerCode);
+        // Takes the first free slot of the probe sequence, or evicts the entry in the home slot.
+        ClusterCacheEntry & entry = clusterCache[slot];
+        entry.cluster             = cluster;
+        entry.clusterId           = clusterId;
+        entry.manufacturerCode    = manufacturerCode;
+        entry.endpoint            = endpoint;
+        entry.mask                = mask;
     }
+    return cluster;
 }
 
 // This function wraps emberAfFindClusterWithMfgCode with EMBER_AF_NULL_MANUFACTURER_CODE
@@ -905,8 +1220,9 @@ static uint16_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterI
 
 static uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
 {
+    // Start from the first endpoint with that id, the ones after it only matter when it is disabled.
     uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    for (epi = lookupEndpointIndex(endpoint); epi < emberAfEndpointCount(); epi++)
     {
         if (emAfEndpoints[epi].endpoint == endpoint &&
             (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask & EMBER_AF_ENDPOINT_ENABLED))
@@ -953,6 +1269,8 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
     {
         emAfEndpoints[index].bitmask &= EMBER_AF_ENDPOINT_DISABLED;
     }
+    // Attributes and clusters of disabled endpoints cannot be found.
+    clearLookupCaches();
 
 #if defined(EZSP_HOST)
     ezspSetEndpointFlags(endpoint, (enable ? EZSP_ENDPOINT_ENABLED : EZSP_ENDPOINT_DISABLED));
@@ -1009,6 +1327,7 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
                 }
                 cur = next;
             }
+            rebuildAttributeAccessOverrideTable();
         }
 
 #ifdef ZCL_USING_DESCRIPTOR_CLUSTER_SERVER
@@ -1458,11 +1777,22 @@ bool registerAttributeAccessOverride(app::AttributeAccessInterface * attrOverrid
     }
     attrOverride->SetNext(gAttributeAccessOverrides);
     gAttributeAccessOverrides = attrOverride;
+    if (!gAttributeAccessOverrideTableOverflowed && !insertAttributeAccessOverride(attrOverride))
+    {
+        ChipLogProgress(Zcl, "Attribute override table is full, overrides will be looked up in the list");
+        gAttributeAccessOverrideTableOverflowed = true;
+    }
     return true;
 }
 
 app::AttributeAccessInterface * findAttributeAccessOverride(EndpointId endpointId, ClusterId clusterId)
 {
+    if (!gAttributeAccessOverrideTableOverflowed)
+    {
+        app::AttributeAccessInterface * attrOverride = lookupAttributeAccessOverride(false, endpointId, clusterId);
+        return (attrOverride != nullptr) ? attrOverride : lookupAttributeAccessOverride(true, endpointId, clusterId);
+    }
+
     for (app::AttributeAccessInterface * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
     {
         if (cur->Matches(endpointId, clusterId))
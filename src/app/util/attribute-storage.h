@@ -44,6 +44,7 @@
 //#include PLATFORM_HEADER
 #include <app/AttributeAccessInterface.h>
 #include <app/util/af.h>
+#include <lib/support/Span.h>
 
 #if !defined(EMBER_SCRIPTED_TEST)
 #include <app-common/zap-generated/att-storage.h>
@@ -134,6 +135,9 @@ EmberAfCluster * emberAfFindClusterInTypeWithMfgCode(EmberAfEndpointType * endpo
 
 EmberAfCluster * emberAfFindClusterInType(EmberAfEndpointType * endpointType, chip::ClusterId clusterId, EmberAfClusterMask mask);
 
+// Returns the data version of the given server cluster, or NULL if the cluster does not exist or has no data version.
+chip::DataVersion * emberAfDataVersionStorage(chip::EndpointId endpoint, chip::ClusterId clusterId);
+
 // This function returns the index of cluster for the particular endpoint.
 // Mask is either CLUSTER_MASK_CLIENT or CLUSTER_MASK_SERVER
 // For example, if you have 3 endpoints, 10, 11, 12, and cluster X server is
@@ -251,8 +255,11 @@ uint8_t emberAfGetClusterCountForEndpoint(chip::EndpointId endpoint);
 EmberAfCluster * emberAfGetClusterByIndex(chip::EndpointId endpoint, uint8_t clusterIndex);
 
 uint16_t emberAfGetDeviceIdForEndpoint(chip::EndpointId endpoint);
+// dataVersionStorage, if provided, must hold one data version per cluster of ep and outlive the dynamic endpoint. Without it,
+// the clusters of the endpoint report no data version.
 EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, chip::EndpointId id, EmberAfEndpointType * ep, uint16_t deviceId,
-                                        uint8_t deviceVersion);
+                                        uint8_t deviceVersion,
+                                        chip::Span<chip::DataVersion> dataVersionStorage = chip::Span<chip::DataVersion>());
 chip::EndpointId emberAfClearDynamicEndpoint(uint16_t index);
 uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
 
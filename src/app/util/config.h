@@ -188,6 +188,24 @@
 #define EMBER_AF_MESSAGE_SENT_CALLBACK_TABLE_SIZE EMBER_APS_UNICAST_MESSAGE_COUNT
 #endif // EMBER_AF_MESSAGE_SENT_CALLBACK_TABLE_SIZE
 
+// Number of attribute locations cached by attribute-storage, so that reading or writing an attribute again does not
+// search every endpoint, cluster and attribute.
+#ifndef EMBER_AF_ATTRIBUTE_CACHE_SIZE
+#define EMBER_AF_ATTRIBUTE_CACHE_SIZE 128
+#endif // EMBER_AF_ATTRIBUTE_CACHE_SIZE
+
+// Number of cluster locations cached by attribute-storage, so that finding a cluster on an endpoint again does not
+// search every cluster of the endpoint.
+#ifndef EMBER_AF_CLUSTER_CACHE_SIZE
+#define EMBER_AF_CLUSTER_CACHE_SIZE 64
+#endif // EMBER_AF_CLUSTER_CACHE_SIZE
+
+// Number of slots of the table finding the AttributeAccessInterface registered for an endpoint and cluster. Lookups walk
+// every registered AttributeAccessInterface while more of them are registered than the table can hold.
+#ifndef EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE
+#define EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE 64
+#endif // EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE
+
 #define EMBER_APPLICATION_HAS_COMMAND_ACTION_HANDLER
 
 // *******************************************************************
@@ -51,7 +51,8 @@ namespace chip {
 namespace app {
 namespace Compatibility {
 namespace {
-constexpr uint32_t kTemporaryDataVersion = 0;
+// Reported for the clusters without a data version.
+constexpr DataVersion kNoDataVersion = 0;
 // On some apps, ATTRIBUTE_LARGEST can as small as 3, making compiler unhappy since data[kAttributeReadBufferSize] cannot hold
 // uint64_t. Make kAttributeReadBufferSize at least 8 so it can fit all basic types.
 constexpr size_t kAttributeReadBufferSize = (ATTRIBUTE_LARGEST >= 8 ? ATTRIBUTE_LARGEST : 8);
@@ -185,8 +186,21 @@ void ResetEmberAfObjects()
 namespace {
 // Common buffer for ReadSingleClusterData & WriteSingleClusterData
 uint8_t attributeData[kAttributeReadBufferSize];
+
+DataVersion GetClusterDataVersion(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    DataVersion * version = emberAfDataVersionStorage(aEndpointId, aClusterId);
+    return (version != nullptr) ? *version : kNoDataVersion;
+}
 } // namespace
 
+bool IsClusterDataVersionEqual(EndpointId aEndpointId, ClusterId aClusterId, DataVersion aRequiredVersion)
+{
+    DataVersion * version = emberAfDataVersionStorage(aEndpointId, aClusterId);
+    // A cluster without a data version never matches, so that it is always reported.
+    return (version != nullptr) && (*version == aRequiredVersion);
+}
+
 bool ServerClusterCommandExists(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId)
 {
     // TODO: Currently, we are using cluster catalog from the ember library, this should be modified or replaced after several
@@ -212,9 +226,8 @@ CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * ap
 
         if (dataRead)
         {
-            // TODO: Add DataVersion support
-            ReturnErrorOnFailure(
-                apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion), kTemporaryDataVersion));
+            ReturnErrorOnFailure(apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion),
+                                               GetClusterDataVersion(aClusterInfo.mEndpointId, aClusterInfo.mClusterId)));
             return CHIP_NO_ERROR;
         }
     }
@@ -359,8 +372,8 @@ CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * ap
                              Protocols::InteractionModel::Status::UnsupportedRead);
     }
 
-    // TODO: Add DataVersion support
-    ReturnErrorOnFailure(apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion), kTemporaryDataVersion));
+    ReturnErrorOnFailure(apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion),
+                                       GetClusterDataVersion(aClusterInfo.mEndpointId, aClusterInfo.mClusterId)));
     return CHIP_NO_ERROR;
 }
 
@@ -489,7 +502,16 @@ void InteractionModelReportingAttributeChangeCallback(EndpointId endpoint, Clust
     IgnoreUnusedVariable(manufacturerCode);
     IgnoreUnusedVariable(type);
     IgnoreUnusedVariable(data);
-    IgnoreUnusedVariable(mask);
+
+    // Every change of a server attribute goes through here, including the ones of attributes stored outside of ember.
+    if (mask == CLUSTER_MASK_SERVER)
+    {
+        DataVersion * version = emberAfDataVersionStorage(endpoint, clusterId);
+        if (version != nullptr)
+        {
+            (*version)++;
+        }
+    }
 
     ClusterInfo info;
     info.mClusterId  = clusterId;
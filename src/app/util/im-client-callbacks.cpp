@@ -284,11 +284,11 @@ bool IMDefaultResponseCallback(const app::Command * commandObj, EmberAfStatus st
 
     Callback::Cancelable * onSuccessCallback = nullptr;
     Callback::Cancelable * onFailureCallback = nullptr;
-    NodeId sourceIdentifier =
-        reinterpret_cast<NodeId>(commandObj); /* #6559: Currently, we only have one commands for the IMInvokeCommands and to a
-                                                 device, so the seqNum is always set to 0. */
+    NodeId sourceIdentifier                  = reinterpret_cast<NodeId>(commandObj);
 
-    CHIP_ERROR err = gCallbacks.GetResponseCallback(sourceIdentifier, 0, &onSuccessCallback, &onFailureCallback);
+    // The callbacks of each command of the request are filed under the index of the command, see Device::AddIMResponseHandler.
+    CHIP_ERROR err = gCallbacks.GetResponseCallback(sourceIdentifier, commandObj->GetCurrentCommandIndex(), &onSuccessCallback,
+                                                    &onFailureCallback);
 
     if (CHIP_NO_ERROR != err)
     {
@@ -321,6 +321,30 @@ bool IMDefaultResponseCallback(const app::Command * commandObj, EmberAfStatus st
     return true;
 }
 
+bool IMDefaultResponseErrorCallback(const app::Command * commandObj, EmberAfStatus status)
+{
+    ChipLogProgress(Zcl, "DefaultResponseError:");
+    ChipLogProgress(Zcl, "  Transaction: %p", commandObj);
+    LogStatus(status);
+
+    NodeId sourceIdentifier = reinterpret_cast<NodeId>(commandObj);
+
+    // The callbacks of the commands that have been answered are gone already.
+    for (uint8_t commandIndex = 0; commandIndex < commandObj->GetCommandCount(); commandIndex++)
+    {
+        Callback::Cancelable * onSuccessCallback = nullptr;
+        Callback::Cancelable * onFailureCallback = nullptr;
+        if (gCallbacks.GetResponseCallback(sourceIdentifier, commandIndex, &onSuccessCallback, &onFailureCallback) == CHIP_NO_ERROR)
+        {
+            Callback::Callback<DefaultFailureCallback> * cb =
+                Callback::Callback<DefaultFailureCallback>::FromCancelable(onFailureCallback);
+            cb->mCall(cb->mContext, static_cast<uint8_t>(status));
+        }
+    }
+
+    return true;
+}
+
 bool IMWriteResponseCallback(const chip::app::WriteClient * writeClient, EmberAfStatus status)
 {
     ChipLogProgress(Zcl, "WriteResponse:");
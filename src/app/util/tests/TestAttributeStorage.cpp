@@ -0,0 +1,298 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the attribute, cluster and attribute access override lookups of
+ *      attribute-storage, on mock dynamic endpoints.
+ *
+ */
+
+#include <app/AttributeAccessInterface.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr EndpointId kMockEndpointId1 = 10;
+constexpr EndpointId kMockEndpointId2 = 11;
+constexpr EndpointId kMockEndpointId3 = 12;
+
+// Not clusters the data model implements, so that enabling a mock endpoint runs no cluster code.
+constexpr ClusterId kMockClusterId1 = 0x0F01;
+constexpr ClusterId kMockClusterId2 = 0x0F02;
+constexpr ClusterId kMockClusterId3 = 0x0F03;
+
+constexpr AttributeId kMockAttributeId1 = 1;
+constexpr AttributeId kMockAttributeId2 = 2;
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(mockAttrs1)
+DECLARE_DYNAMIC_ATTRIBUTE(kMockAttributeId1, BOOLEAN, 1, 0) DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0001);
+
+#define MOCK_ATTRIBUTE(attId) DECLARE_DYNAMIC_ATTRIBUTE(attId, INT8U, 1, 0)
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(manyAttrs)
+MOCK_ATTRIBUTE(0), MOCK_ATTRIBUTE(1), MOCK_ATTRIBUTE(2), MOCK_ATTRIBUTE(3), MOCK_ATTRIBUTE(4), MOCK_ATTRIBUTE(5), MOCK_ATTRIBUTE(6),
+    MOCK_ATTRIBUTE(7), MOCK_ATTRIBUTE(8), MOCK_ATTRIBUTE(9), MOCK_ATTRIBUTE(10), MOCK_ATTRIBUTE(11), MOCK_ATTRIBUTE(12),
+    MOCK_ATTRIBUTE(13), MOCK_ATTRIBUTE(14), MOCK_ATTRIBUTE(15) DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0001);
+
+static_assert(ArraySize(manyAttrs) > 2 * EMBER_AF_ATTRIBUTE_CACHE_SIZE, "manyAttrs must not fit in the attribute cache");
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(mockClusters1)
+DECLARE_DYNAMIC_CLUSTER(kMockClusterId1, mockAttrs1),
+    DECLARE_DYNAMIC_CLUSTER(kMockClusterId2, manyAttrs) DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(mockEndpoint1, mockClusters1);
+
+// Same cluster as mockEndpoint1 with another attribute, to tell which endpoint type a lookup went through.
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(mockAttrs2)
+DECLARE_DYNAMIC_ATTRIBUTE(kMockAttributeId2, BOOLEAN, 1, 0) DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0001);
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(mockClusters2)
+DECLARE_DYNAMIC_CLUSTER(kMockClusterId1, mockAttrs2) DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(mockEndpoint2, mockClusters2);
+
+#define MOCK_CLUSTER(clusterId) DECLARE_DYNAMIC_CLUSTER(clusterId, mockAttrs1)
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(manyClusters)
+MOCK_CLUSTER(0x0F10), MOCK_CLUSTER(0x0F11), MOCK_CLUSTER(0x0F12), MOCK_CLUSTER(0x0F13), MOCK_CLUSTER(0x0F14), MOCK_CLUSTER(0x0F15),
+    MOCK_CLUSTER(0x0F16), MOCK_CLUSTER(0x0F17), MOCK_CLUSTER(0x0F18), MOCK_CLUSTER(0x0F19), MOCK_CLUSTER(0x0F1A),
+    MOCK_CLUSTER(0x0F1B), MOCK_CLUSTER(0x0F1C), MOCK_CLUSTER(0x0F1D), MOCK_CLUSTER(0x0F1E), MOCK_CLUSTER(0x0F1F),
+    MOCK_CLUSTER(0x0F20) DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+static_assert(ArraySize(manyClusters) > 2 * EMBER_AF_CLUSTER_CACHE_SIZE, "manyClusters must not fit in the cluster cache");
+
+DECLARE_DYNAMIC_ENDPOINT(manyClustersEndpoint, manyClusters);
+
+class MockAttributeAccess : public app::AttributeAccessInterface
+{
+public:
+    MockAttributeAccess(Optional<EndpointId> aEndpointId, ClusterId aClusterId) : AttributeAccessInterface(aEndpointId, aClusterId)
+    {}
+
+    CHIP_ERROR Read(app::ClusterInfo & aClusterInfo, TLV::TLVWriter * aWriter, bool * aDataRead) override
+    {
+        *aDataRead = false;
+        return CHIP_NO_ERROR;
+    }
+};
+
+EmberAfAttributeMetadata * Locate(EndpointId aEndpoint, ClusterId aClusterId, AttributeId aAttributeId)
+{
+    return emberAfLocateAttributeMetadata(aEndpoint, aClusterId, aAttributeId, CLUSTER_MASK_SERVER,
+                                          EMBER_AF_NULL_MANUFACTURER_CODE);
+}
+
+void TestAttributeLookup(nlTestSuite * apSuite, void * apContext)
+{
+    NL_TEST_ASSERT(apSuite, emberAfSetDynamicEndpoint(0, kMockEndpointId1, &mockEndpoint1, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+
+    // The first pass walks the endpoints and fills the cache, the second one is served from it.
+    for (int pass = 0; pass < 2; pass++)
+    {
+        NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, kMockAttributeId1) == &mockAttrs1[0]);
+        NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, 0xFFFD) == &mockAttrs1[1]);
+        NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, kMockAttributeId2) == nullptr);
+        NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId2, kMockAttributeId1) == &manyAttrs[kMockAttributeId1]);
+        NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId2, kMockClusterId1, kMockAttributeId1) == nullptr);
+        NL_TEST_ASSERT(apSuite,
+                       emberAfLocateAttributeMetadata(kMockEndpointId1, kMockClusterId1, kMockAttributeId1, CLUSTER_MASK_CLIENT,
+                                                      EMBER_AF_NULL_MANUFACTURER_CODE) == nullptr);
+    }
+
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kMockEndpointId1);
+}
+
+void TestAttributeCacheEviction(nlTestSuite * apSuite, void * apContext)
+{
+    NL_TEST_ASSERT(apSuite, emberAfSetDynamicEndpoint(0, kMockEndpointId1, &mockEndpoint1, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+
+    // Looking all of them up, one way then the other, keeps evicting entries that are looked up again later.
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (size_t i = 0; i < ArraySize(manyAttrs); i++)
+        {
+            NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId2, manyAttrs[i].attributeId) == &manyAttrs[i]);
+        }
+        for (size_t i = ArraySize(manyAttrs); i > 0; i--)
+        {
+            NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId2, manyAttrs[i - 1].attributeId) == &manyAttrs[i - 1]);
+        }
+    }
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId2, 16) == nullptr);
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, kMockAttributeId1) == &mockAttrs1[0]);
+
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kMockEndpointId1);
+}
+
+void TestLookupCacheInvalidation(nlTestSuite * apSuite, void * apContext)
+{
+    NL_TEST_ASSERT(apSuite, emberAfSetDynamicEndpoint(0, kMockEndpointId1, &mockEndpoint1, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, kMockAttributeId1) == &mockAttrs1[0]);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId1, kMockClusterId1, CLUSTER_MASK_SERVER) == &mockClusters1[0]);
+
+    // A cleared endpoint has nothing left to find.
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kMockEndpointId1);
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, kMockAttributeId1) == nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId1, kMockClusterId1, CLUSTER_MASK_SERVER) == nullptr);
+
+    // Set again with another endpoint type, the endpoint only has what the new type has.
+    NL_TEST_ASSERT(apSuite, emberAfSetDynamicEndpoint(0, kMockEndpointId1, &mockEndpoint2, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, kMockAttributeId1) == nullptr);
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, kMockAttributeId2) == &mockAttrs2[0]);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId1, kMockClusterId1, CLUSTER_MASK_SERVER) == &mockClusters2[0]);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId1, kMockClusterId2, CLUSTER_MASK_SERVER) == nullptr);
+
+    // Setting another endpoint leaves the lookups of the first one alone.
+    NL_TEST_ASSERT(apSuite, emberAfSetDynamicEndpoint(1, kMockEndpointId2, &mockEndpoint1, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId2, kMockClusterId1, kMockAttributeId1) == &mockAttrs1[0]);
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId1, kMockClusterId1, kMockAttributeId2) == &mockAttrs2[0]);
+
+    // The attributes and clusters of a disabled endpoint cannot be found until it is enabled again.
+    NL_TEST_ASSERT(apSuite, emberAfEndpointEnableDisable(kMockEndpointId2, false));
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId2, kMockClusterId1, kMockAttributeId1) == nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId2, kMockClusterId1, CLUSTER_MASK_SERVER) == nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfEndpointEnableDisable(kMockEndpointId2, true));
+    NL_TEST_ASSERT(apSuite, Locate(kMockEndpointId2, kMockClusterId1, kMockAttributeId1) == &mockAttrs1[0]);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId2, kMockClusterId1, CLUSTER_MASK_SERVER) == &mockClusters1[0]);
+
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(1) == kMockEndpointId2);
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kMockEndpointId1);
+}
+
+void TestClusterCacheEviction(nlTestSuite * apSuite, void * apContext)
+{
+    NL_TEST_ASSERT(apSuite,
+                   emberAfSetDynamicEndpoint(0, kMockEndpointId1, &manyClustersEndpoint, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (size_t i = 0; i < ArraySize(manyClusters); i++)
+        {
+            EmberAfCluster * cluster = &manyClusters[i];
+            NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId1, cluster->clusterId, CLUSTER_MASK_SERVER) == cluster);
+        }
+        for (size_t i = ArraySize(manyClusters); i > 0; i--)
+        {
+            EmberAfCluster * cluster = &manyClusters[i - 1];
+            NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId1, cluster->clusterId, CLUSTER_MASK_SERVER) == cluster);
+        }
+    }
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId1, kMockClusterId1, CLUSTER_MASK_SERVER) == nullptr);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kMockEndpointId1, manyClusters[0].clusterId, CLUSTER_MASK_CLIENT) == nullptr);
+
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kMockEndpointId1);
+}
+
+void TestAttributeAccessOverrides(nlTestSuite * apSuite, void * apContext)
+{
+    // Overrides for one endpoint go away with the endpoint, the one for all endpoints stays registered after the test.
+    static MockAttributeAccess sAnyEndpointOverride(Optional<EndpointId>::Missing(), kMockClusterId2);
+    MockAttributeAccess endpoint1Override1(Optional<EndpointId>(kMockEndpointId1), kMockClusterId1);
+    MockAttributeAccess endpoint1Override3(Optional<EndpointId>(kMockEndpointId1), kMockClusterId3);
+    MockAttributeAccess endpoint2Override1(Optional<EndpointId>(kMockEndpointId2), kMockClusterId1);
+    MockAttributeAccess endpoint2Override3(Optional<EndpointId>(kMockEndpointId2), kMockClusterId3);
+    MockAttributeAccess duplicateOverride(Optional<EndpointId>(kMockEndpointId1), kMockClusterId1);
+    MockAttributeAccess shadowedOverride(Optional<EndpointId>(kMockEndpointId1), kMockClusterId2);
+
+    NL_TEST_ASSERT(apSuite, emberAfSetDynamicEndpoint(0, kMockEndpointId1, &mockEndpoint1, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, emberAfSetDynamicEndpoint(1, kMockEndpointId2, &mockEndpoint1, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&sAnyEndpointOverride));
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&endpoint1Override1));
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&endpoint2Override1));
+    NL_TEST_ASSERT(apSuite, !registerAttributeAccessOverride(&duplicateOverride));
+    NL_TEST_ASSERT(apSuite, !registerAttributeAccessOverride(&shadowedOverride));
+
+    // Disabling an endpoint drops its overrides from the table as well.
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId2, kMockClusterId1) == &endpoint2Override1);
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(1) == kMockEndpointId2);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId2, kMockClusterId1) == nullptr);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId1, kMockClusterId1) == &endpoint1Override1);
+
+    // Overrides can be registered again for the endpoint once it is back.
+    NL_TEST_ASSERT(apSuite, emberAfSetDynamicEndpoint(1, kMockEndpointId2, &mockEndpoint1, 0, 1) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&endpoint2Override1));
+
+    // Lookups of the overrides that fit in the table, then of more overrides than it holds, which are walked in the list.
+    static_assert(EMBER_AF_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE < 5, "The overrides must not fit in the table");
+    for (int pass = 0; pass < 2; pass++)
+    {
+        app::AttributeAccessInterface * expectedEndpoint1Override3 = (pass == 0) ? nullptr : &endpoint1Override3;
+        app::AttributeAccessInterface * expectedEndpoint2Override3 = (pass == 0) ? nullptr : &endpoint2Override3;
+
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId1, kMockClusterId1) == &endpoint1Override1);
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId2, kMockClusterId1) == &endpoint2Override1);
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId3, kMockClusterId1) == nullptr);
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId1, kMockClusterId2) == &sAnyEndpointOverride);
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId3, kMockClusterId2) == &sAnyEndpointOverride);
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId1, kMockClusterId3) == expectedEndpoint1Override3);
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId2, kMockClusterId3) == expectedEndpoint2Override3);
+
+        if (pass == 0)
+        {
+            NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&endpoint1Override3));
+            NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&endpoint2Override3));
+        }
+    }
+
+    // Disabling the endpoint again rebuilds the table from the overrides left, which fit again.
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(1) == kMockEndpointId2);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId2, kMockClusterId1) == nullptr);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId2, kMockClusterId3) == nullptr);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId2, kMockClusterId2) == &sAnyEndpointOverride);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId1, kMockClusterId1) == &endpoint1Override1);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId1, kMockClusterId3) == &endpoint1Override3);
+
+    NL_TEST_ASSERT(apSuite, emberAfClearDynamicEndpoint(0) == kMockEndpointId1);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId1, kMockClusterId1) == nullptr);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMockEndpointId1, kMockClusterId2) == &sAnyEndpointOverride);
+}
+
+int TestSetup(void * apContext)
+{
+    emberAfEndpointConfigure();
+    return SUCCESS;
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestAttributeLookup", TestAttributeLookup),
+    NL_TEST_DEF("TestAttributeCacheEviction", TestAttributeCacheEviction),
+    NL_TEST_DEF("TestLookupCacheInvalidation", TestLookupCacheInvalidation),
+    NL_TEST_DEF("TestClusterCacheEviction", TestClusterCacheEviction),
+    NL_TEST_DEF("TestAttributeAccessOverrides", TestAttributeAccessOverrides),
+    NL_TEST_SENTINEL()
+};
+} // namespace
+
+int TestAttributeStorage()
+{
+    nlTestSuite theSuite = { "AttributeStorage", &sTests[0], TestSetup, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeStorage)
@@ -101,9 +101,86 @@ CHIP_ERROR Device::SendCommands(app::CommandSender * commandObj)
     bool loadedSecureSession = false;
     ReturnErrorOnFailure(LoadSecureSessionParametersIfNeeded(loadedSecureSession));
     VerifyOrReturnError(commandObj != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Commands of a batch are sent together by SendCommandBatch().
+    if (mCommandBatchStarted && commandObj == mpCommandBatch)
+    {
+        return CHIP_NO_ERROR;
+    }
+
     return commandObj->SendCommandRequest(mDeviceId, mFabricIndex, mSecureSession);
 }
 
+CHIP_ERROR Device::StartCommandBatch()
+{
+    VerifyOrReturnError(!mCommandBatchStarted, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(app::InteractionModelEngine::GetInstance()->NewCommandSender(&mpCommandBatch));
+    mCommandBatchStarted = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::SendCommandBatch()
+{
+    CHIP_ERROR err                = CHIP_NO_ERROR;
+    bool loadedSecureSession      = false;
+    app::CommandSender * commands = mpCommandBatch;
+
+    VerifyOrReturnError(mCommandBatchStarted, CHIP_ERROR_INCORRECT_STATE);
+    mCommandBatchStarted = false;
+    mpCommandBatch       = nullptr;
+
+    // The batch has been dropped when one of its commands could not be added.
+    VerifyOrReturnError(commands != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    err = LoadSecureSessionParametersIfNeeded(loadedSecureSession);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = commands->SendCommandRequest(mDeviceId, mFabricIndex, mSecureSession);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ReleaseCommandSender(commands);
+    }
+    return err;
+}
+
+void Device::CancelCommandBatch()
+{
+    if (mpCommandBatch != nullptr)
+    {
+        ReleaseCommandSender(mpCommandBatch);
+    }
+    mCommandBatchStarted = false;
+}
+
+CHIP_ERROR Device::NewCommandSender(app::CommandSender ** commandObj)
+{
+    VerifyOrReturnError(commandObj != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mCommandBatchStarted)
+    {
+        VerifyOrReturnError(mpCommandBatch != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        *commandObj = mpCommandBatch;
+        return CHIP_NO_ERROR;
+    }
+
+    return app::InteractionModelEngine::GetInstance()->NewCommandSender(commandObj);
+}
+
+void Device::ReleaseCommandSender(app::CommandSender * commandObj)
+{
+    VerifyOrReturn(commandObj != nullptr);
+
+    if (commandObj == mpCommandBatch)
+    {
+        // The commands already added to the batch cannot be told apart from the one that failed, so the batch is dropped.
+        mpCommandBatch = nullptr;
+    }
+
+    CancelIMResponseHandler(commandObj);
+    commandObj->Shutdown();
+}
+
 CHIP_ERROR Device::Serialize(SerializedDevice & output)
 {
     SerializableDevice serializable;
@@ -403,6 +480,7 @@ void Device::Reset()
     }
 
     SetActive(false);
+    CancelCommandBatch();
     mCASESession.Clear();
 
     mState          = ConnectionState::NotConnected;
@@ -607,8 +685,11 @@ void Device::AddIMResponseHandler(app::CommandSender * commandObj, Callback::Can
     // chip::NodeId is uint64_t so the pointer can be used as a NodeId for CallbackMgr.
     static_assert(std::is_same<chip::NodeId, uint64_t>::value, "chip::NodeId is not uint64_t");
     chip::NodeId transactionId = reinterpret_cast<chip::NodeId>(commandObj);
-    mCallbacksMgr.AddResponseCallback(transactionId, 0 /* seqNum, always 0 for IM before #6559 */, onSuccessCallback,
-                                      onFailureCallback);
+    // The callbacks are added once the command has been added to the request, and filed under the index of the command so that
+    // the responses to the commands of a batch reach the right callbacks.
+    VerifyOrReturn(commandObj->GetCommandCount() > 0);
+    uint8_t commandIndex = static_cast<uint8_t>(commandObj->GetCommandCount() - 1);
+    mCallbacksMgr.AddResponseCallback(transactionId, commandIndex, onSuccessCallback, onFailureCallback);
 }
 
 void Device::CancelIMResponseHandler(app::CommandSender * commandObj)
@@ -618,7 +699,10 @@ void Device::CancelIMResponseHandler(app::CommandSender * commandObj)
     // chip::NodeId is uint64_t so the pointer can be used as a NodeId for CallbackMgr.
     static_assert(std::is_same<chip::NodeId, uint64_t>::value, "chip::NodeId is not uint64_t");
     chip::NodeId transactionId = reinterpret_cast<chip::NodeId>(commandObj);
-    mCallbacksMgr.CancelResponseCallback(transactionId, 0 /* seqNum, always 0 for IM before #6559 */);
+    for (uint8_t commandIndex = 0; commandIndex < commandObj->GetCommandCount(); commandIndex++)
+    {
+        mCallbacksMgr.CancelResponseCallback(transactionId, commandIndex);
+    }
 }
 
 void Device::AddReportHandler(EndpointId endpoint, ClusterId cluster, AttributeId attribute,
@@ -717,6 +801,8 @@ CHIP_ERROR Device::SendWriteAttributeRequest(app::WriteClientHandle aHandle, Cal
 
 Device::~Device()
 {
+    CancelCommandBatch();
+
     if (mExchangeMgr)
     {
         // Ensure that any exchange contexts we have open get closed now,
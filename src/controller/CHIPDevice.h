@@ -141,6 +141,43 @@ public:
      */
     CHIP_ERROR SendCommands(app::CommandSender * commandObj);
 
+    /**
+     * @brief
+     *   Start a batch of commands. Until SendCommandBatch() or CancelCommandBatch() is called, the commands sent to the device
+     *   through the cluster objects are added to a single invoke command request instead of being sent one by one. The device
+     *   answers all of them in a single response, and the callbacks of each command are called as usual.
+     *
+     *   The commands of a batch must fit in a single message. If a command cannot be added, the cluster call fails and the
+     *   whole batch is dropped without calling the callbacks of its commands.
+     */
+    CHIP_ERROR StartCommandBatch();
+
+    /**
+     * @brief
+     *   Send the commands added since StartCommandBatch() in a single invoke command request.
+     */
+    CHIP_ERROR SendCommandBatch();
+
+    /**
+     * @brief
+     *   Drop the commands added since StartCommandBatch() without sending them. Their callbacks are not called.
+     */
+    void CancelCommandBatch();
+
+    /**
+     * @brief
+     *   Get the command sender a command to the device is added to: the sender of the current batch if there is one, or a new
+     *   command sender otherwise. The command is sent by SendCommands().
+     */
+    CHIP_ERROR NewCommandSender(app::CommandSender ** commandObj);
+
+    /**
+     * @brief
+     *   Release a command sender returned by NewCommandSender() that a command could not be added to or sent with, along with
+     *   the response handlers added for it.
+     */
+    void ReleaseCommandSender(app::CommandSender * commandObj);
+
     /**
      * @brief Get the IP address and port assigned to the device.
      *
@@ -151,6 +188,11 @@ public:
      */
     bool GetAddress(Inet::IPAddress & addr, uint16_t & port) const;
 
+    /**
+     * @brief Get the transport address of the device, including its port and interface.
+     */
+    const Transport::PeerAddress & GetPeerAddress() const { return mDeviceAddress; }
+
     /**
      * @brief
      *   Initialize the device object with secure session manager and inet layer object
@@ -468,6 +510,10 @@ private:
 
     uint8_t mSequenceNumber = 0;
 
+    // Command sender of the batch started by StartCommandBatch(), nullptr if there is none or if it has been dropped.
+    app::CommandSender * mpCommandBatch = nullptr;
+    bool mCommandBatchStarted           = false;
+
     uint32_t mLocalMessageCounter = 0;
     uint32_t mPeerMessageCounter  = 0;
 
@@ -94,6 +94,11 @@ bool __attribute__((weak)) IMDefaultResponseCallback(const chip::app::Command *
     return false;
 }
 
+bool __attribute__((weak)) IMDefaultResponseErrorCallback(const chip::app::Command * commandObj, EmberAfStatus status)
+{
+    return false;
+}
+
 namespace chip {
 namespace Controller {
 
@@ -263,10 +268,11 @@ CHIP_ERROR DeviceController::Shutdown()
 
     ChipLogDetail(Controller, "Shutting down the controller");
 
-    for (uint32_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        mActiveDevices[i].Reset();
-    }
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        DeviceController::ReleaseDevice(device);
+        mActiveDevices.ReleaseObject(device);
+        return true;
+    });
 
     mState = State::NotInitialized;
 
@@ -368,25 +374,19 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, Device ** out_device)
 {
     CHIP_ERROR err  = CHIP_NO_ERROR;
     Device * device = nullptr;
-    uint16_t index  = 0;
 
     VerifyOrExit(out_device != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
-    index = FindDeviceIndex(deviceId);
+    device = FindDevice(deviceId);
 
-    if (index < kNumMaxActiveDevices)
-    {
-        device = &mActiveDevices[index];
-    }
-    else
+    if (device == nullptr)
     {
         err = InitializePairedDeviceList();
         SuccessOrExit(err);
 
         VerifyOrExit(mPairedDevices.Contains(deviceId), err = CHIP_ERROR_NOT_CONNECTED);
 
-        index = GetInactiveDeviceIndex();
-        VerifyOrExit(index < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-        device = &mActiveDevices[index];
+        device = AllocateDevice();
+        VerifyOrExit(device != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
         {
             SerializedDevice deviceInfo;
@@ -398,7 +398,7 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, Device ** out_device)
             VerifyOrExit(size <= sizeof(deviceInfo.inner), err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
 
             err = device->Deserialize(deviceInfo);
-            VerifyOrExit(err == CHIP_NO_ERROR, ReleaseDevice(device));
+            SuccessOrExit(err);
 
             device->Init(GetControllerDeviceInitParams(), mListenPort, mFabricIndex);
         }
@@ -439,6 +439,20 @@ CHIP_ERROR DeviceController::GetConnectedDevice(NodeId deviceId, Callback::Callb
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_MDNS
+    {
+        // If the device was resolved recently, reconnect to its cached address rather than to the persisted one, without
+        // waiting for a new resolution.
+        Mdns::ResolvedNodeData nodeData;
+        if (Mdns::Resolver::Instance().LookupCachedNodeId(
+                PeerId().SetCompressedFabricId(GetCompressedFabricId()).SetNodeId(deviceId), nodeData) == CHIP_NO_ERROR)
+        {
+            err = UpdateDeviceAddress(device, nodeData);
+            SuccessOrExit(err);
+        }
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS
+
     err = device->EstablishConnectivity(onConnection, onFailure);
     SuccessOrExit(err);
 
@@ -487,15 +501,15 @@ CHIP_ERROR DeviceController::ServiceEvents()
 CHIP_ERROR DeviceController::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                                System::PacketBufferHandle && msgBuf)
 {
-    uint16_t index;
+    Device * device = nullptr;
 
     VerifyOrExit(mState == State::Initialized, ChipLogError(Controller, "OnMessageReceived was called in incorrect state"));
     VerifyOrExit(ec != nullptr, ChipLogError(Controller, "OnMessageReceived was called with null exchange"));
 
-    index = FindDeviceIndex(ec->GetSecureSession().GetPeerNodeId());
-    VerifyOrExit(index < kNumMaxActiveDevices, ChipLogError(Controller, "OnMessageReceived was called for unknown device object"));
+    device = FindDevice(ec->GetSecureSession().GetPeerNodeId());
+    VerifyOrExit(device != nullptr, ChipLogError(Controller, "OnMessageReceived was called for unknown device object"));
 
-    mActiveDevices[index].OnMessageReceived(ec, payloadHeader, std::move(msgBuf));
+    device->OnMessageReceived(ec, payloadHeader, std::move(msgBuf));
 
 exit:
     return CHIP_NO_ERROR;
@@ -511,95 +525,100 @@ void DeviceController::OnNewConnection(SessionHandle session, Messaging::Exchang
 {
     VerifyOrReturn(mState == State::Initialized, ChipLogError(Controller, "OnNewConnection was called in incorrect state"));
 
-    uint16_t index = FindDeviceIndex(mgr->GetSessionManager()->GetSecureSession(session)->GetPeerNodeId());
-    VerifyOrReturn(index < kNumMaxActiveDevices,
-                   ChipLogDetail(Controller, "OnNewConnection was called for unknown device, ignoring it."));
+    Device * device = FindDevice(mgr->GetSessionManager()->GetSecureSession(session)->GetPeerNodeId());
+    VerifyOrReturn(device != nullptr, ChipLogDetail(Controller, "OnNewConnection was called for unknown device, ignoring it."));
 
-    mActiveDevices[index].OnNewConnection(session);
+    device->OnNewConnection(session);
 }
 
 void DeviceController::OnConnectionExpired(SessionHandle session, Messaging::ExchangeManager * mgr)
 {
     VerifyOrReturn(mState == State::Initialized, ChipLogError(Controller, "OnConnectionExpired was called in incorrect state"));
 
-    uint16_t index = FindDeviceIndex(session);
-    VerifyOrReturn(index < kNumMaxActiveDevices,
-                   ChipLogDetail(Controller, "OnConnectionExpired was called for unknown device, ignoring it."));
+    Device * device = FindDevice(session);
+    VerifyOrReturn(device != nullptr, ChipLogDetail(Controller, "OnConnectionExpired was called for unknown device, ignoring it."));
 
-    mActiveDevices[index].OnConnectionExpired(session);
+    device->OnConnectionExpired(session);
 }
 
-uint16_t DeviceController::GetInactiveDeviceIndex()
+Device * DeviceController::AllocateDevice()
 {
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices && mActiveDevices[i].IsActive())
-        i++;
-    if (i < kNumMaxActiveDevices)
+    // Released devices keep their slot (see ReleaseDevice()), so reuse one before growing the pool.
+    Device * device = nullptr;
+    mActiveDevices.ForEachActiveObject([&](Device * candidate) {
+        if (!candidate->IsActive())
+        {
+            device = candidate;
+            return false;
+        }
+        return true;
+    });
+
+    if (device == nullptr)
+    {
+        device = mActiveDevices.CreateObject();
+    }
+
+    if (device != nullptr)
     {
-        mActiveDevices[i].SetActive(true);
+        device->SetActive(true);
     }
 
-    return i;
+    return device;
 }
 
 void DeviceController::ReleaseDevice(Device * device)
 {
+    // Only reset the device: callers and bindings may still hold the pointer, so its storage
+    // is not returned to the pool until Shutdown().
     device->Reset();
 }
 
-void DeviceController::ReleaseDevice(uint16_t index)
-{
-    if (index < kNumMaxActiveDevices)
-    {
-        ReleaseDevice(&mActiveDevices[index]);
-    }
-}
-
 void DeviceController::ReleaseDeviceById(NodeId remoteDeviceId)
 {
-    for (uint16_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        if (mActiveDevices[i].GetDeviceId() == remoteDeviceId)
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        if (device->GetDeviceId() == remoteDeviceId)
         {
-            ReleaseDevice(&mActiveDevices[i]);
+            ReleaseDevice(device);
         }
-    }
+        return true;
+    });
 }
 
 void DeviceController::ReleaseAllDevices()
 {
-    for (uint16_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        ReleaseDevice(&mActiveDevices[i]);
-    }
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        ReleaseDevice(device);
+        return true;
+    });
 }
 
-uint16_t DeviceController::FindDeviceIndex(SessionHandle session)
+Device * DeviceController::FindDevice(SessionHandle session)
 {
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices)
-    {
-        if (mActiveDevices[i].IsActive() && mActiveDevices[i].IsSecureConnected() && mActiveDevices[i].MatchesSession(session))
+    Device * foundDevice = nullptr;
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        if (device->IsActive() && device->IsSecureConnected() && device->MatchesSession(session))
         {
-            return i;
+            foundDevice = device;
+            return false;
         }
-        i++;
-    }
-    return i;
+        return true;
+    });
+    return foundDevice;
 }
 
-uint16_t DeviceController::FindDeviceIndex(NodeId id)
+Device * DeviceController::FindDevice(NodeId id)
 {
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices)
-    {
-        if (mActiveDevices[i].IsActive() && mActiveDevices[i].GetDeviceId() == id)
+    Device * foundDevice = nullptr;
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        if (device->IsActive() && device->GetDeviceId() == id)
         {
-            return i;
+            foundDevice = device;
+            return false;
         }
-        i++;
-    }
-    return i;
+        return true;
+    });
+    return foundDevice;
 }
 
 CHIP_ERROR DeviceController::InitializePairedDeviceList()
@@ -670,15 +689,10 @@ void DeviceController::PersistNextKeyId()
 }
 
 #if CHIP_DEVICE_CONFIG_ENABLE_MDNS
-void DeviceController::OnNodeIdResolved(const chip::Mdns::ResolvedNodeData & nodeData)
+CHIP_ERROR DeviceController::UpdateDeviceAddress(Device * device, const chip::Mdns::ResolvedNodeData & nodeData)
 {
-    CHIP_ERROR err                = CHIP_NO_ERROR;
-    Device * device               = nullptr;
     Inet::InterfaceId interfaceId = INET_NULL_INTERFACEID;
 
-    err = GetDevice(nodeData.mPeerId.GetNodeId(), &device);
-    SuccessOrExit(err);
-
     // Only use the mDNS resolution's InterfaceID for addresses that are IPv6 LLA.
     // For all other addresses, we should rely on the device's routing table to route messages sent.
     // Forcing messages down an InterfaceId might fail. For example, in bridged networks like Thread,
@@ -688,10 +702,30 @@ void DeviceController::OnNodeIdResolved(const chip::Mdns::ResolvedNodeData & nod
         interfaceId = nodeData.mInterfaceId;
     }
 
-    err = device->UpdateAddress(Transport::PeerAddress::UDP(nodeData.mAddress, nodeData.mPort, interfaceId));
+    const Transport::PeerAddress address = Transport::PeerAddress::UDP(nodeData.mAddress, nodeData.mPort, interfaceId);
+    const bool addressChanged            = (device->GetPeerAddress() != address);
+
+    ReturnErrorOnFailure(device->UpdateAddress(address));
+
+    // Resolutions usually confirm the address already known (e.g. cache hits in GetConnectedDevice()), which
+    // does not need to be written to storage again.
+    if (addressChanged)
+    {
+        PersistDevice(device);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void DeviceController::OnNodeIdResolved(const chip::Mdns::ResolvedNodeData & nodeData)
+{
+    CHIP_ERROR err  = CHIP_NO_ERROR;
+    Device * device = nullptr;
+
+    err = GetDevice(nodeData.mPeerId.GetNodeId(), &device);
     SuccessOrExit(err);
 
-    PersistDevice(device);
+    err = UpdateDeviceAddress(device, nodeData);
+    SuccessOrExit(err);
 
 exit:
 
@@ -737,7 +771,7 @@ DeviceCommissioner::DeviceCommissioner() :
     mOnDeviceConnectionFailureCallback(OnDeviceConnectionFailureFn, this), mDeviceNOCChainCallback(OnDeviceNOCChainGeneration, this)
 {
     mPairingDelegate      = nullptr;
-    mDeviceBeingPaired    = kNumMaxActiveDevices;
+    mDeviceBeingPaired    = nullptr;
     mPairedDevicesUpdated = false;
 }
 
@@ -789,6 +823,12 @@ CHIP_ERROR DeviceCommissioner::Shutdown()
 
     mPairingSession.Clear();
 
+    if (mDeviceBeingPaired != nullptr)
+    {
+        ReleaseDevice(mDeviceBeingPaired);
+        mDeviceBeingPaired = nullptr;
+    }
+
     PersistDeviceList();
 
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY // make this commissioner discoverable
@@ -825,7 +865,7 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
 
     VerifyOrExit(IsOperationalNodeId(remoteDeviceId), err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceBeingPaired == kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mDeviceBeingPaired == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrExit(fabric != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     err = InitializePairedDeviceList();
@@ -850,9 +890,9 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
                                                   params.GetPeerAddress().GetInterface());
     }
 
-    mDeviceBeingPaired = GetInactiveDeviceIndex();
-    VerifyOrExit(mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-    device = &mActiveDevices[mDeviceBeingPaired];
+    mDeviceBeingPaired = AllocateDevice();
+    VerifyOrExit(mDeviceBeingPaired != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    device = mDeviceBeingPaired;
 
     // If the CSRNonce is passed in, using that else using a random one..
     if (params.HasCSRNonce())
@@ -913,15 +953,16 @@ exit:
     if (err != CHIP_NO_ERROR)
     {
         // Delete the current rendezvous session only if a device is not currently being paired.
-        if (mDeviceBeingPaired == kNumMaxActiveDevices)
+        if (mDeviceBeingPaired == nullptr)
         {
             FreeRendezvousSession();
         }
 
-        if (device != nullptr)
+        // The device may already have been released if the pairing failure was reported through RendezvousCleanup().
+        if (device != nullptr && device == mDeviceBeingPaired)
         {
             ReleaseDevice(device);
-            mDeviceBeingPaired = kNumMaxActiveDevices;
+            mDeviceBeingPaired = nullptr;
         }
     }
 
@@ -941,14 +982,14 @@ CHIP_ERROR DeviceCommissioner::PairTestDeviceWithoutSecurity(NodeId remoteDevice
     VerifyOrExit(IsOperationalNodeId(remoteDeviceId), err = CHIP_ERROR_INVALID_ARGUMENT);
 
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceBeingPaired == kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mDeviceBeingPaired == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     testSecurePairingSecret = chip::Platform::New<SecurePairingUsingTestSecret>();
     VerifyOrExit(testSecurePairingSecret != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
-    mDeviceBeingPaired = GetInactiveDeviceIndex();
-    VerifyOrExit(mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-    device = &mActiveDevices[mDeviceBeingPaired];
+    mDeviceBeingPaired = AllocateDevice();
+    VerifyOrExit(mDeviceBeingPaired != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    device = mDeviceBeingPaired;
 
     testSecurePairingSecret->ToSerializable(device->GetPairing());
 
@@ -990,10 +1031,11 @@ exit:
 
     if (err != CHIP_NO_ERROR)
     {
-        if (device != nullptr)
+        // The device may already have been released if the pairing failure was reported through RendezvousCleanup().
+        if (device != nullptr && device == mDeviceBeingPaired)
         {
             ReleaseDevice(device);
-            mDeviceBeingPaired = kNumMaxActiveDevices;
+            mDeviceBeingPaired = nullptr;
         }
     }
 
@@ -1003,15 +1045,15 @@ exit:
 CHIP_ERROR DeviceCommissioner::StopPairing(NodeId remoteDeviceId)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceBeingPaired != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
     VerifyOrReturnError(device->GetDeviceId() == remoteDeviceId, CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
 
     FreeRendezvousSession();
 
     ReleaseDevice(device);
-    mDeviceBeingPaired = kNumMaxActiveDevices;
+    mDeviceBeingPaired = nullptr;
     return CHIP_NO_ERROR;
 }
 
@@ -1021,9 +1063,9 @@ CHIP_ERROR DeviceCommissioner::UnpairDevice(NodeId remoteDeviceId)
 
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
 
-    if (mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (mDeviceBeingPaired != nullptr)
     {
-        Device * device = &mActiveDevices[mDeviceBeingPaired];
+        Device * device = mDeviceBeingPaired;
         if (device->GetDeviceId() == remoteDeviceId)
         {
             FreeRendezvousSession();
@@ -1127,7 +1169,7 @@ void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
     FreeRendezvousSession();
 
     // TODO: make mStorageDelegate mandatory once all controller applications implement the interface.
-    if (mDeviceBeingPaired != kNumMaxActiveDevices && mStorageDelegate != nullptr)
+    if (mDeviceBeingPaired != nullptr && mStorageDelegate != nullptr)
     {
         // Let's release the device that's being paired.
         // If pairing was successful, its information is
@@ -1137,7 +1179,7 @@ void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
         DeviceController::ReleaseDevice(mDeviceBeingPaired);
     }
 
-    mDeviceBeingPaired = kNumMaxActiveDevices;
+    mDeviceBeingPaired = nullptr;
 
     if (mPairingDelegate != nullptr)
     {
@@ -1159,9 +1201,9 @@ void DeviceCommissioner::OnSessionEstablishmentError(CHIP_ERROR err)
 
 void DeviceCommissioner::OnSessionEstablished()
 {
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices, OnSessionEstablishmentError(CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
+    VerifyOrReturn(mDeviceBeingPaired != nullptr, OnSessionEstablishmentError(CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     // TODO: the session should know which peer we are trying to connect to when started
     mPairingSession.SetPeerNodeId(device->GetDeviceId());
@@ -1256,14 +1298,14 @@ void DeviceCommissioner::OnDeviceNOCChainGeneration(void * context, CHIP_ERROR s
     ChipLogProgress(Controller, "Received callback from the CA for NOC Chain generation. Status %s", ErrorStr(status));
     Device * device = nullptr;
     VerifyOrExit(commissioner->mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     // Check if the callback returned a failure
     VerifyOrExit(status == CHIP_NO_ERROR, err = status);
 
     // TODO - Verify that the generated root cert matches with commissioner's root cert
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     {
         // Reuse NOC Cert buffer for temporary store Root Cert.
@@ -1308,9 +1350,9 @@ exit:
 CHIP_ERROR DeviceCommissioner::ProcessOpCSR(const ByteSpan & NOCSRElements, const ByteSpan & AttestationSignature)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceBeingPaired != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     ChipLogProgress(Controller, "Getting certificate chain for the device from the issuer");
 
@@ -1389,12 +1431,12 @@ void DeviceCommissioner::OnOperationalCertificateAddResponse(void * context, uin
     commissioner->mOpCSRResponseCallback.Cancel();
     commissioner->mOnCertFailureCallback.Cancel();
 
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     err = ConvertFromNodeOperationalCertStatus(StatusCode);
     SuccessOrExit(err);
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     err = commissioner->OnOperationalCredentialsProvisioningCompletion(device);
 
@@ -1438,9 +1480,9 @@ void DeviceCommissioner::OnRootCertSuccessResponse(void * context)
     commissioner->mRootCertResponseCallback.Cancel();
     commissioner->mOnRootCertFailureCallback.Cancel();
 
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     ChipLogProgress(Controller, "Sending operational certificate chain to the device");
     err = commissioner->SendOperationalCertificate(device, device->GetNOCCert(), device->GetICACert());
@@ -1531,9 +1573,9 @@ CHIP_ERROR DeviceCommissioner::CloseBleConnection()
 void DeviceCommissioner::OnSessionEstablishmentTimeout()
 {
     VerifyOrReturn(mState == State::Initialized);
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices);
+    VerifyOrReturn(mDeviceBeingPaired != nullptr);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
     StopPairing(device->GetDeviceId());
 
     if (mPairingDelegate != nullptr)
@@ -1632,9 +1674,10 @@ CHIP_ERROR DeviceControllerInteractionModelDelegate::CommandResponseError(const
     // Generally IM has more detailed errors than ember library, here we always use EMBER_ZCL_STATUS_FAILURE before #6308 is landed
     // and the app can take care of these error codes, the actual handling of the commands should implement full IMDelegate.
     // #6308: By implement app side IM delegate, we should be able to accept detailed error codes.
-    // Note: The IMDefaultResponseCallback is a bridge to the old CallbackMgr before IM is landed, so it still accepts EmberAfStatus
-    // instead of IM status code.
-    IMDefaultResponseCallback(apCommandSender, EMBER_ZCL_STATUS_FAILURE);
+    // Note: The IMDefaultResponseErrorCallback is a bridge to the old CallbackMgr before IM is landed, so it still accepts
+    // EmberAfStatus instead of IM status code.
+    // The error applies to the whole request, so every command of it that has not been answered fails.
+    IMDefaultResponseErrorCallback(apCommandSender, EMBER_ZCL_STATUS_FAILURE);
 
     return CHIP_NO_ERROR;
 }
@@ -1726,9 +1769,9 @@ void DeviceCommissioner::OnNodeIdResolved(const chip::Mdns::ResolvedNodeData & n
 
 void DeviceCommissioner::OnNodeIdResolutionFailed(const chip::PeerId & peer, CHIP_ERROR error)
 {
-    if (mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (mDeviceBeingPaired != nullptr)
     {
-        Device * device = &mActiveDevices[mDeviceBeingPaired];
+        Device * device = mDeviceBeingPaired;
         if (device->GetDeviceId() == peer.GetNodeId() && mCommissioningStage == CommissioningStage::kFindOperational)
         {
             OnSessionEstablishmentError(error);
@@ -1744,9 +1787,9 @@ void DeviceCommissioner::OnDeviceConnectedFn(void * context, Device * device)
     DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
     VerifyOrReturn(commissioner != nullptr, ChipLogProgress(Controller, "Device connected callback with null context. Ignoring"));
 
-    if (commissioner->mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (commissioner->mDeviceBeingPaired != nullptr)
     {
-        Device * deviceBeingPaired = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+        Device * deviceBeingPaired = commissioner->mDeviceBeingPaired;
         if (device == deviceBeingPaired && commissioner->mCommissioningStage == CommissioningStage::kFindOperational)
         {
             commissioner->AdvanceCommissioningStage(CHIP_NO_ERROR);
@@ -1821,12 +1864,12 @@ void DeviceCommissioner::AdvanceCommissioningStage(CHIP_ERROR err)
         return;
     }
     Device * device = nullptr;
-    if (mDeviceBeingPaired >= kNumMaxActiveDevices)
+    if (mDeviceBeingPaired == nullptr)
     {
         return;
     }
 
-    device = &mActiveDevices[mDeviceBeingPaired];
+    device = mDeviceBeingPaired;
 
     // TODO(cecille): We probably want something better than this for breadcrumbs.
     uint64_t breadcrumb = static_cast<uint64_t>(nextStage);
@@ -39,6 +39,7 @@
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Pool.h>
 #include <lib/support/SerializableIntegerSet.h>
 #include <lib/support/Span.h>
 #include <messaging/ExchangeMgr.h>
@@ -284,9 +285,12 @@ protected:
 
     /* A list of device objects that can be used for communicating with corresponding
        CHIP devices. The list does not contain all the paired devices, but only the ones
-       which the controller application is currently accessing.
+       which the controller application is currently accessing. Unless the pool is heap backed,
+       at most kNumMaxActiveDevices devices can be active at once. Released devices are only
+       reset and reused by later allocations, so a Device pointer handed out by the controller
+       stays valid until Shutdown().
     */
-    Device mActiveDevices[kNumMaxActiveDevices];
+    BitMapOrHeapObjectPool<Device, kNumMaxActiveDevices, CHIP_DEVICE_CONTROLLER_DEVICE_POOL_USE_HEAP> mActiveDevices;
 
     SerializableU64Set<kNumMaxPairedDevices> mPairedDevices;
     bool mPairedDevicesInitialized;
@@ -314,10 +318,9 @@ protected:
     DeviceControllerInteractionModelDelegate * mInteractionModelDelegate = nullptr;
 
     uint16_t mListenPort;
-    uint16_t GetInactiveDeviceIndex();
-    uint16_t FindDeviceIndex(SessionHandle session);
-    uint16_t FindDeviceIndex(NodeId id);
-    void ReleaseDevice(uint16_t index);
+    Device * AllocateDevice();
+    Device * FindDevice(SessionHandle session);
+    Device * FindDevice(NodeId id);
     void ReleaseDeviceById(NodeId remoteDeviceId);
     CHIP_ERROR InitializePairedDeviceList();
     CHIP_ERROR SetPairedDeviceList(ByteSpan pairedDeviceSerializedSet);
@@ -335,6 +338,9 @@ protected:
     uint16_t mVendorId;
 
 #if CHIP_DEVICE_CONFIG_ENABLE_MDNS
+    /// Sets the address of the device to the one it was resolved to, and persists it.
+    CHIP_ERROR UpdateDeviceAddress(Device * device, const chip::Mdns::ResolvedNodeData & nodeData);
+
     //////////// ResolverDelegate Implementation ///////////////
     void OnNodeIdResolved(const chip::Mdns::ResolvedNodeData & nodeData) override;
     void OnNodeIdResolutionFailed(const chip::PeerId & peerId, CHIP_ERROR error) override;
@@ -567,10 +573,10 @@ public:
 private:
     DevicePairingDelegate * mPairingDelegate;
 
-    /* This field is an index in mActiveDevices list. The object at this index in the list
-       contains the device object that's tracking the state of the device that's being paired.
-       If no device is currently being paired, this value will be kNumMaxPairedDevices.  */
-    uint16_t mDeviceBeingPaired;
+    /* This field points to the device object in mActiveDevices that's tracking the state of
+       the device that's being paired. If no device is currently being paired, this value
+       will be nullptr.  */
+    Device * mDeviceBeingPaired;
 
     /* TODO: BLE rendezvous and IP rendezvous should share the same procedure, so this is just a
        workaround-like flag and should be removed in the future.
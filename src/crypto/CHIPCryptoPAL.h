@@ -86,6 +86,13 @@ constexpr size_t kEmitDerIntegerOverhead           = 3; // Tag + Length byte + 1
  */
 constexpr size_t kMAX_Hash_SHA256_Context_Size = ((sizeof(unsigned int) * (8 + 2 + 16 + 2)) + sizeof(uint64_t));
 
+/*
+ * Backend state of a pre-keyed AES_CCM_Cipher. OpenSSL only keeps an EVP_CIPHER_CTX pointer,
+ * mbedTLS keeps a whole mbedtls_ccm_context, whose size grows with hardware-accelerated
+ * (_ALT) implementations, hence the generous bound. Backends static assert against it.
+ */
+constexpr size_t kMAX_AES_CCM_Cipher_Context_Size = 256;
+
 /*
  * Overhead to encode a raw ECDSA signature in X9.62 format in ASN.1 DER
  *
@@ -622,6 +629,77 @@ private:
     HashSHA256OpaqueContext mContext;
 };
 
+struct alignas(size_t) AES_CCM_CipherOpaqueContext
+{
+    uint8_t mOpaque[kMAX_AES_CCM_Cipher_Context_Size];
+};
+
+/**
+ * @brief A pre-keyed AES-CCM cipher for protecting many messages under the same key.
+ *
+ * AES_CCM_encrypt() and AES_CCM_decrypt() select the cipher, expand the key and set the nonce
+ * and tag lengths on every call. This class does that work once in Init(), leaving only the
+ * per-message nonce, AAD and payload for Encrypt()/Decrypt(). Each instance works in a single
+ * direction with a fixed nonce and tag length. It owns backend resources and cannot be copied.
+ **/
+class AES_CCM_Cipher
+{
+public:
+    enum class Direction : uint8_t
+    {
+        kEncrypt,
+        kDecrypt,
+    };
+
+    AES_CCM_Cipher() {}
+    ~AES_CCM_Cipher() { Clear(); }
+
+    AES_CCM_Cipher(const AES_CCM_Cipher &) = delete;
+    AES_CCM_Cipher & operator=(const AES_CCM_Cipher &) = delete;
+
+    /**
+     * @brief Set up the cipher and expand the key.
+     *
+     * @param direction Whether Encrypt() or Decrypt() will be used
+     * @param key Key to use for all messages
+     * @param key_length Length of key (in bytes)
+     * @param iv_length Length of the nonces that will be passed in
+     * @param tag_length Length of the tags that will be produced or checked
+     * @return CHIP_ERROR_INCORRECT_STATE if already initialized, CHIP_ERROR_INVALID_ARGUMENT
+     *         on invalid parameters, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR Init(Direction direction, const uint8_t * key, size_t key_length, size_t iv_length, size_t tag_length);
+
+    /**
+     * @brief Release backend resources and wipe the expanded key.
+     **/
+    void Clear();
+
+    bool IsInitialized() const { return mInitialized; }
+    size_t GetTagLength() const { return mTagLength; }
+
+    /**
+     * @brief Encrypt one message. Arguments are as for AES_CCM_encrypt(); iv_length and
+     *        tag_length must match the values passed to Init().
+     **/
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief Decrypt one message. Arguments are as for AES_CCM_decrypt(); iv_length and
+     *        tag_length must match the values passed to Init().
+     **/
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length, uint8_t * plaintext);
+
+private:
+    AES_CCM_CipherOpaqueContext mContext;
+    size_t mIVLength     = 0;
+    size_t mTagLength    = 0;
+    Direction mDirection = Direction::kEncrypt;
+    bool mInitialized    = false;
+};
+
 class HKDF_sha
 {
 public:
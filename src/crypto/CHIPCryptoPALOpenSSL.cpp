@@ -281,6 +281,189 @@ exit:
     return error;
 }
 
+static_assert(kMAX_AES_CCM_Cipher_Context_Size >= sizeof(EVP_CIPHER_CTX *),
+              "kMAX_AES_CCM_Cipher_Context_Size is too small to hold an EVP_CIPHER_CTX pointer");
+
+static inline void from_EVP_CIPHER_CTX(EVP_CIPHER_CTX * context, AES_CCM_CipherOpaqueContext * opaque)
+{
+    *SafePointerCast<EVP_CIPHER_CTX **>(opaque) = context;
+}
+
+static inline EVP_CIPHER_CTX * to_EVP_CIPHER_CTX(AES_CCM_CipherOpaqueContext * opaque)
+{
+    return *SafePointerCast<EVP_CIPHER_CTX **>(opaque);
+}
+
+CHIP_ERROR AES_CCM_Cipher::Init(Direction direction, const uint8_t * key, size_t key_length, size_t iv_length, size_t tag_length)
+{
+    EVP_CIPHER_CTX * context = nullptr;
+    CHIP_ERROR error         = CHIP_NO_ERROR;
+    int result               = 1;
+    const EVP_CIPHER * type  = nullptr;
+    const int encrypt        = (direction == Direction::kEncrypt) ? 1 : 0;
+
+    VerifyOrReturnError(!mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidKeyLength(key_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(iv_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    from_EVP_CIPHER_CTX(context, &mContext);
+    mInitialized = true;
+
+    // 16 bytes key for AES-CCM-128
+    type = (key_length == 16) ? EVP_aes_128_ccm() : EVP_aes_256_ccm();
+
+    // Pass in cipher
+    result = EVP_CipherInit_ex(context, type, nullptr, nullptr, nullptr, encrypt);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Pass in IV length. Cast is safe because we checked with CanCastTo.
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(iv_length), nullptr);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Pass in tag length. When decrypting, the expected tag itself is passed with each message.
+    // Cast is safe because we checked _isValidTagLength.
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Pass in key. The key schedule is kept in the context, only the IV changes per message.
+    result = EVP_CipherInit_ex(context, nullptr, nullptr, Uint8::to_const_uchar(key), nullptr, encrypt);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    mDirection = direction;
+    mIVLength  = iv_length;
+    mTagLength = tag_length;
+
+exit:
+    if (error != CHIP_NO_ERROR)
+    {
+        Clear();
+    }
+
+    return error;
+}
+
+void AES_CCM_Cipher::Clear()
+{
+    if (mInitialized)
+    {
+        // Frees the context after cleansing it, including the key schedule.
+        EVP_CIPHER_CTX_free(to_EVP_CIPHER_CTX(&mContext));
+        from_EVP_CIPHER_CTX(nullptr, &mContext);
+        mInitialized = false;
+    }
+}
+
+CHIP_ERROR AES_CCM_Cipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                   const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    EVP_CIPHER_CTX * context = nullptr;
+    int bytesWritten         = 0;
+    size_t ciphertext_length = 0;
+    int result               = 1;
+
+    VerifyOrReturnError(mInitialized && mDirection == Direction::kEncrypt, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length == mIVLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_length == mTagLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    context = to_EVP_CIPHER_CTX(&mContext);
+
+    // Pass in iv
+    result = EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(iv));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in plain text length
+    result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in AAD
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+        result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    // Encrypt
+    result = EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                               static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten >= 0, CHIP_ERROR_INTERNAL);
+    ciphertext_length = static_cast<unsigned int>(bytesWritten);
+
+    // Finalize encryption
+    result = EVP_EncryptFinal_ex(context, ciphertext + ciphertext_length, &bytesWritten);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Get tag. Cast is safe because tag_length was checked by Init.
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Cipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                   const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length,
+                                   uint8_t * plaintext)
+{
+    EVP_CIPHER_CTX * context = nullptr;
+    int bytesOutput          = 0;
+    int result               = 1;
+
+    VerifyOrReturnError(mInitialized && mDirection == Direction::kDecrypt, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_length == mTagLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length == mIVLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    context = to_EVP_CIPHER_CTX(&mContext);
+
+    // Pass in expected tag
+    // Removing "const" from |tag| here should hopefully be safe as
+    // we're writing the tag, not reading.
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                 const_cast<void *>(static_cast<const void *>(tag)));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in iv
+    result = EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(iv));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in cipher text length
+    result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in aad
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+        result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    // Pass in ciphertext. We wont get anything if validation fails.
+    result = EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                               static_cast<int>(ciphertext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
@@ -184,6 +184,103 @@ exit:
     return error;
 }
 
+static_assert(kMAX_AES_CCM_Cipher_Context_Size >= sizeof(mbedtls_ccm_context),
+              "kMAX_AES_CCM_Cipher_Context_Size is too small for the size of underlying mbedtls_ccm_context");
+
+static inline mbedtls_ccm_context * to_inner_aes_ccm_context(AES_CCM_CipherOpaqueContext * context)
+{
+    return SafePointerCast<mbedtls_ccm_context *>(context);
+}
+
+CHIP_ERROR AES_CCM_Cipher::Init(Direction direction, const uint8_t * key, size_t key_length, size_t iv_length, size_t tag_length)
+{
+    VerifyOrReturnError(!mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidKeyLength(key_length), CHIP_ERROR_UNSUPPORTED_ENCRYPTION_TYPE);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mbedtls_ccm_context * const context = to_inner_aes_ccm_context(&mContext);
+    mbedtls_ccm_init(context);
+    mInitialized = true;
+
+    // Size of key = key_length * number of bits in a byte (8)
+    // Cast is safe because we called _isValidKeyLength above.
+    const int result =
+        mbedtls_ccm_setkey(context, MBEDTLS_CIPHER_ID_AES, Uint8::to_const_uchar(key), static_cast<unsigned int>(key_length * 8));
+    _log_mbedTLS_error(result);
+    if (result != 0)
+    {
+        Clear();
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mDirection = direction;
+    mIVLength  = iv_length;
+    mTagLength = tag_length;
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM_Cipher::Clear()
+{
+    if (mInitialized)
+    {
+        // Frees the expanded key and zeroizes the context.
+        mbedtls_ccm_free(to_inner_aes_ccm_context(&mContext));
+        mInitialized = false;
+    }
+}
+
+CHIP_ERROR AES_CCM_Cipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                   const uint8_t * iv, size_t iv_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    VerifyOrReturnError(mInitialized && mDirection == Direction::kEncrypt, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length == mIVLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_length == mTagLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Encrypt
+    const int result = mbedtls_ccm_encrypt_and_tag(to_inner_aes_ccm_context(&mContext), plaintext_length, Uint8::to_const_uchar(iv),
+                                                   iv_length, Uint8::to_const_uchar(aad), aad_length,
+                                                   Uint8::to_const_uchar(plaintext), Uint8::to_uchar(ciphertext),
+                                                   Uint8::to_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM_Cipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                   const uint8_t * tag, size_t tag_length, const uint8_t * iv, size_t iv_length,
+                                   uint8_t * plaintext)
+{
+    VerifyOrReturnError(mInitialized && mDirection == Direction::kDecrypt, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_length == mTagLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length == mIVLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Decrypt
+    const int result = mbedtls_ccm_auth_decrypt(to_inner_aes_ccm_context(&mContext), ciphertext_length, Uint8::to_const_uchar(iv),
+                                                iv_length, Uint8::to_const_uchar(aad), aad_length,
+                                                Uint8::to_const_uchar(ciphertext), Uint8::to_uchar(plaintext),
+                                                Uint8::to_const_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
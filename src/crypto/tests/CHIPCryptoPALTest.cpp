@@ -675,6 +675,107 @@ static void TestAES_CCM_128DecryptInvalidIVLen(nlTestSuite * inSuite, void * inC
     NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
 }
 
+static void TestAES_CCM_128CipherTestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len == 0 || vector->result != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+
+        numOfTestsRan++;
+        AES_CCM_Cipher encryptor;
+        AES_CCM_Cipher decryptor;
+        NL_TEST_ASSERT(inSuite,
+                       encryptor.Init(AES_CCM_Cipher::Direction::kEncrypt, vector->key, vector->key_len, vector->iv_len,
+                                      vector->tag_len) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       decryptor.Init(AES_CCM_Cipher::Direction::kDecrypt, vector->key, vector->key_len, vector->iv_len,
+                                      vector->tag_len) == CHIP_NO_ERROR);
+
+        // The same cipher must give the same result for every message, not only the first one.
+        for (int round = 0; round < 3; round++)
+        {
+            uint8_t out_ct[64];
+            uint8_t out_tag[16];
+            uint8_t out_pt[64];
+            NL_TEST_ASSERT(inSuite, vector->pt_len <= sizeof(out_ct));
+
+            CHIP_ERROR err = encryptor.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len,
+                                               out_ct, out_tag, vector->tag_len);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(out_ct, vector->ct, vector->ct_len) == 0);
+            NL_TEST_ASSERT(inSuite, memcmp(out_tag, vector->tag, vector->tag_len) == 0);
+
+            // A forged tag in between must not disturb the following messages.
+            out_tag[0] ^= 1;
+            err = decryptor.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, out_tag, vector->tag_len, vector->iv,
+                                    vector->iv_len, out_pt);
+            NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INTERNAL);
+
+            err = decryptor.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                    vector->iv, vector->iv_len, out_pt);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(out_pt, vector->pt, vector->pt_len) == 0);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
+}
+
+static void TestAES_CCM_128CipherInvalidParams(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+    const ccm_128_test_vector * vector = ccm_128_test_vectors[0];
+    uint8_t out[64];
+    uint8_t tag[16];
+
+    AES_CCM_Cipher cipher;
+    NL_TEST_ASSERT(inSuite, !cipher.IsInitialized());
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len, out, tag,
+                                  vector->tag_len) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Init(AES_CCM_Cipher::Direction::kEncrypt, nullptr, vector->key_len, vector->iv_len, vector->tag_len) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Init(AES_CCM_Cipher::Direction::kEncrypt, vector->key, vector->key_len, vector->iv_len, 13) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, !cipher.IsInitialized());
+
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Init(AES_CCM_Cipher::Direction::kEncrypt, vector->key, vector->key_len, vector->iv_len,
+                               vector->tag_len) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cipher.IsInitialized());
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Init(AES_CCM_Cipher::Direction::kEncrypt, vector->key, vector->key_len, vector->iv_len,
+                               vector->tag_len) == CHIP_ERROR_INCORRECT_STATE);
+
+    // Direction, nonce and tag length are fixed by Init.
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                  vector->iv, vector->iv_len, out) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len - 1, out,
+                                  tag, vector->tag_len) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len, out, tag,
+                                  vector->tag_len + 4) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(vector->pt, 0, vector->aad, vector->aad_len, vector->iv, vector->iv_len, out, tag,
+                                  vector->tag_len) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    cipher.Clear();
+    NL_TEST_ASSERT(inSuite, !cipher.IsInitialized());
+    NL_TEST_ASSERT(inSuite,
+                   cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, vector->iv_len, out, tag,
+                                  vector->tag_len) == CHIP_ERROR_INCORRECT_STATE);
+}
+
 static void TestAsn1Conversions(nlTestSuite * inSuite, void * inContext)
 {
     HeapChecker heapChecker(inSuite);
@@ -2056,6 +2157,8 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test decrypting AES-CCM-128 invalid ct", TestAES_CCM_128DecryptInvalidCipherText),
     NL_TEST_DEF("Test decrypting AES-CCM-128 invalid key", TestAES_CCM_128DecryptInvalidKey),
     NL_TEST_DEF("Test decrypting AES-CCM-128 invalid IV", TestAES_CCM_128DecryptInvalidIVLen),
+    NL_TEST_DEF("Test AES-CCM-128 pre-keyed cipher test vectors", TestAES_CCM_128CipherTestVectors),
+    NL_TEST_DEF("Test AES-CCM-128 pre-keyed cipher invalid parameters", TestAES_CCM_128CipherInvalidParams),
     NL_TEST_DEF("Test encrypting AES-CCM-256 test vectors", TestAES_CCM_256EncryptTestVectors),
     NL_TEST_DEF("Test decrypting AES-CCM-256 test vectors", TestAES_CCM_256DecryptTestVectors),
     NL_TEST_DEF("Test encrypting AES-CCM-256 invalid plain text", TestAES_CCM_256EncryptInvalidPlainText),
@@ -576,6 +576,9 @@ void IPEndPointBasis::Init(InetLayer * aInetLayer)
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     mBoundIntfId = INET_NULL_INTERFACEID;
+#if INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+    mReceiveBufferCount = kMinReceiveBufferCount;
+#endif // INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 }
 
@@ -780,28 +783,41 @@ CHIP_ERROR IPEndPointBasis::BindInterface(IPAddressType aAddressType, InterfaceI
     return (lRetval);
 }
 
-CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle && aBuffer, uint16_t aSendFlags)
+namespace {
+
+/**
+ * Storage referenced by a struct msghdr built with BuildSendMsgHeader(); it must outlive the send.
+ */
+struct SendMsgStorage
+{
+    struct iovec mIOV;
+    PeerSockAddr mPeerSockAddr;
+    uint8_t mControlData[256];
+};
+
+CHIP_ERROR BuildSendMsgHeader(IPAddressType aAddrType, InterfaceId aBoundIntfId, const IPPacketInfo * aPktInfo,
+                              const chip::System::PacketBufferHandle & aBuffer, SendMsgStorage & aStorage,
+                              struct msghdr & msgHeader)
 {
     // Ensure the destination address type is compatible with the endpoint address type.
-    VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
     // For now the entire message must fit within a single buffer.
     VerifyOrReturnError(!aBuffer->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
-    struct iovec msgIOV;
-    msgIOV.iov_base = aBuffer->Start();
-    msgIOV.iov_len  = aBuffer->DataLength();
+    struct iovec & msgIOV = aStorage.mIOV;
+    msgIOV.iov_base       = aBuffer->Start();
+    msgIOV.iov_len        = aBuffer->DataLength();
 
-    struct msghdr msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
     msgHeader.msg_iov    = &msgIOV;
     msgHeader.msg_iovlen = 1;
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    PeerSockAddr peerSockAddr;
+    PeerSockAddr & peerSockAddr = aStorage.mPeerSockAddr;
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
-    if (mAddrType == kIPAddressType_IPv6)
+    if (aAddrType == kIPAddressType_IPv6)
     {
         peerSockAddr.in6.sin6_family = AF_INET6;
         peerSockAddr.in6.sin6_port   = htons(aPktInfo->DestPort);
@@ -828,7 +844,7 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     // the socket being bound.
     InterfaceId intfId = aPktInfo->Interface;
     if (intfId == INET_NULL_INTERFACEID)
-        intfId = mBoundIntfId;
+        intfId = aBoundIntfId;
 
     // If the packet should be sent over a specific interface, or with a specific source
     // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
@@ -837,16 +853,16 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     if (intfId != INET_NULL_INTERFACEID || aPktInfo->SrcAddress.Type() != kIPAddressType_Any)
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        uint8_t controlData[256];
-        memset(controlData, 0, sizeof(controlData));
+        uint8_t * controlData = aStorage.mControlData;
+        memset(controlData, 0, sizeof(aStorage.mControlData));
         msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        msgHeader.msg_controllen = sizeof(aStorage.mControlData);
 
         struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader);
 
 #if INET_CONFIG_ENABLE_IPV4
 
-        if (mAddrType == kIPAddressType_IPv4)
+        if (aAddrType == kIPAddressType_IPv4)
         {
 #if defined(IP_PKTINFO)
             controlHdr->cmsg_level = IPPROTO_IP;
@@ -870,7 +886,7 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
 
 #endif // INET_CONFIG_ENABLE_IPV4
 
-        if (mAddrType == kIPAddressType_IPv6)
+        if (aAddrType == kIPAddressType_IPv6)
         {
 #if defined(IPV6_PKTINFO)
             controlHdr->cmsg_level = IPPROTO_IPV6;
@@ -896,6 +912,17 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
 #endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
     }
 
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle && aBuffer, uint16_t aSendFlags)
+{
+    SendMsgStorage storage;
+    struct msghdr msgHeader;
+    ReturnErrorOnFailure(BuildSendMsgHeader(mAddrType, mBoundIntfId, aPktInfo, aBuffer, storage, msgHeader));
+
     // Send IP packet.
     const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
     if (lenSent == -1)
@@ -905,6 +932,63 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     return CHIP_NO_ERROR;
 }
 
+#if INET_CONFIG_UDP_SEND_BATCH_SIZE > 1 && HAVE_SENDMMSG
+CHIP_ERROR IPEndPointBasis::SendMsgs(const IPPacketInfo * aPktInfos, chip::System::PacketBufferHandle * aBuffers, size_t aCount,
+                                     size_t & aNumSent)
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SEND_BATCH_SIZE;
+
+    SendMsgStorage lStorage[kBatchSize];
+    struct mmsghdr lMsgHeaders[kBatchSize];
+
+    aNumSent = 0;
+
+    while (aNumSent < aCount)
+    {
+        // Build headers for as many of the remaining messages as fit in one batch, stopping at the first one that cannot be
+        // sent so that the messages before it still go out in order.
+        CHIP_ERROR lBuildStatus = CHIP_NO_ERROR;
+        size_t lNumBuilt        = 0;
+
+        while (lNumBuilt < kBatchSize && aNumSent + lNumBuilt < aCount)
+        {
+            const size_t lIndex = aNumSent + lNumBuilt;
+
+            lBuildStatus = BuildSendMsgHeader(mAddrType, mBoundIntfId, &aPktInfos[lIndex], aBuffers[lIndex], lStorage[lNumBuilt],
+                                              lMsgHeaders[lNumBuilt].msg_hdr);
+            if (lBuildStatus != CHIP_NO_ERROR)
+                break;
+
+            lMsgHeaders[lNumBuilt].msg_len = 0;
+            lNumBuilt++;
+        }
+
+        if (lNumBuilt == 0)
+            return lBuildStatus;
+
+        const int lNumSent = sendmmsg(mSocket, lMsgHeaders, static_cast<unsigned int>(lNumBuilt), 0);
+        if (lNumSent == -1)
+            return CHIP_ERROR_POSIX(errno);
+
+        for (int i = 0; i < lNumSent; i++)
+        {
+            // As with a build failure, a short send leaves aNumSent at the failing message and its buffer to the caller.
+            if (lMsgHeaders[i].msg_len != aBuffers[aNumSent]->DataLength())
+                return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+
+            aBuffers[aNumSent] = nullptr;
+            aNumSent++;
+        }
+
+        // A short count means the kernel stopped at a message it could not send; retrying from there reports its error.
+        if (static_cast<size_t>(lNumSent) == lNumBuilt && lBuildStatus != CHIP_NO_ERROR)
+            return lBuildStatus;
+    }
+
+    return CHIP_NO_ERROR;
+}
+#endif // INET_CONFIG_UDP_SEND_BATCH_SIZE > 1 && HAVE_SENDMMSG
+
 CHIP_ERROR IPEndPointBasis::GetSocket(IPAddressType aAddressType, int aType, int aProtocol)
 {
     if (mSocket == INET_INVALID_SOCKET_FD)
@@ -1016,6 +1100,223 @@ CHIP_ERROR IPEndPointBasis::GetSocket(IPAddressType aAddressType, int aType, int
     return CHIP_NO_ERROR;
 }
 
+namespace {
+
+/**
+ *  Fill in the source and destination of a received datagram from its peer address and ancillary data.
+ */
+CHIP_ERROR DecodeReceivedPacketInfo(struct msghdr & msgHeader, const PeerSockAddr & peerSockAddr, IPPacketInfo & packetInfo)
+{
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress::FromIPv6(peerSockAddr.in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress::FromIPv4(peerSockAddr.in.sin_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            struct in_pktinfo * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = static_cast<InterfaceId>(inPktInfo->ipi_ifindex);
+            packetInfo.DestAddress = IPAddress::FromIPv4(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            struct in6_pktinfo * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = static_cast<InterfaceId>(in6PktInfo->ipi6_ifindex);
+            packetInfo.DestAddress = IPAddress::FromIPv6(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+#if INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+
+IPEndPointBasis::ReceiveBatchStatistics IPEndPointBasis::sReceiveBatchStatistics;
+
+void IPEndPointBasis::ReleaseReceiveBuffers()
+{
+    for (System::PacketBufferHandle & buffer : mReceiveBuffers)
+    {
+        buffer = nullptr;
+    }
+}
+
+void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
+{
+    constexpr unsigned int kBatchSize = INET_CONFIG_UDP_RECV_BATCH_SIZE;
+
+    struct iovec lIOVs[kBatchSize];
+    PeerSockAddr lPeerSockAddrs[kBatchSize];
+    uint8_t lControlData[kBatchSize][256];
+    struct mmsghdr lMsgHeaders[kBatchSize];
+
+    // Reuse the spare buffer left over from the previous wakeup and allocate the others, so that a single recvmmsg() can fill
+    // as many of them as there are datagrams queued.
+    unsigned int lNumAllocated = 0;
+    for (; lNumAllocated < mReceiveBufferCount; lNumAllocated++)
+    {
+        System::PacketBufferHandle & lBuffer = mReceiveBuffers[lNumAllocated];
+        if (lBuffer.IsNull())
+        {
+            lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (lBuffer.IsNull())
+            {
+                break;
+            }
+        }
+        else
+        {
+            // Kept as the spare, unused or holding a datagram that was rejected.
+            lBuffer->SetDataLength(0);
+        }
+
+        lIOVs[lNumAllocated].iov_base = lBuffer->Start();
+        lIOVs[lNumAllocated].iov_len  = lBuffer->AvailableDataLength();
+
+        memset(&lPeerSockAddrs[lNumAllocated], 0, sizeof(lPeerSockAddrs[lNumAllocated]));
+        memset(&lMsgHeaders[lNumAllocated], 0, sizeof(lMsgHeaders[lNumAllocated]));
+
+        struct msghdr & msgHeader = lMsgHeaders[lNumAllocated].msg_hdr;
+        msgHeader.msg_name        = &lPeerSockAddrs[lNumAllocated];
+        msgHeader.msg_namelen     = sizeof(lPeerSockAddrs[lNumAllocated]);
+        msgHeader.msg_iov         = &lIOVs[lNumAllocated];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = lControlData[lNumAllocated];
+        msgHeader.msg_controllen  = sizeof(lControlData[lNumAllocated]);
+    }
+
+    if (lNumAllocated == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int lNumReceived = recvmmsg(mSocket, lMsgHeaders, lNumAllocated, MSG_DONTWAIT, nullptr);
+    if (lNumReceived <= 0)
+    {
+        const CHIP_ERROR lStatus = (lNumReceived < 0) ? CHIP_ERROR_POSIX(errno) : CHIP_ERROR_POSIX(EAGAIN);
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+        return;
+    }
+
+    sReceiveBatchStatistics.mBatches++;
+    sReceiveBatchStatistics.mDatagrams += static_cast<uint32_t>(lNumReceived);
+    sReceiveBatchStatistics.mBatchSizeCounts[lNumReceived - 1]++;
+
+    // More datagrams may be waiting when all the buffers were filled: use more of them from now on. Use fewer again once
+    // batches no longer fill half of them.
+    if (static_cast<unsigned int>(lNumReceived) == mReceiveBufferCount && mReceiveBufferCount < kBatchSize)
+    {
+        mReceiveBufferCount = (2 * mReceiveBufferCount < kBatchSize) ? 2 * mReceiveBufferCount : kBatchSize;
+    }
+    else if (2 * static_cast<unsigned int>(lNumReceived) <= mReceiveBufferCount && mReceiveBufferCount > kMinReceiveBufferCount)
+    {
+        mReceiveBufferCount /= 2;
+    }
+
+    // Prevent the end point from being freed while in the middle of a callback.
+    Retain();
+
+    for (int i = 0; i < lNumReceived; i++)
+    {
+        // An earlier callback may have closed the endpoint; drop the rest of the batch.
+        if (mState != kState_Listening || OnMessageReceived == nullptr)
+        {
+            break;
+        }
+
+        IPPacketInfo lPacketInfo;
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort = aPort;
+
+        CHIP_ERROR lStatus                   = CHIP_NO_ERROR;
+        struct msghdr & msgHeader            = lMsgHeaders[i].msg_hdr;
+        const unsigned int rcvLen            = lMsgHeaders[i].msg_len;
+        System::PacketBufferHandle & lBuffer = mReceiveBuffers[i];
+
+        if ((msgHeader.msg_flags & MSG_TRUNC) || rcvLen > lBuffer->AvailableDataLength())
+        {
+            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+        }
+        else
+        {
+            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+            lStatus = DecodeReceivedPacketInfo(msgHeader, lPeerSockAddrs[i], lPacketInfo);
+        }
+
+        if (lStatus == CHIP_NO_ERROR)
+        {
+            // Take the buffer out of the reserve even if the callback does not consume it.
+            System::PacketBufferHandle lMessage = std::move(lBuffer);
+            lMessage.RightSize();
+            OnMessageReceived(this, std::move(lMessage), &lPacketInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+    }
+
+    // Keep a single spare buffer for the next wakeup, so that an idle endpoint does not hold on to a whole batch of them.
+    bool lKeptSpare = false;
+    for (System::PacketBufferHandle & lBuffer : mReceiveBuffers)
+    {
+        if (lBuffer.IsNull())
+        {
+            continue;
+        }
+        if (lKeptSpare)
+        {
+            lBuffer = nullptr;
+        }
+        lKeptSpare = true;
+    }
+
+    Release();
+}
+
+#else // INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+
 void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
 {
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
@@ -1061,62 +1362,7 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress::FromIPv6(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress::FromIPv4(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    struct in_pktinfo * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = static_cast<InterfaceId>(inPktInfo->ipi_ifindex);
-                    lPacketInfo.DestAddress = IPAddress::FromIPv4(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    struct in6_pktinfo * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = static_cast<InterfaceId>(in6PktInfo->ipi6_ifindex);
-                    lPacketInfo.DestAddress = IPAddress::FromIPv6(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = DecodeReceivedPacketInfo(msgHeader, lPeerSockAddr, lPacketInfo);
         }
     }
     else
@@ -1137,6 +1383,8 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
         }
     }
 }
+
+#endif // INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
@@ -111,6 +111,24 @@ public:
     CHIP_ERROR JoinMulticastGroup(InterfaceId aInterfaceId, const IPAddress & aAddress);
     CHIP_ERROR LeaveMulticastGroup(InterfaceId aInterfaceId, const IPAddress & aAddress);
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+    /**
+     * Counters describing batched datagram reception across all endpoints.
+     */
+    struct ReceiveBatchStatistics
+    {
+        /** Number of recvmmsg() calls that returned at least one datagram. */
+        uint32_t mBatches;
+        /** Total number of datagrams received in batches. */
+        uint32_t mDatagrams;
+        /** Histogram of batch sizes: element i counts batches of i + 1 datagrams. */
+        uint32_t mBatchSizeCounts[INET_CONFIG_UDP_RECV_BATCH_SIZE];
+    };
+
+    static const ReceiveBatchStatistics & GetReceiveBatchStatistics() { return sReceiveBatchStatistics; }
+    static void ResetReceiveBatchStatistics() { sReceiveBatchStatistics = ReceiveBatchStatistics(); }
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+
 protected:
     void Init(InetLayer * aInetLayer);
 
@@ -138,8 +156,25 @@ protected:
     CHIP_ERROR Bind(IPAddressType aAddressType, const IPAddress & aAddress, uint16_t aPort, InterfaceId aInterfaceId);
     CHIP_ERROR BindInterface(IPAddressType aAddressType, InterfaceId aInterfaceId);
     CHIP_ERROR SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle && aBuffer, uint16_t aSendFlags);
+#if INET_CONFIG_UDP_SEND_BATCH_SIZE > 1 && HAVE_SENDMMSG
+    CHIP_ERROR SendMsgs(const IPPacketInfo * aPktInfos, chip::System::PacketBufferHandle * aBuffers, size_t aCount,
+                        size_t & aNumSent);
+#endif // INET_CONFIG_UDP_SEND_BATCH_SIZE > 1 && HAVE_SENDMMSG
     CHIP_ERROR GetSocket(IPAddressType aAddressType, int aType, int aProtocol);
     void HandlePendingIO(uint16_t aPort);
+
+#if INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+    void ReleaseReceiveBuffers();
+
+    static ReceiveBatchStatistics sReceiveBatchStatistics;
+
+    static constexpr unsigned int kMinReceiveBufferCount = 2;
+
+    // Buffers for recvmmsg(). The first mReceiveBufferCount entries are used, a count that doubles while batches fill all of
+    // them and halves when they fill no more than half. At most one unused buffer is kept between wakeups.
+    System::PacketBufferHandle mReceiveBuffers[INET_CONFIG_UDP_RECV_BATCH_SIZE];
+    unsigned int mReceiveBufferCount;
+#endif // INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
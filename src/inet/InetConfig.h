@@ -418,4 +418,42 @@
 #ifndef INET_CONFIG_IP_MULTICAST_HOP_LIMIT
 #define INET_CONFIG_IP_MULTICAST_HOP_LIMIT                 (64)
 #endif // INET_CONFIG_IP_MULTICAST_HOP_LIMIT
+
+/**
+ *  @def INET_CONFIG_UDP_RECV_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams a UDP endpoint drains from its
+ *    socket per readiness event.
+ *
+ *  @details
+ *    When greater than 1 on platforms that provide recvmmsg()
+ *    (HAVE_RECVMMSG), each readiness event receives up to this many
+ *    datagrams with a single system call, into packet buffers
+ *    allocated up front, and delivers them in order through
+ *    OnMessageReceived. A value of 1 receives one datagram per event
+ *    with recvmsg().
+ */
+#ifndef INET_CONFIG_UDP_RECV_BATCH_SIZE
+#define INET_CONFIG_UDP_RECV_BATCH_SIZE                    1
+#endif // INET_CONFIG_UDP_RECV_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_UDP_SEND_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams a UDP endpoint hands to the
+ *    kernel with a single system call in UDPEndPoint::SendMsgs().
+ *
+ *  @details
+ *    When greater than 1 on platforms that provide sendmmsg()
+ *    (HAVE_SENDMMSG), UDPEndPoint::SendMsgs() transmits up to this
+ *    many datagrams per system call. Otherwise, it falls back to one
+ *    sendmsg() per datagram. This value also bounds the number of
+ *    outgoing messages the UDP transport queues within one event
+ *    loop iteration before flushing them.
+ */
+#ifndef INET_CONFIG_UDP_SEND_BATCH_SIZE
+#define INET_CONFIG_UDP_SEND_BATCH_SIZE                    1
+#endif // INET_CONFIG_UDP_SEND_BATCH_SIZE
 // clang-format on
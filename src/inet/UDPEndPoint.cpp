@@ -399,6 +399,10 @@ void UDPEndPoint::Close()
             mSocket = INET_INVALID_SOCKET_FD;
         }
 
+#if INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+        ReleaseReceiveBuffers();
+#endif // INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
         if (mReadableSource)
         {
@@ -660,6 +664,60 @@ exit:
     return res;
 }
 
+/**
+ * @brief   Send a sequence of UDP messages to specified destinations.
+ *
+ * @param[in]   pktInfos    source and destination information for each UDP message
+ * @param[in]   msgs        packet buffers containing the UDP messages
+ * @param[in]   count       number of entries in \c pktInfos and \c msgs
+ * @param[out]  numSent     number of leading messages that were queued for transmit
+ *
+ * @retval  CHIP_NO_ERROR
+ *      success: all \c count messages are queued for transmit.
+ *
+ * @retval  other
+ *      an error returned by SendMsg() for message \c numSent.
+ *
+ * @details
+ *      Messages are sent in order, as if by calling SendMsg() for each of them, stopping at the first
+ *      message that fails. The buffers of messages that were sent are released. Where the platform
+ *      supports it (see INET_CONFIG_UDP_SEND_BATCH_SIZE), up to INET_CONFIG_UDP_SEND_BATCH_SIZE messages
+ *      are handed to the kernel with a single sendmmsg() call.
+ */
+CHIP_ERROR UDPEndPoint::SendMsgs(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t count, size_t & numSent)
+{
+    numSent = 0;
+    VerifyOrReturnError(count > 0, CHIP_NO_ERROR);
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_SEND_BATCH_SIZE > 1 && HAVE_SENDMMSG
+    CHIP_ERROR res = CHIP_NO_ERROR;
+
+    INET_FAULT_INJECT(FaultInjection::kFault_Send, return INET_ERROR_UNKNOWN_INTERFACE;);
+    INET_FAULT_INJECT(FaultInjection::kFault_SendNonCritical, return CHIP_ERROR_NO_MEMORY;);
+
+    // Make sure we have the appropriate type of socket based on the
+    // destination address. Messages whose destination does not match
+    // it are rejected by IPEndPointBasis::SendMsgs().
+    res = GetSocket(pktInfos[0].DestAddress.Type());
+    if (res == CHIP_NO_ERROR)
+    {
+        res = IPEndPointBasis::SendMsgs(pktInfos, msgs, count, numSent);
+    }
+
+    CHIP_SYSTEM_FAULT_INJECT_ASYNC_EVENT();
+
+    return res;
+#else  // !(CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_SEND_BATCH_SIZE > 1 && HAVE_SENDMMSG)
+    for (; numSent < count; numSent++)
+    {
+        ReturnErrorOnFailure(SendMsg(&pktInfos[numSent], std::move(msgs[numSent])));
+        msgs[numSent] = nullptr;
+    }
+
+    return CHIP_NO_ERROR;
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_SEND_BATCH_SIZE > 1 && HAVE_SENDMMSG
+}
+
 /**
  * @brief   Bind the endpoint to a network interface.
  *
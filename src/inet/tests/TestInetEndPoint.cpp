@@ -47,6 +47,12 @@
 
 #include <nlunit-test.h>
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+
 #include "TestInetCommon.h"
 #include "TestSetupSignalling.h"
 
@@ -450,6 +456,130 @@ static void TestInetEndPointLimit(nlTestSuite * inSuite, void * inContext)
 }
 #endif
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+// Test batched reception of datagrams queued on a loopback UDP endpoint
+namespace {
+
+constexpr uint8_t kBatchDatagramCount  = 2 * INET_CONFIG_UDP_RECV_BATCH_SIZE + 3;
+constexpr uint8_t kNoCloseIndex        = UINT8_MAX;
+constexpr size_t kOversizedDatagramLen = PacketBuffer::kMaxSizeWithoutReserve + 1;
+
+struct BatchReceiveState
+{
+    nlTestSuite * mSuite;
+    uint8_t mNextIndex;
+    uint8_t mCloseAfterIndex;
+    unsigned int mErrorCount;
+    CHIP_ERROR mLastError;
+};
+
+BatchReceiveState sBatchState;
+
+void HandleBatchMessage(IPEndPointBasis * aEndPoint, PacketBufferHandle && aBuffer, const IPPacketInfo * aPktInfo)
+{
+    // Datagrams carry their index, and must be delivered in the order they were sent.
+    NL_TEST_ASSERT(sBatchState.mSuite, aBuffer->DataLength() == 1);
+    NL_TEST_ASSERT(sBatchState.mSuite, aBuffer->Start()[0] == sBatchState.mNextIndex);
+    NL_TEST_ASSERT(sBatchState.mSuite, aEndPoint->mState == IPEndPointBasis::kState_Listening);
+
+    if (sBatchState.mNextIndex++ == sBatchState.mCloseAfterIndex)
+    {
+        static_cast<UDPEndPoint *>(aEndPoint)->Close();
+    }
+}
+
+void HandleBatchReceiveError(IPEndPointBasis * aEndPoint, CHIP_ERROR aError, const IPPacketInfo * aPktInfo)
+{
+    sBatchState.mErrorCount++;
+    sBatchState.mLastError = aError;
+}
+
+// Sends the datagrams with a plain socket, as an oversized one cannot be built from a PacketBuffer.
+bool SendBatchDatagram(int aSocket, uint16_t aPort, const uint8_t * aData, size_t aDataLen)
+{
+    struct sockaddr_in6 lAddr;
+    memset(&lAddr, 0, sizeof(lAddr));
+    lAddr.sin6_family = AF_INET6;
+    lAddr.sin6_port   = htons(aPort);
+    lAddr.sin6_addr   = in6addr_loopback;
+
+    return sendto(aSocket, aData, aDataLen, 0, reinterpret_cast<struct sockaddr *>(&lAddr), sizeof(lAddr)) ==
+        static_cast<ssize_t>(aDataLen);
+}
+
+void StartBatchReceive(nlTestSuite * inSuite, UDPEndPoint *& aEndPoint, uint8_t aCloseAfterIndex)
+{
+    IPAddress lLoopback;
+    NL_TEST_ASSERT(inSuite, IPAddress::FromString("::1", lLoopback));
+
+    sBatchState                  = BatchReceiveState();
+    sBatchState.mSuite           = inSuite;
+    sBatchState.mCloseAfterIndex = aCloseAfterIndex;
+
+    NL_TEST_ASSERT(inSuite, gInet.NewUDPEndPoint(&aEndPoint) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, aEndPoint->Bind(kIPAddressType_IPv6, lLoopback, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, aEndPoint->Listen(HandleBatchMessage, HandleBatchReceiveError) == CHIP_NO_ERROR);
+}
+
+void ServiceBatchReceive(uint8_t aExpectedCount)
+{
+    for (int i = 0; i < 100 && sBatchState.mNextIndex < aExpectedCount; i++)
+    {
+        ServiceEvents(10);
+    }
+}
+
+} // namespace
+
+static void TestInetUDPReceiveBatch(nlTestSuite * inSuite, void * inContext)
+{
+    UDPEndPoint * testUDPEP = nullptr;
+    uint8_t oversized[kOversizedDatagramLen];
+    const uint8_t kTruncatedAfterIndex = INET_CONFIG_UDP_RECV_BATCH_SIZE / 2;
+
+    int sendSocket = socket(AF_INET6, SOCK_DGRAM, 0);
+    NL_TEST_ASSERT(inSuite, sendSocket >= 0);
+    memset(oversized, 0xA5, sizeof(oversized));
+
+    // All the datagrams are queued before the endpoint gets to read any, so that they are received in batches, and one too
+    // large for a receive buffer is reported without stopping the rest of its batch.
+    StartBatchReceive(inSuite, testUDPEP, kNoCloseIndex);
+    IPEndPointBasis::ResetReceiveBatchStatistics();
+    for (uint8_t i = 0; i < kBatchDatagramCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, SendBatchDatagram(sendSocket, testUDPEP->GetBoundPort(), &i, 1));
+        if (i == kTruncatedAfterIndex)
+        {
+            NL_TEST_ASSERT(inSuite, SendBatchDatagram(sendSocket, testUDPEP->GetBoundPort(), oversized, sizeof(oversized)));
+        }
+    }
+
+    ServiceBatchReceive(kBatchDatagramCount);
+    NL_TEST_ASSERT(inSuite, sBatchState.mNextIndex == kBatchDatagramCount);
+    NL_TEST_ASSERT(inSuite, sBatchState.mErrorCount == 1);
+    NL_TEST_ASSERT(inSuite, sBatchState.mLastError == CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG);
+
+    const IPEndPointBasis::ReceiveBatchStatistics & stats = IPEndPointBasis::GetReceiveBatchStatistics();
+    NL_TEST_ASSERT(inSuite, stats.mDatagrams == kBatchDatagramCount + 1);
+    NL_TEST_ASSERT(inSuite, stats.mBatches < stats.mDatagrams);
+    testUDPEP->Free();
+
+    // Closing the endpoint from a callback drops the rest of the batch.
+    StartBatchReceive(inSuite, testUDPEP, kTruncatedAfterIndex);
+    for (uint8_t i = 0; i < kBatchDatagramCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, SendBatchDatagram(sendSocket, testUDPEP->GetBoundPort(), &i, 1));
+    }
+
+    ServiceBatchReceive(kBatchDatagramCount);
+    NL_TEST_ASSERT(inSuite, sBatchState.mNextIndex == kTruncatedAfterIndex + 1);
+    NL_TEST_ASSERT(inSuite, sBatchState.mErrorCount == 0);
+    testUDPEP->Free();
+
+    close(sendSocket);
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+
 // Test Suite
 
 /**
@@ -463,6 +593,9 @@ static const nlTest sTests[] = { NL_TEST_DEF("InetEndPoint::PreTest", TestInetPr
                                  NL_TEST_DEF("InetEndPoint::TestInetError", TestInetError),
                                  NL_TEST_DEF("InetEndPoint::TestInetInterface", TestInetInterface),
                                  NL_TEST_DEF("InetEndPoint::TestInetEndPoint", TestInetEndPointInternal),
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
+                                 NL_TEST_DEF("InetEndPoint::TestUDPReceiveBatch", TestInetUDPReceiveBatch),
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_UDP_RECV_BATCH_SIZE > 1 && HAVE_RECVMMSG
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
                                  NL_TEST_DEF("InetEndPoint::TestEndPointLimit", TestInetEndPointLimit),
 #endif
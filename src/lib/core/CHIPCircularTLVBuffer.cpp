@@ -109,6 +109,29 @@ void CHIPCircularTLVBuffer::Init(uint8_t * inBuffer, uint32_t inBufferLength)
     mImplicitProfileId = kCommonProfileId;
 }
 
+/**
+ * @brief
+ *   Takes over the elements already present in the backing store, e.g. when the backing store is persisted across restarts.
+ *
+ * @param[in] inHeadOffset   Offset of the oldest element from the start of the backing store
+ *
+ * @param[in] inDataLength   Length, in bytes, of the elements present in the backing store
+ *
+ *  @retval #CHIP_NO_ERROR                On success.
+ *
+ *  @retval #CHIP_ERROR_INVALID_ARGUMENT  The data would not fit in the backing store; the queue is left unchanged.
+ */
+CHIP_ERROR CHIPCircularTLVBuffer::Restore(uint32_t inHeadOffset, uint32_t inDataLength)
+{
+    VerifyOrReturnError(inDataLength <= mQueueSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(inHeadOffset < mQueueSize || (inHeadOffset == 0 && mQueueSize == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mQueueHead   = mQueue + inHeadOffset;
+    mQueueLength = inDataLength;
+
+    return CHIP_NO_ERROR;
+}
+
 /**
  * @brief
  *   Evicts the oldest top-level TLV element in the CHIPCircularTLVBuffer
@@ -70,6 +70,8 @@ public:
 
     CHIP_ERROR EvictHead();
 
+    CHIP_ERROR Restore(uint32_t inHeadOffset, uint32_t inDataLength);
+
     // chip::TLV::TLVBackingStore overrides:
     CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
     CHIP_ERROR GetNextBuffer(TLVReader & ioReader, const uint8_t *& outBufStart, uint32_t & outBufLen) override;
@@ -1204,6 +1204,19 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP
+ *
+ *  @brief
+ *    Allocate exchange contexts from a HeapObjectPool that grows on
+ *    demand, rather than from a static pool of
+ *    CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS entries.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP
+#define CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP 0
+#endif // CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP
+
 /**
  *  @def CHIP_CONFIG_MAX_ACTIVE_CHANNELS
  *
@@ -2274,6 +2287,17 @@
 #define CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE 16
 #endif // CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_PEER_CONNECTION_POOL_USE_HEAP
+ *
+ * @brief Allocate the CHIP Peer connection states from a HeapObjectPool
+ * that grows on demand, so that the number of concurrent secure sessions
+ * is not limited by CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE.
+ */
+#ifndef CHIP_CONFIG_PEER_CONNECTION_POOL_USE_HEAP
+#define CHIP_CONFIG_PEER_CONNECTION_POOL_USE_HEAP 0
+#endif // CHIP_CONFIG_PEER_CONNECTION_POOL_USE_HEAP
+
 /**
  * @def CHIP_PEER_CONNECTION_TIMEOUT_MS
  *
@@ -2371,6 +2395,63 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #ifndef CHIP_CONFIG_MDNS_CACHE_SIZE
 #define CHIP_CONFIG_MDNS_CACHE_SIZE 20
 #endif
+
+/**
+ * @def CHIP_CONFIG_MDNS_CACHE_MAX_ADDRESSES_PER_PEER
+ *
+ * @brief
+ *      Define the maximum number of addresses kept for each node in the MDNS
+ *      cache, e.g. IPv6 and IPv4 addresses reachable on several interfaces.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_CACHE_MAX_ADDRESSES_PER_PEER
+#define CHIP_CONFIG_MDNS_CACHE_MAX_ADDRESSES_PER_PEER 4
+#endif
+
+/**
+ * @def CHIP_CONFIG_MDNS_RESOLVE_MAX_ACTIVE_QUERIES
+ *
+ * @brief
+ *      Define the maximum number of operational node resolutions whose mDNS
+ *      queries are retried by the minimal mDNS resolver at the same time.
+ *
+ *      Queries are retried with an exponential backoff until a response is
+ *      received. When more nodes are being resolved, the resolutions that were
+ *      retried the most stop being retried first.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_RESOLVE_MAX_ACTIVE_QUERIES
+#define CHIP_CONFIG_MDNS_RESOLVE_MAX_ACTIVE_QUERIES 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_MDNS_MAX_OPERATIONAL_NETWORKS
+ *
+ * @brief
+ *      Define the maximum number of operational networks (fabrics) the minimal
+ *      mDNS advertiser advertises the node on.
+ *
+ *      Ignored when CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP is set.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_MAX_OPERATIONAL_NETWORKS
+#define CHIP_CONFIG_MDNS_MAX_OPERATIONAL_NETWORKS 5
+#endif
+
+/**
+ * @def CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP
+ *
+ * @brief
+ *      Allocate the records the minimal mDNS advertiser replies with for each
+ *      operational network from the heap as networks are advertised, so that
+ *      the number of advertised networks is only limited by the available
+ *      memory rather than by CHIP_CONFIG_MDNS_MAX_OPERATIONAL_NETWORKS.
+ *
+ */
+#ifndef CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP
+#define CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP 0
+#endif
+
 /**
  *  @name Interaction Model object pool configuration.
  *
@@ -2383,8 +2464,10 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_MAX_NUM_READ_CLIENT
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
+ *      * #CHIP_IM_SERVER_INTEREST_INDEX_SIZE
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
+ *      * #CHIP_IM_SERVER_POOLS_USE_HEAP
  *
  *  @{
  */
@@ -2443,6 +2526,17 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_INTEREST_INDEX_SIZE
+ *
+ * @brief Defines the number of entries of the index the reporting engine uses to find the subscriptions interested in a
+ *        dirty attribute path. Every subscribed path takes up to two entries; once the index is full, dirty paths are
+ *        matched against every subscription.
+ */
+#ifndef CHIP_IM_SERVER_INTEREST_INDEX_SIZE
+#define CHIP_IM_SERVER_INTEREST_INDEX_SIZE (4 * CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS)
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -2461,6 +2555,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_WRITE_CLIENT 4
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_POOLS_USE_HEAP
+ *
+ * @brief Allocate the CommandHandler, ReadHandler and WriteHandler objects, and the path objects the server keeps, from the heap
+ *        as they are needed. The number of concurrent server transactions and subscribed attributes is then only limited by
+ *        the available memory, rather than by CHIP_IM_MAX_NUM_COMMAND_HANDLER, CHIP_IM_MAX_NUM_READ_HANDLER,
+ *        CHIP_IM_MAX_NUM_WRITE_HANDLER and CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS.
+ */
+#ifndef CHIP_IM_SERVER_POOLS_USE_HEAP
+#define CHIP_IM_SERVER_POOLS_USE_HEAP 0
+#endif
+
 /**
  * @def CHIP_DEVICE_CONTROLLER_SUBSCRIPTION_ATTRIBUTE_PATH_POOL_SIZE
  *
@@ -2470,6 +2576,16 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_DEVICE_CONTROLLER_SUBSCRIPTION_ATTRIBUTE_PATH_POOL_SIZE CHIP_IM_MAX_NUM_READ_CLIENT
 #endif
 
+/**
+ * @def CHIP_DEVICE_CONTROLLER_DEVICE_POOL_USE_HEAP
+ *
+ * @brief Allocate the active devices of a device controller from a HeapObjectPool that grows on demand, rather than from a
+ * static pool of 64 entries.
+ */
+#ifndef CHIP_DEVICE_CONTROLLER_DEVICE_POOL_USE_HEAP
+#define CHIP_DEVICE_CONTROLLER_DEVICE_POOL_USE_HEAP 0
+#endif
+
 /**
  * @def CHIP_CONFIG_LAMBDA_EVENT_SIZE
  *
@@ -1982,6 +1982,40 @@ public:
      * @return the total remaining number of bytes.
      */
     uint32_t GetRemainingFreeLength() const { return mRemainingLen; }
+
+    /**
+     * Reserve some of the remaining buffer space for fields that will be encoded later, so that the elements written in
+     * the meantime cannot use it up.
+     *
+     * @param[in] aBufferSize   The number of bytes to reserve.
+     *
+     * @retval #CHIP_NO_ERROR           If the space was successfully reserved.
+     * @retval #CHIP_ERROR_NO_MEMORY    If fewer than @p aBufferSize bytes remain in the buffer.
+     */
+    CHIP_ERROR ReserveBuffer(uint32_t aBufferSize)
+    {
+        VerifyOrReturnError(mRemainingLen >= aBufferSize, CHIP_ERROR_NO_MEMORY);
+        mReservedSize += aBufferSize;
+        mRemainingLen -= aBufferSize;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Release buffer space previously set aside with ReserveBuffer().
+     *
+     * @param[in] aBufferSize   The number of bytes to release.
+     *
+     * @retval #CHIP_NO_ERROR           If the space was successfully released.
+     * @retval #CHIP_ERROR_NO_MEMORY    If fewer than @p aBufferSize bytes are currently reserved.
+     */
+    CHIP_ERROR UnreserveBuffer(uint32_t aBufferSize)
+    {
+        VerifyOrReturnError(mReservedSize >= aBufferSize, CHIP_ERROR_NO_MEMORY);
+        mReservedSize -= aBufferSize;
+        mRemainingLen += aBufferSize;
+        return CHIP_NO_ERROR;
+    }
+
     /**
      * The profile id of tags that should be encoded in implicit form.
      *
@@ -2012,6 +2046,7 @@ protected:
     uint32_t mRemainingLen;
     uint32_t mLenWritten;
     uint32_t mMaxLen;
+    uint32_t mReservedSize;
     TLVType mContainerType;
 
 private:
@@ -57,6 +57,7 @@ NO_INLINE void TLVWriter::Init(uint8_t * buf, size_t maxLen)
     mRemainingLen           = actualMaxLen;
     mLenWritten             = 0;
     mMaxLen                 = actualMaxLen;
+    mReservedSize           = 0;
     mContainerType          = kTLVType_NotSpecified;
     SetContainerOpen(false);
     SetCloseContainerReserved(true);
@@ -76,6 +77,7 @@ CHIP_ERROR TLVWriter::Init(TLVBackingStore & backingStore, uint32_t maxLen)
     mWritePoint    = mBufStart;
     mLenWritten    = 0;
     mMaxLen        = maxLen;
+    mReservedSize  = 0;
     mContainerType = kTLVType_NotSpecified;
     SetContainerOpen(false);
     SetCloseContainerReserved(true);
@@ -478,6 +480,7 @@ CHIP_ERROR TLVWriter::OpenContainer(uint64_t tag, TLVType containerType, TLVWrit
     containerWriter.mRemainingLen  = mRemainingLen;
     containerWriter.mLenWritten    = 0;
     containerWriter.mMaxLen        = mMaxLen - mLenWritten;
+    containerWriter.mReservedSize  = mReservedSize;
     containerWriter.mContainerType = containerType;
     containerWriter.SetContainerOpen(false);
     containerWriter.SetCloseContainerReserved(IsCloseContainerReserved());
@@ -500,6 +503,7 @@ CHIP_ERROR TLVWriter::CloseContainer(TLVWriter & containerWriter)
     mBufStart     = containerWriter.mBufStart;
     mWritePoint   = containerWriter.mWritePoint;
     mRemainingLen = containerWriter.mRemainingLen;
+    mReservedSize = containerWriter.mReservedSize;
     mLenWritten += containerWriter.mLenWritten;
 
     if (IsCloseContainerReserved())
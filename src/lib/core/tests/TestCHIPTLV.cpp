@@ -3658,6 +3658,48 @@ static void CheckCloseContainerReserve(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+static void CheckReserveBuffer(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[16];
+    TLVWriter writer;
+    TLVType outerContainer;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite, writer.ReserveBuffer(sizeof(buf) + 1) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, writer.UnreserveBuffer(1) == CHIP_ERROR_NO_MEMORY);
+
+    // Two bytes kept back for a trailing boolean.
+    err = writer.ReserveBuffer(2);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetRemainingFreeLength() == sizeof(buf) - 2);
+
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The structure, a 10 byte integer and a 2 byte boolean fill what is left, with room kept for the end of container.
+    err = writer.Put(ContextTag(1), static_cast<uint64_t>(UINT64_MAX));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.PutBoolean(ContextTag(2), false);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    // A failed write may leave a partial element behind, so roll back to before it as the report builders do.
+    TLVWriter checkpoint = writer;
+    err                  = writer.PutBoolean(ContextTag(3), true);
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+    writer = checkpoint;
+
+    // The reserved space becomes usable once released.
+    err = writer.UnreserveBuffer(2);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.PutBoolean(ContextTag(3), true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(outerContainer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == sizeof(buf));
+}
+
 static CHIP_ERROR ReadFuzzedEncoding1(nlTestSuite * inSuite, TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4087,6 +4129,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV Skip non-contiguous",        CheckCHIPTLVSkipCircular),
     NL_TEST_DEF("CHIP TLV ByteSpan",                   CheckCHIPTLVByteSpan),
     NL_TEST_DEF("CHIP TLV Check reserve",              CheckCloseContainerReserve),
+    NL_TEST_DEF("CHIP TLV Reserve buffer",             CheckReserveBuffer),
     NL_TEST_DEF("CHIP TLV Reader Fuzz Test",           TLVReaderFuzzTest),
     NL_TEST_DEF("CHIP TLV GetStringView Test",         CheckGetStringView),
     NL_TEST_DEF("CHIP TLV GetByteView Test",           CheckGetByteView),
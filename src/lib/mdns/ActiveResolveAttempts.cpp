@@ -0,0 +1,193 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ActiveResolveAttempts.h"
+
+namespace chip {
+namespace Mdns {
+
+constexpr uint32_t kMsPerSec = 1000;
+
+void ActiveResolveAttempts::Reset()
+{
+    for (auto & entry : mRetryQueue)
+    {
+        entry.nextRetryDelaySec = 0;
+    }
+}
+
+void ActiveResolveAttempts::Complete(const PeerId & peerId)
+{
+    RetryEntry * entry = Find(peerId);
+    if (entry != nullptr)
+    {
+        entry->nextRetryDelaySec = 0;
+    }
+}
+
+bool ActiveResolveAttempts::MarkPending(const PeerId & peerId, Timestamp now)
+{
+    RetryEntry * existing = Find(peerId);
+    if (existing != nullptr)
+    {
+        // A caller now waits for this resolution, so it is no longer one that can be evicted first.
+        existing->isRefresh = false;
+        return false;
+    }
+
+    // Use a free entry if any, or else a refresh, or else the one that was retried the most.
+    RetryEntry * entryToUse = &mRetryQueue[0];
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.nextRetryDelaySec == 0)
+        {
+            entryToUse = &entry;
+            break;
+        }
+
+        if (entry.isRefresh != entryToUse->isRefresh)
+        {
+            if (entry.isRefresh)
+            {
+                entryToUse = &entry;
+            }
+            continue;
+        }
+
+        if (entry.nextRetryDelaySec > entryToUse->nextRetryDelaySec)
+        {
+            entryToUse = &entry;
+        }
+    }
+
+    Start(*entryToUse, peerId, now, false /* isRefresh */);
+    return true;
+}
+
+bool ActiveResolveAttempts::MarkRefreshPending(const PeerId & peerId, Timestamp now)
+{
+    if (Find(peerId) != nullptr)
+    {
+        return false;
+    }
+
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.nextRetryDelaySec == 0)
+        {
+            Start(entry, peerId, now, true /* isRefresh */);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ActiveResolveAttempts::Start(RetryEntry & entry, const PeerId & peerId, Timestamp now, bool isRefresh)
+{
+    entry.peerId            = peerId;
+    entry.nextRetryDelaySec = 1;
+    entry.queryDueTime      = now + kMsPerSec;
+    entry.isRefresh         = isRefresh;
+}
+
+bool ActiveResolveAttempts::IsPending(const PeerId & peerId) const
+{
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.nextRetryDelaySec != 0 && entry.peerId == peerId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ActiveResolveAttempts::GetTimeUntilNextRetry(Timestamp now, uint32_t & delayMs) const
+{
+    bool found = false;
+
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.nextRetryDelaySec == 0)
+        {
+            continue;
+        }
+
+        const uint32_t entryDelayMs = (entry.queryDueTime > now) ? static_cast<uint32_t>(entry.queryDueTime - now) : 0;
+        if (!found || entryDelayMs < delayMs)
+        {
+            delayMs = entryDelayMs;
+            found   = true;
+        }
+    }
+
+    return found;
+}
+
+bool ActiveResolveAttempts::NextScheduledPeer(Timestamp now, PeerId & peerId)
+{
+    // Earliest due entries go first.
+    RetryEntry * dueEntry = nullptr;
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.nextRetryDelaySec == 0 || entry.queryDueTime > now)
+        {
+            continue;
+        }
+
+        if (dueEntry == nullptr || entry.queryDueTime < dueEntry->queryDueTime)
+        {
+            dueEntry = &entry;
+        }
+    }
+
+    if (dueEntry == nullptr)
+    {
+        return false;
+    }
+
+    peerId = dueEntry->peerId;
+
+    dueEntry->nextRetryDelaySec *= 2;
+    if (dueEntry->nextRetryDelaySec > kMaxRetryDelaySec)
+    {
+        // This is the last retry: responses to it are still reported, but the query is not sent again.
+        dueEntry->nextRetryDelaySec = 0;
+    }
+    else
+    {
+        dueEntry->queryDueTime = now + dueEntry->nextRetryDelaySec * kMsPerSec;
+    }
+
+    return true;
+}
+
+ActiveResolveAttempts::RetryEntry * ActiveResolveAttempts::Find(const PeerId & peerId)
+{
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.nextRetryDelaySec != 0 && entry.peerId == peerId)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Mdns
+} // namespace chip
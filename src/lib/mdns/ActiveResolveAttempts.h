@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/PeerId.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Mdns {
+
+/// Keeps track of the operational node resolutions in progress, so that their
+/// queries are sent again with an exponential backoff (1s, 2s, 4s, ...) until
+/// a response is received or the backoff exceeds kMaxRetryDelaySec.
+///
+/// At most kRetryQueueSize resolutions are tracked at the same time. When the
+/// queue is full, a refresh of a cached node, or else the resolution with the
+/// longest backoff (i.e. the one that was retried the most without success),
+/// stops being retried to make room. Refreshes never make room for themselves.
+class ActiveResolveAttempts
+{
+public:
+    using Timestamp = System::Clock::MonotonicMilliseconds;
+
+    static constexpr size_t kRetryQueueSize     = CHIP_CONFIG_MDNS_RESOLVE_MAX_ACTIVE_QUERIES;
+    static constexpr uint32_t kMaxRetryDelaySec = 8;
+
+    ActiveResolveAttempts() { Reset(); }
+
+    /// Stops tracking all the resolutions.
+    void Reset();
+
+    /// Marks the resolution of the given peer as complete: its query is not
+    /// sent again.
+    void Complete(const PeerId & peerId);
+
+    /// Starts tracking the resolution of the given peer, whose query is sent
+    /// at time `now`. The first retry is due one second later.
+    ///
+    /// Returns false if the peer is already being resolved. Its retries are
+    /// then left as scheduled and the query does not need to be sent again.
+    bool MarkPending(const PeerId & peerId, Timestamp now);
+
+    /// Starts tracking the refresh of a cached peer, like MarkPending() but with
+    /// a lower priority: the refresh only takes a free entry.
+    ///
+    /// Returns false if the peer is already being resolved or if there is no
+    /// free entry, in which case the query does not need to be sent.
+    bool MarkRefreshPending(const PeerId & peerId, Timestamp now);
+
+    /// Returns whether the given peer is being resolved.
+    bool IsPending(const PeerId & peerId) const;
+
+    /// Gets the delay from `now` until the next retry is due (0 if a retry is
+    /// already due). Returns false if no resolution is in progress.
+    bool GetTimeUntilNextRetry(Timestamp now, uint32_t & delayMs) const;
+
+    /// Gets a peer whose query is due to be sent again at time `now`, and
+    /// schedules its next retry with twice the previous delay.
+    ///
+    /// Returns false if no retry is due.
+    bool NextScheduledPeer(Timestamp now, PeerId & peerId);
+
+private:
+    struct RetryEntry
+    {
+        PeerId peerId;
+        Timestamp queryDueTime;
+        uint32_t nextRetryDelaySec; // 0 if the entry is unused
+        bool isRefresh;             // refresh of a cached node rather than a resolution requested by a caller
+    };
+
+    RetryEntry * Find(const PeerId & peerId);
+    void Start(RetryEntry & entry, const PeerId & peerId, Timestamp now, bool isRefresh);
+
+    RetryEntry mRetryQueue[kRetryQueueSize];
+};
+
+} // namespace Mdns
+} // namespace chip
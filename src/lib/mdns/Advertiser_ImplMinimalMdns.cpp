@@ -33,6 +33,7 @@
 #include <lib/mdns/minimal/responders/Srv.h>
 #include <lib/mdns/minimal/responders/Txt.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/Pool.h>
 #include <lib/support/RandUtils.h>
 #include <lib/support/StringBuilder.h>
 
@@ -105,10 +106,6 @@ public:
     AdvertiserMinMdns() : mResponseSender(&GlobalMinimalMdnsServer::Server())
     {
         GlobalMinimalMdnsServer::Instance().SetQueryDelegate(this);
-        for (auto & allocator : mQueryResponderAllocatorOperational)
-        {
-            mResponseSender.AddQueryResponder(allocator.GetQueryResponder());
-        }
         mResponseSender.AddQueryResponder(mQueryResponderAllocatorCommissionable.GetQueryResponder());
         mResponseSender.AddQueryResponder(mQueryResponderAllocatorCommissioner.GetQueryResponder());
     }
@@ -140,7 +137,6 @@ private:
     bool ShouldAdvertiseOn(const chip::Inet::InterfaceId id, const chip::Inet::IPAddress & addr);
 
     FullQName GetCommissioningTxtEntries(const CommissionAdvertisingParameters & params);
-    FullQName GetOperationalTxtEntries(const OperationalAdvertisingParameters & params);
 
     struct CommonTxtEntryStorage
     {
@@ -218,15 +214,21 @@ private:
 
     // Max number of records for operational = PTR, SRV, TXT, A, AAAA, I subtype.
     static constexpr size_t kMaxOperationalRecords  = 6;
-    static constexpr size_t kMaxOperationalNetworks = 5;
-    QueryResponderAllocator<kMaxOperationalRecords> mQueryResponderAllocatorOperational[kMaxOperationalNetworks];
+    static constexpr size_t kMaxOperationalNetworks = CHIP_CONFIG_MDNS_MAX_OPERATIONAL_NETWORKS;
+    using OperationalAllocator                      = QueryResponderAllocator<kMaxOperationalRecords>;
+    // One allocator per advertised operational network, whose query responder is added to mResponseSender.
+    BitMapOrHeapObjectPool<OperationalAllocator, kMaxOperationalNetworks, CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP>
+        mQueryResponderAllocatorOperational;
     // Max number of records for commissionable = 7 x PTR (base + 6 sub types - _S, _L, _D, _T, _C, _A), SRV, TXT, A, AAAA
     static constexpr size_t kMaxCommissionRecords = 11;
     QueryResponderAllocator<kMaxCommissionRecords> mQueryResponderAllocatorCommissionable;
     QueryResponderAllocator<kMaxCommissionRecords> mQueryResponderAllocatorCommissioner;
 
-    QueryResponderAllocator<kMaxOperationalRecords> * FindOperationalAllocator(const FullQName & qname);
-    QueryResponderAllocator<kMaxOperationalRecords> * FindEmptyOperationalAllocator();
+    OperationalAllocator * FindOperationalAllocator(const FullQName & qname);
+    OperationalAllocator * CreateOperationalAllocator();
+    void ClearBroadcastThrottle();
+
+    FullQName GetOperationalTxtEntries(OperationalAllocator * allocator, const OperationalAdvertisingParameters & params);
 
     ResponseSender mResponseSender;
     uint32_t mCommissionInstanceName1;
@@ -234,6 +236,7 @@ private:
 
     // current request handling
     const chip::Inet::IPPacketInfo * mCurrentSource = nullptr;
+    const KnownAnswers * mCurrentKnownAnswers       = nullptr;
     uint32_t mMessageId                             = 0;
 
     const char * mEmptyTextEntries[1] = {
@@ -247,12 +250,21 @@ void AdvertiserMinMdns::OnMdnsPacketData(const BytesRange & data, const chip::In
     ChipLogDetail(Discovery, "MinMdns received a query.");
 #endif
 
-    mCurrentSource = info;
+    // Known answers follow the questions in the packet, so they are collected before replying to any question.
+    KnownAnswers knownAnswers(data);
+    if ((data.Size() >= HeaderRef::kSizeBytes) && (ConstHeaderRef(data.Start()).GetAnswerCount() != 0))
+    {
+        ParsePacket(data, &knownAnswers);
+    }
+
+    mCurrentSource       = info;
+    mCurrentKnownAnswers = &knownAnswers;
     if (!ParsePacket(data, this))
     {
         ChipLogError(Discovery, "Failed to parse mDNS query");
     }
-    mCurrentSource = nullptr;
+    mCurrentSource       = nullptr;
+    mCurrentKnownAnswers = nullptr;
 }
 
 void AdvertiserMinMdns::OnQuery(const QueryData & data)
@@ -265,7 +277,7 @@ void AdvertiserMinMdns::OnQuery(const QueryData & data)
 
     LogQuery(data);
 
-    CHIP_ERROR err = mResponseSender.Respond(mMessageId, data, mCurrentSource);
+    CHIP_ERROR err = mResponseSender.Respond(mMessageId, data, mCurrentSource, mCurrentKnownAnswers);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Discovery, "Failed to reply to query: %s", ErrorStr(err));
@@ -281,6 +293,8 @@ CHIP_ERROR AdvertiserMinMdns::Start(chip::Inet::InetLayer * inetLayer, uint16_t
     // Re-set the server in the response sender in case this has been swapped in the
     // GlobalMinimalMdnsServer (used for testing).
     mResponseSender.SetServer(&GlobalMinimalMdnsServer::Server());
+    // Multicast replies to browsing queries are delayed on the system layer, so that they can be aggregated.
+    mResponseSender.SetSystemLayer((inetLayer != nullptr) ? inetLayer->SystemLayer() : nullptr);
 
     ReturnErrorOnFailure(GlobalMinimalMdnsServer::Instance().StartServer(inetLayer, port));
 
@@ -294,38 +308,61 @@ CHIP_ERROR AdvertiserMinMdns::Start(chip::Inet::InetLayer * inetLayer, uint16_t
 /// Stops the advertiser.
 CHIP_ERROR AdvertiserMinMdns::StopPublishDevice()
 {
-    for (auto & allocator : mQueryResponderAllocatorOperational)
-    {
-        allocator.Clear();
-    }
+    mResponseSender.CancelPendingMulticast();
+
+    mQueryResponderAllocatorOperational.ForEachActiveObject([this](OperationalAllocator * allocator) {
+        mResponseSender.RemoveQueryResponder(allocator->GetQueryResponder());
+        mQueryResponderAllocatorOperational.ReleaseObject(allocator);
+        return true;
+    });
+#if CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP
+    // The advertiser outlives the memory allocator, give the heap back while it is still there.
+    mQueryResponderAllocatorOperational.ReleaseEmptyChunks();
+#endif // CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP
+
     mQueryResponderAllocatorCommissionable.Clear();
     mQueryResponderAllocatorCommissioner.Clear();
     return CHIP_NO_ERROR;
 }
 
-QueryResponderAllocator<AdvertiserMinMdns::kMaxOperationalRecords> *
-AdvertiserMinMdns::FindOperationalAllocator(const FullQName & qname)
+AdvertiserMinMdns::OperationalAllocator * AdvertiserMinMdns::FindOperationalAllocator(const FullQName & qname)
 {
-    for (auto & allocator : mQueryResponderAllocatorOperational)
-    {
-        if (allocator.GetResponder(QType::SRV, qname) != nullptr)
+    OperationalAllocator * found = nullptr;
+    mQueryResponderAllocatorOperational.ForEachActiveObject([&](OperationalAllocator * allocator) {
+        if (allocator->GetResponder(QType::SRV, qname) != nullptr)
         {
-            return &allocator;
+            found = allocator;
+            return false;
         }
-    }
-    return nullptr;
+        return true;
+    });
+    return found;
 }
 
-QueryResponderAllocator<AdvertiserMinMdns::kMaxOperationalRecords> * AdvertiserMinMdns::FindEmptyOperationalAllocator()
+AdvertiserMinMdns::OperationalAllocator * AdvertiserMinMdns::CreateOperationalAllocator()
 {
-    for (auto & allocator : mQueryResponderAllocatorOperational)
+    OperationalAllocator * allocator = mQueryResponderAllocatorOperational.CreateObject();
+    if (allocator == nullptr)
     {
-        if (allocator.IsEmpty())
-        {
-            return &allocator;
-        }
+        return nullptr;
     }
-    return nullptr;
+
+    if (mResponseSender.AddQueryResponder(allocator->GetQueryResponder()) != CHIP_NO_ERROR)
+    {
+        mQueryResponderAllocatorOperational.ReleaseObject(allocator);
+        return nullptr;
+    }
+    return allocator;
+}
+
+void AdvertiserMinMdns::ClearBroadcastThrottle()
+{
+    mQueryResponderAllocatorOperational.ForEachActiveObject([](OperationalAllocator * allocator) {
+        allocator->GetQueryResponder()->ClearBroadcastThrottle();
+        return true;
+    });
+    mQueryResponderAllocatorCommissionable.GetQueryResponder()->ClearBroadcastThrottle();
+    mQueryResponderAllocatorCommissioner.GetQueryResponder()->ClearBroadcastThrottle();
 }
 
 CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters & params)
@@ -344,7 +381,7 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
     }
     else
     {
-        operationalAllocator = FindEmptyOperationalAllocator();
+        operationalAllocator = CreateOperationalAllocator();
         if (operationalAllocator == nullptr)
         {
             ChipLogError(Discovery, "Failed to find an open operational allocator");
@@ -382,7 +419,8 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
         return CHIP_ERROR_NO_MEMORY;
     }
 
-    if (!operationalAllocator->AddResponder<TxtResponder>(TxtResourceRecord(instanceName, GetOperationalTxtEntries(params)))
+    FullQName txtEntries = GetOperationalTxtEntries(operationalAllocator, params);
+    if (!operationalAllocator->AddResponder<TxtResponder>(TxtResourceRecord(instanceName, txtEntries))
              .SetReportAdditional(hostName)
              .IsValid())
     {
@@ -620,11 +658,11 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
     return CHIP_NO_ERROR;
 }
 
-FullQName AdvertiserMinMdns::GetOperationalTxtEntries(const OperationalAdvertisingParameters & params)
+FullQName AdvertiserMinMdns::GetOperationalTxtEntries(OperationalAllocator * allocator,
+                                                      const OperationalAdvertisingParameters & params)
 {
     char * txtFields[OperationalAdvertisingParameters::kTxtMaxNumber];
     size_t numTxtFields = 0;
-    auto * allocator    = mQueryResponderAllocatorOperational;
     struct CommonTxtEntryStorage commonStorage;
     AddCommonTxtEntries<OperationalAdvertisingParameters>(params, commonStorage, txtFields, numTxtFields);
     if (numTxtFields == 0)
@@ -785,12 +823,7 @@ void AdvertiserMinMdns::AdvertiseRecords()
         QueryData queryData(QType::PTR, QClass::IN, false /* unicast */);
         queryData.SetIsBootAdvertising(true);
 
-        for (auto & allocator : mQueryResponderAllocatorOperational)
-        {
-            allocator.GetQueryResponder()->ClearBroadcastThrottle();
-        }
-        mQueryResponderAllocatorCommissionable.GetQueryResponder()->ClearBroadcastThrottle();
-        mQueryResponderAllocatorCommissioner.GetQueryResponder()->ClearBroadcastThrottle();
+        ClearBroadcastThrottle();
 
         CHIP_ERROR err = mResponseSender.Respond(0, queryData, &packetInfo);
         if (err != CHIP_NO_ERROR)
@@ -800,12 +833,7 @@ void AdvertiserMinMdns::AdvertiseRecords()
     }
 
     // Once all automatic broadcasts are done, allow immediate replies once.
-    for (auto & allocator : mQueryResponderAllocatorOperational)
-    {
-        allocator.GetQueryResponder()->ClearBroadcastThrottle();
-    }
-    mQueryResponderAllocatorCommissionable.GetQueryResponder()->ClearBroadcastThrottle();
-    mQueryResponderAllocatorCommissioner.GetQueryResponder()->ClearBroadcastThrottle();
+    ClearBroadcastThrottle();
 }
 
 AdvertiserMinMdns gAdvertiser;
@@ -464,27 +464,13 @@ CHIP_ERROR DiscoveryImplPlatform::ResolveNodeId(const PeerId & peerId, Inet::IPA
 {
     ReturnErrorOnFailure(Init());
 
-#if CHIP_CONFIG_MDNS_CACHE_SIZE > 0
-    Inet::IPAddress addr;
-    uint16_t port;
-    Inet::InterfaceId iface;
-
     /* see if the entry is cached and use it.... */
-
-    if (sMdnsCache.Lookup(peerId, addr, port, iface) == CHIP_NO_ERROR)
+    ResolvedNodeData nodeData;
+    if (LookupCachedNodeId(peerId, nodeData) == CHIP_NO_ERROR)
     {
-        ResolvedNodeData nodeData;
-
-        nodeData.mInterfaceId = iface;
-        nodeData.mPort        = port;
-        nodeData.mAddress     = addr;
-        nodeData.mPeerId      = peerId;
-
         mResolverDelegate->OnNodeIdResolved(nodeData);
-
         return CHIP_NO_ERROR;
     }
-#endif
 
     MdnsService service;
 
@@ -495,6 +481,17 @@ CHIP_ERROR DiscoveryImplPlatform::ResolveNodeId(const PeerId & peerId, Inet::IPA
     return ChipMdnsResolve(&service, INET_NULL_INTERFACEID, HandleNodeIdResolve, this);
 }
 
+CHIP_ERROR DiscoveryImplPlatform::LookupCachedNodeId(const PeerId & peerId, ResolvedNodeData & nodeData)
+{
+#if CHIP_CONFIG_MDNS_CACHE_SIZE > 0
+    ReturnErrorOnFailure(sMdnsCache.Lookup(peerId, nodeData.mAddress, nodeData.mPort, nodeData.mInterfaceId));
+    nodeData.mPeerId = peerId;
+    return CHIP_NO_ERROR;
+#else
+    return CHIP_ERROR_KEY_NOT_FOUND;
+#endif
+}
+
 void DiscoveryImplPlatform::HandleNodeBrowse(void * context, MdnsService * services, size_t servicesSize, CHIP_ERROR error)
 {
     for (size_t i = 0; i < servicesSize; ++i)
@@ -63,6 +63,8 @@ public:
     /// Requests resolution of a node ID to its address
     CHIP_ERROR ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type) override;
 
+    CHIP_ERROR LookupCachedNodeId(const PeerId & peerId, ResolvedNodeData & nodeData) override;
+
     CHIP_ERROR FindCommissionableNodes(DiscoveryFilter filter = DiscoveryFilter()) override;
 
     CHIP_ERROR FindCommissioners(DiscoveryFilter filter = DiscoveryFilter()) override;
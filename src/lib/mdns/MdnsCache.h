@@ -22,8 +22,10 @@
 #include <inet/IPAddress.h>
 #include <inet/InetInterface.h>
 #include <inet/InetLayer.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/PeerId.h>
+#include <lib/support/CodeUtils.h>
 #include <system/SystemTimer.h>
 #include <system/TimeSource.h>
 
@@ -37,79 +39,198 @@
 namespace chip {
 namespace Mdns {
 
-template <size_t CACHE_SIZE>
+// Cache of the addresses of resolved operational nodes.
+//
+// Entries are found through a hash table keyed by PeerId. When the cache is full, the least recently
+// used entry is evicted to make room for a new one. Each entry keeps up to kMaxAddressesPerPeer
+// addresses (e.g. IPv6 and IPv4 addresses, on several interfaces), each expiring with the TTL of the
+// record it came from. Entries looked up since they were last inserted are due for a refresh before
+// they expire, the others are left to expire.
+template <size_t CACHE_SIZE, Time::Source kTimeSource = Time::Source::kSystem>
 class MdnsCache
 {
 public:
+    static constexpr size_t kMaxAddressesPerPeer = CHIP_CONFIG_MDNS_CACHE_MAX_ADDRESSES_PER_PEER;
+
+    // entries are due for a refresh once this percentage of their TTL has elapsed (RFC 6762 section 5.2)
+    static constexpr uint64_t kRefreshPercentage = 80;
+
     MdnsCache() : elementsUsed(CACHE_SIZE)
     {
-        for (MdnsCacheEntry & e : mLookupTable)
+        for (uint16_t & bucket : mBuckets)
+        {
+            bucket = kInvalidIndex;
+        }
+        mLruHead  = kInvalidIndex;
+        mLruTail  = kInvalidIndex;
+        mFreeHead = kInvalidIndex;
+        for (size_t i = CACHE_SIZE; i > 0; i--)
         {
             // each unused entry decrements the count
-            MarkEntryUnused(e);
+            MarkEntryUnused(static_cast<uint16_t>(i - 1));
         }
         MdnsLogProgress(Discovery, "construct mdns cache of size %ld", CACHE_SIZE);
     }
 
-    // insert this entry into the cache.
-    // return error if cache is full
-    // TODO:   have an eviction policy so if the cache is full, an entry may be deleted.
-    //         One policy may be Least-time-to-live
+    // insert this entry into the cache, or add this address to the entry of the peer.
+    // if the cache is full, the least recently used entry is evicted.
     CHIP_ERROR Insert(PeerId peerId, const Inet::IPAddress & addr, uint16_t port, Inet::InterfaceId iface, uint32_t TTLms)
     {
-        const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
+        VerifyOrReturnError(CACHE_SIZE > 0, CHIP_ERROR_TOO_MANY_KEYS);
 
-        MdnsCacheEntry * entry;
+        const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
 
-        entry = FindPeerId(peerId, currentTime);
-        if (entry)
+        uint16_t index = FindPeerId(peerId, currentTime);
+        if (index == kInvalidIndex)
         {
-            // update timeout if found entry
-            entry->expiryTime = currentTime + TTLms;
-            entry->TTL        = TTLms; // in case it changes */
-            return CHIP_NO_ERROR;
-        }
+            index = AllocateEntry();
 
-        VerifyOrReturnError(entry = findSlot(currentTime), CHIP_ERROR_TOO_MANY_KEYS);
+            MdnsCacheEntry & entry = mLookupTable[index];
+            entry.peerId           = peerId;
+            entry.addressCount     = 0;
 
-        // have a free slot for this entry
-        entry->peerId     = peerId;
-        entry->ipAddr     = addr;
-        entry->port       = port;
-        entry->ifaceId    = iface;
-        entry->TTL        = TTLms;
-        entry->expiryTime = currentTime + TTLms;
-        elementsUsed++;
+            const size_t bucket = BucketOf(peerId);
+            entry.nextInBucket  = mBuckets[bucket];
+            mBuckets[bucket]    = index;
+        }
+
+        const uint64_t expiryTime = currentTime + TTLms;
+        MdnsCacheEntry & entry    = mLookupTable[index];
+        entry.port                = port;
+        entry.lookedUp            = false;
+        entry.refreshRequested    = false;
+        if (entry.addressCount == 0 || expiryTime >= entry.expiryTime)
+        {
+            // the entry lasts as long as its last address
+            entry.TTL        = TTLms; // in case it changes
+            entry.expiryTime = expiryTime;
+        }
+        AddAddress(entry, addr, iface, expiryTime);
+        MoveToLruHead(index);
 
         return CHIP_NO_ERROR;
     }
 
     CHIP_ERROR Delete(PeerId peerId)
     {
-        MdnsCacheEntry * pentry;
         const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
+        const uint16_t index       = FindPeerId(peerId, currentTime);
 
-        VerifyOrReturnError(pentry = FindPeerId(peerId, currentTime), CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(index != kInvalidIndex, CHIP_ERROR_KEY_NOT_FOUND);
 
-        MarkEntryUnused(*pentry);
+        RemoveEntry(index);
         return CHIP_NO_ERROR;
     }
 
-    // given a peerId, find the parameters if its in the cache, or return error
+    // given a peerId, find the parameters if its in the cache, or return error.
+    // IPv6 addresses are preferred over IPv4 ones.
     CHIP_ERROR Lookup(PeerId peerId, Inet::IPAddress & addr, uint16_t & port, Inet::InterfaceId & iface)
     {
-        MdnsCacheEntry * pentry;
+        bool found = false;
+
+        auto selectAddress = [&](const Inet::IPAddress & entryAddr, uint16_t entryPort, Inet::InterfaceId entryIface) {
+            if (!found || (addr.IsIPv4() && !entryAddr.IsIPv4()))
+            {
+                addr  = entryAddr;
+                port  = entryPort;
+                iface = entryIface;
+                found = true;
+            }
+        };
+
+        return ForEachAddress(peerId, selectAddress);
+    }
+
+    // calls function(addr, port, iface) for each address of the given peer that has not expired,
+    // or returns an error if the peer is not in the cache.
+    template <typename Function>
+    CHIP_ERROR ForEachAddress(PeerId peerId, Function && function)
+    {
         const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
+        const uint16_t index       = FindPeerId(peerId, currentTime);
 
-        VerifyOrReturnError(pentry = FindPeerId(peerId, currentTime), CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(index != kInvalidIndex, CHIP_ERROR_KEY_NOT_FOUND);
 
-        addr  = pentry->ipAddr;
-        port  = pentry->port;
-        iface = pentry->ifaceId;
+        MoveToLruHead(index);
+
+        MdnsCacheEntry & entry = mLookupTable[index];
+        entry.lookedUp         = true;
+        for (size_t i = 0; i < entry.addressCount; i++)
+        {
+            if (entry.addresses[i].expiryTime > currentTime)
+            {
+                function(entry.addresses[i].ipAddr, entry.port, entry.addresses[i].ifaceId);
+            }
+        }
 
         return CHIP_NO_ERROR;
     }
 
+    // calls function(peerId, TTLms, remainingTTLms) for each entry that has not expired
+    template <typename Function>
+    void ForEachEntry(Function && function)
+    {
+        const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
+
+        for (MdnsCacheEntry & e : mLookupTable)
+        {
+            if (e.peerId == nullPeerId || e.expiryTime <= currentTime)
+            {
+                continue;
+            }
+            function(e.peerId, e.TTL, e.expiryTime - currentTime);
+        }
+    }
+
+    // gets the delay until an entry is due for a refresh, or returns false if no entry needs one.
+    // only entries looked up since they were last inserted need one.
+    bool GetTimeUntilNextRefresh(uint64_t & delayMs)
+    {
+        const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
+        bool found                 = false;
+
+        for (MdnsCacheEntry & e : mLookupTable)
+        {
+            if (!NeedsRefresh(e, currentTime))
+            {
+                continue;
+            }
+
+            const uint64_t refreshTime  = RefreshTime(e);
+            const uint64_t entryDelayMs = (refreshTime > currentTime) ? refreshTime - currentTime : 0;
+            if (!found || entryDelayMs < delayMs)
+            {
+                delayMs = entryDelayMs;
+                found   = true;
+            }
+        }
+
+        return found;
+    }
+
+    // gets a peer whose entry is due for a refresh, and marks it as being refreshed: it is not
+    // returned again until inserted again. returns false if no entry is due.
+    bool NextPeerToRefresh(PeerId & peerId)
+    {
+        const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
+
+        for (MdnsCacheEntry & e : mLookupTable)
+        {
+            if (!NeedsRefresh(e, currentTime) || RefreshTime(e) > currentTime)
+            {
+                continue;
+            }
+
+            e.refreshRequested = true;
+            peerId             = e.peerId;
+            return true;
+        }
+
+        return false;
+    }
+
+    Time::TimeSource<kTimeSource> & GetTimeSource() { return mTimeSource; }
+
     // only useful if MDNS_LOGGING is set.   If not used, should be optimized out
     void DumpCache()
     {
@@ -124,75 +245,214 @@ public:
             }
             else
             {
-                char address[100];
+                for (size_t j = 0; j < e.addressCount; j++)
+                {
+                    char address[100];
 
-                e.ipAddr.ToString(address, sizeof address);
-                MdnsLogProgress(Discovery, "Entry %d: node %lx fabric %lx, port = %d, address = %s", i, e.peerId.GetNodeId(),
-                                e.peerId.GetFabricId(), e.port, address);
+                    e.addresses[j].ipAddr.ToString(address, sizeof address);
+                    MdnsLogProgress(Discovery, "Entry %d: node %lx fabric %lx, port = %d, address = %s", i, e.peerId.GetNodeId(),
+                                    e.peerId.GetCompressedFabricId(), e.port, address);
+                }
             }
             i++;
         }
     }
 
 private:
+    static constexpr uint16_t kInvalidIndex = UINT16_MAX;
+    static constexpr size_t kBucketCount    = (CACHE_SIZE > 0) ? CACHE_SIZE : 1;
+    static_assert(CACHE_SIZE < kInvalidIndex, "MdnsCache entries are indexed by uint16_t");
+
+    struct CachedAddress
+    {
+        Inet::IPAddress ipAddr;
+        Inet::InterfaceId ifaceId;
+        uint64_t expiryTime; // in milliseconds, from mTimeSource
+    };
+
     struct MdnsCacheEntry
     {
         PeerId peerId;
-        Inet::IPAddress ipAddr;
+        CachedAddress addresses[kMaxAddressesPerPeer];
+        size_t addressCount;
         uint16_t port;
-        Inet::InterfaceId ifaceId;
-        uint64_t TTL;        // from mdns record -- units?
-        uint64_t expiryTime; // units?
+        uint64_t TTL;          // in milliseconds, from the last insertion
+        uint64_t expiryTime;   // in milliseconds, from mTimeSource
+        bool lookedUp;         // the entry was looked up since it was last inserted
+        bool refreshRequested; // NextPeerToRefresh returned this entry since it was last inserted
+        uint16_t nextInBucket; // next entry with the same hash, or next free entry if unused
+        uint16_t lruPrev;      // more recently used entry
+        uint16_t lruNext;      // less recently used entry
     };
     PeerId nullPeerId; // indicates a cache entry is unused
     int elementsUsed;  // running count of how many entries are used -- for a sanity check
 
     MdnsCacheEntry mLookupTable[CACHE_SIZE];
-    Time::TimeSource<Time::Source::kSystem> mTimeSource;
+    uint16_t mBuckets[kBucketCount]; // first entry of each hash bucket
+    uint16_t mLruHead;               // most recently used entry
+    uint16_t mLruTail;               // least recently used entry, evicted first
+    uint16_t mFreeHead;              // unused entries, linked through nextInBucket
+    Time::TimeSource<kTimeSource> mTimeSource;
 
-    MdnsCacheEntry * findSlot(uint64_t currentTime)
+    static size_t BucketOf(PeerId peerId)
     {
-        for (MdnsCacheEntry & entry : mLookupTable)
-        {
-            if (entry.peerId == nullPeerId)
-                return &entry;
+        uint64_t hash = peerId.GetNodeId() ^ (peerId.GetCompressedFabricId() * 0x9E3779B97F4A7C15ull);
+        hash ^= hash >> 32;
+        return static_cast<size_t>(hash % kBucketCount);
+    }
 
-            if (entry.expiryTime <= currentTime)
+    bool NeedsRefresh(const MdnsCacheEntry & entry, uint64_t currentTime) const
+    {
+        return entry.peerId != nullPeerId && entry.lookedUp && !entry.refreshRequested && entry.expiryTime > currentTime;
+    }
+
+    static uint64_t RefreshTime(const MdnsCacheEntry & entry)
+    {
+        return entry.expiryTime - entry.TTL + entry.TTL * kRefreshPercentage / 100;
+    }
+
+    // adds an address to the entry, or updates its expiry time if it is there already.
+    // if the entry has no room left, the address expiring first (e.g. an expired one) is replaced.
+    void AddAddress(MdnsCacheEntry & entry, const Inet::IPAddress & addr, Inet::InterfaceId iface, uint64_t expiryTime)
+    {
+        CachedAddress * slot = nullptr;
+
+        for (size_t i = 0; i < entry.addressCount; i++)
+        {
+            if (entry.addresses[i].ipAddr == addr && entry.addresses[i].ifaceId == iface)
+            {
+                entry.addresses[i].expiryTime = expiryTime;
+                return;
+            }
+            if (slot == nullptr || entry.addresses[i].expiryTime < slot->expiryTime)
             {
-                MarkEntryUnused(entry);
-                return &entry;
+                slot = &entry.addresses[i];
             }
         }
-        return nullptr;
+
+        if (entry.addressCount < kMaxAddressesPerPeer)
+        {
+            slot = &entry.addresses[entry.addressCount++];
+        }
+
+        slot->ipAddr     = addr;
+        slot->ifaceId    = iface;
+        slot->expiryTime = expiryTime;
     }
 
-    MdnsCacheEntry * FindPeerId(PeerId peerId, uint64_t current_time)
+    uint16_t FindPeerId(PeerId peerId, uint64_t current_time)
     {
-        for (MdnsCacheEntry & entry : mLookupTable)
+        if (CACHE_SIZE == 0)
         {
+            return kInvalidIndex;
+        }
+
+        for (uint16_t index = mBuckets[BucketOf(peerId)]; index != kInvalidIndex; index = mLookupTable[index].nextInBucket)
+        {
+            MdnsCacheEntry & entry = mLookupTable[index];
             if (entry.peerId == peerId)
             {
-                if (entry.expiryTime < current_time)
+                if (entry.expiryTime <= current_time)
                 {
-                    MarkEntryUnused(entry);
-                    break; // return nullptr
+                    RemoveEntry(index);
+                    return kInvalidIndex;
                 }
-                else
-                    return &entry;
-            }
-            if (entry.peerId != nullPeerId && entry.expiryTime < current_time)
-            {
-                MarkEntryUnused(entry);
+                return index;
             }
         }
 
-        return nullptr;
+        return kInvalidIndex;
+    }
+
+    // gets an unused entry, evicting the least recently used one if the cache is full
+    uint16_t AllocateEntry()
+    {
+        if (mFreeHead == kInvalidIndex)
+        {
+            MdnsLogProgress(Discovery, "mdns cache full, evicting least recently used entry");
+            RemoveEntry(mLruTail);
+        }
+
+        const uint16_t index = mFreeHead;
+        mFreeHead            = mLookupTable[index].nextInBucket;
+        elementsUsed++;
+
+        mLookupTable[index].lruPrev = kInvalidIndex;
+        mLookupTable[index].lruNext = mLruHead;
+        if (mLruHead != kInvalidIndex)
+        {
+            mLookupTable[mLruHead].lruPrev = index;
+        }
+        mLruHead = index;
+        if (mLruTail == kInvalidIndex)
+        {
+            mLruTail = index;
+        }
+
+        return index;
+    }
+
+    void RemoveEntry(uint16_t index)
+    {
+        MdnsCacheEntry & entry = mLookupTable[index];
+
+        // unlink from the hash bucket
+        uint16_t * link = &mBuckets[BucketOf(entry.peerId)];
+        while (*link != index)
+        {
+            link = &mLookupTable[*link].nextInBucket;
+        }
+        *link = entry.nextInBucket;
+
+        UnlinkFromLru(index);
+        MarkEntryUnused(index);
+    }
+
+    void UnlinkFromLru(uint16_t index)
+    {
+        MdnsCacheEntry & entry = mLookupTable[index];
+
+        if (entry.lruPrev != kInvalidIndex)
+        {
+            mLookupTable[entry.lruPrev].lruNext = entry.lruNext;
+        }
+        else
+        {
+            mLruHead = entry.lruNext;
+        }
+
+        if (entry.lruNext != kInvalidIndex)
+        {
+            mLookupTable[entry.lruNext].lruPrev = entry.lruPrev;
+        }
+        else
+        {
+            mLruTail = entry.lruPrev;
+        }
+    }
+
+    void MoveToLruHead(uint16_t index)
+    {
+        if (mLruHead == index)
+        {
+            return;
+        }
+
+        // the entry is not the only one in the list, which remains non-empty once it is unlinked
+        UnlinkFromLru(index);
+
+        mLookupTable[index].lruPrev    = kInvalidIndex;
+        mLookupTable[index].lruNext    = mLruHead;
+        mLookupTable[mLruHead].lruPrev = index;
+        mLruHead                       = index;
     }
 
     // have a method to mark ununused --  so its easy to change
-    void MarkEntryUnused(MdnsCacheEntry & pentry)
+    void MarkEntryUnused(uint16_t index)
     {
-        pentry.peerId = nullPeerId;
+        mLookupTable[index].peerId       = nullPeerId;
+        mLookupTable[index].nextInBucket = mFreeHead;
+        mFreeHead                        = index;
         elementsUsed--;
     }
 };
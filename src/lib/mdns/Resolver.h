@@ -263,6 +263,10 @@ public:
     /// Requests resolution of a node ID to its address
     virtual CHIP_ERROR ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type) = 0;
 
+    /// Gets the address of a node from previous resolutions, without sending any query.
+    /// Returns CHIP_ERROR_KEY_NOT_FOUND if no unexpired address of the node is known.
+    virtual CHIP_ERROR LookupCachedNodeId(const PeerId & peerId, ResolvedNodeData & nodeData) = 0;
+
     // Finds all nodes with the given filter that are currently in commissioning mode.
     virtual CHIP_ERROR FindCommissionableNodes(DiscoveryFilter filter = DiscoveryFilter()) = 0;
 
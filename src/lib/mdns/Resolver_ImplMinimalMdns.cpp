@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 
+#include "ActiveResolveAttempts.h"
 #include "MdnsCache.h"
 #include "Resolver.h"
 
@@ -28,8 +29,11 @@
 #include <lib/mdns/minimal/QueryBuilder.h>
 #include <lib/mdns/minimal/RecordData.h>
 #include <lib/mdns/minimal/core/FlatAllocatedQName.h>
+#include <lib/mdns/minimal/records/Ptr.h>
 #include <lib/support/CHIPMemString.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
 
 // MDNS servers will receive all broadcast packets over the network.
 // Disable 'invalid packet' messages because the are expected and common
@@ -62,6 +66,10 @@ private:
 constexpr size_t kMdnsMaxPacketSize = 1024;
 constexpr uint16_t kMdnsPort        = 5353;
 
+// Retries of node resolutions due at the same time are sent as the questions of a single packet. Questions
+// share their service name, so this many fit well within kMdnsMaxPacketSize.
+constexpr size_t kMaxResolveQueriesPerPacket = 16;
+
 using namespace mdns::Minimal;
 using MdnsCacheType = Mdns::MdnsCache<CHIP_CONFIG_MDNS_CACHE_SIZE>;
 
@@ -69,9 +77,9 @@ class PacketDataReporter : public ParserDelegate
 {
 public:
     PacketDataReporter(ResolverDelegate * delegate, chip::Inet::InterfaceId interfaceId, DiscoveryType discoveryType,
-                       const BytesRange & packet, MdnsCacheType & mdnsCache) :
+                       const BytesRange & packet, MdnsCacheType & mdnsCache, ActiveResolveAttempts & activeResolves) :
         mDelegate(delegate),
-        mDiscoveryType(discoveryType), mPacketRange(packet)
+        mDiscoveryType(discoveryType), mPacketRange(packet), mMdnsCache(mdnsCache), mActiveResolves(activeResolves)
     {
         mInterfaceId           = interfaceId;
         mNodeData.mInterfaceId = interfaceId;
@@ -93,10 +101,17 @@ private:
     DiscoveredNodeData mDiscoveredNodeData;
     chip::Inet::InterfaceId mInterfaceId;
     BytesRange mPacketRange;
+    MdnsCacheType & mMdnsCache;
+    ActiveResolveAttempts & mActiveResolves;
+
+    bool mValid              = false;
+    bool mHasNodePort        = false;
+    bool mHasIP              = false;
+    uint32_t mNodeTtlSeconds = 0;
 
-    bool mValid       = false;
-    bool mHasNodePort = false;
-    bool mHasIP       = false;
+    // All the addresses of the operational node are cached, while only the last one is reported.
+    chip::Inet::IPAddress mNodeAddresses[MdnsCacheType::kMaxAddressesPerPeer];
+    size_t mNodeAddressCount = 0;
 
     void OnCommissionableNodeSrvRecord(SerializedQNameIterator name, const SrvRecord & srv);
     void OnOperationalSrvRecord(SerializedQNameIterator name, const SrvRecord & srv);
@@ -177,6 +192,11 @@ void PacketDataReporter::OnOperationalIPAddress(const chip::Inet::IPAddress & ad
     // (if multi-admin decides to use unique ports for every ecosystem).
     mNodeData.mAddress = addr;
     mHasIP             = true;
+
+    if (mNodeAddressCount < MdnsCacheType::kMaxAddressesPerPeer)
+    {
+        mNodeAddresses[mNodeAddressCount++] = addr;
+    }
 }
 
 void PacketDataReporter::OnDiscoveredNodeIPAddress(const chip::Inet::IPAddress & addr)
@@ -229,6 +249,7 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
             // TODO: Fix this comparison which is too loose.
             if (HasQNamePart(data.GetName(), kOperationalServiceName))
             {
+                mNodeTtlSeconds = static_cast<uint32_t>(data.GetTtlSeconds());
                 OnOperationalSrvRecord(data.GetName(), srv);
             }
         }
@@ -321,6 +342,16 @@ void PacketDataReporter::OnComplete()
     else if (mDiscoveryType == DiscoveryType::kOperational && mHasIP && mHasNodePort)
     {
         mNodeData.LogNodeIdResolved();
+        mActiveResolves.Complete(mNodeData.mPeerId);
+
+        // Cached nodes are sent as known answers of operational browse queries, and reconnecting to them does not
+        // need a new resolution. Failing to cache a node only means that it will be resolved again.
+        for (size_t i = 0; i < mNodeAddressCount; i++)
+        {
+            mMdnsCache.Insert(mNodeData.mPeerId, mNodeAddresses[i], mNodeData.mPort, mNodeData.mInterfaceId,
+                              mNodeTtlSeconds * 1000);
+        }
+
         mDelegate->OnNodeIdResolved(mNodeData);
     }
 }
@@ -338,15 +369,44 @@ public:
     void ShutdownResolver() override;
     CHIP_ERROR SetResolverDelegate(ResolverDelegate * delegate) override;
     CHIP_ERROR ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type) override;
+    CHIP_ERROR LookupCachedNodeId(const PeerId & peerId, ResolvedNodeData & nodeData) override;
     CHIP_ERROR FindCommissionableNodes(DiscoveryFilter filter = DiscoveryFilter()) override;
     CHIP_ERROR FindCommissioners(DiscoveryFilter filter = DiscoveryFilter()) override;
 
 private:
     ResolverDelegate * mDelegate = nullptr;
     DiscoveryType mDiscoveryType = DiscoveryType::kUnknown;
+    System::Layer * mSystemLayer = nullptr;
+
+    // Node resolutions whose queries are retried until a response is received.
+    ActiveResolveAttempts mActiveResolves;
+
+    // The last browse query is retried with the same backoff as node resolutions.
+    mdns::Minimal::FullQName mBrowseQName;
+    DiscoveryType mBrowseDiscoveryType                       = DiscoveryType::kUnknown;
+    uint32_t mBrowseRetryDelaySec                            = 0; // 0 if the browse query is not retried
+    System::Clock::MonotonicMilliseconds mBrowseQueryDueTime = 0;
 
     CHIP_ERROR SendQuery(mdns::Minimal::FullQName qname, mdns::Minimal::QType type);
     CHIP_ERROR BrowseNodes(DiscoveryType type, DiscoveryFilter subtype);
+
+    /// Adds the nodes of the cache as known answers of an operational browse query.
+    void AddOperationalKnownAnswers(QueryBuilder & builder);
+
+    CHIP_ERROR AddResolveQuery(QueryBuilder & builder, const PeerId & peerId);
+    CHIP_ERROR SendResolveQuery(const PeerId & peerId);
+    CHIP_ERROR SendPendingResolveQueries(System::Clock::MonotonicMilliseconds now);
+
+    /// Gets the next peer whose resolve query is due: a cached node to refresh, or a resolution to retry.
+    bool NextPeerToQuery(System::Clock::MonotonicMilliseconds now, PeerId & peerId);
+
+    /// Sends the queries that are due to be retried and schedules the next retries.
+    void SendPendingQueries();
+    void ScheduleRetries();
+    static void RetryTimerCallback(System::Layer * systemLayer, void * self)
+    {
+        static_cast<MinMdnsResolver *>(self)->SendPendingQueries();
+    }
     template <typename... Args>
     mdns::Minimal::FullQName CheckAndAllocateQName(Args &&... parts)
     {
@@ -371,7 +431,7 @@ void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet
         return;
     }
 
-    PacketDataReporter reporter(mDelegate, info->Interface, mDiscoveryType, data, sMdnsCache);
+    PacketDataReporter reporter(mDelegate, info->Interface, mDiscoveryType, data, sMdnsCache, mActiveResolves);
 
     if (!ParsePacket(data, &reporter))
     {
@@ -381,10 +441,18 @@ void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet
     {
         reporter.OnComplete();
     }
+
+    if (mDiscoveryType == DiscoveryType::kOperational)
+    {
+        // Nodes resolved by this packet are refreshed once most of their TTL has elapsed.
+        ScheduleRetries();
+    }
 }
 
 CHIP_ERROR MinMdnsResolver::StartResolver(chip::Inet::InetLayer * inetLayer, uint16_t port)
 {
+    mSystemLayer = inetLayer->SystemLayer();
+
     /// Note: we do not double-check the port as we assume the APP will always use
     /// the same inetLayer and port for mDNS.
     if (GlobalMinimalMdnsServer::Server().IsListening())
@@ -397,6 +465,13 @@ CHIP_ERROR MinMdnsResolver::StartResolver(chip::Inet::InetLayer * inetLayer, uin
 
 void MinMdnsResolver::ShutdownResolver()
 {
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(&RetryTimerCallback, this);
+    }
+    mActiveResolves.Reset();
+    mBrowseRetryDelaySec = 0;
+
     GlobalMinimalMdnsServer::Instance().ShutdownServer();
 }
 
@@ -423,9 +498,44 @@ CHIP_ERROR MinMdnsResolver::SendQuery(mdns::Minimal::FullQName qname, mdns::Mini
 
     ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
 
+    if (mDiscoveryType == DiscoveryType::kOperational)
+    {
+        AddOperationalKnownAnswers(builder);
+    }
+
     return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort);
 }
 
+void MinMdnsResolver::AddOperationalKnownAnswers(QueryBuilder & builder)
+{
+    const char * serviceQName[] = { kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+    bool packetFull             = false;
+
+    sMdnsCache.ForEachEntry([&](const PeerId & peerId, uint64_t ttlMs, uint64_t remainingTtlMs) {
+        // Answers with less than half of their TTL remaining are not listed, so that responders refresh them
+        // (RFC 6762 section 7.1).
+        if (packetFull || (remainingTtlMs < ttlMs / 2))
+        {
+            return;
+        }
+
+        char nameBuffer[kMaxOperationalServiceNameSize] = "";
+        if (MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId) != CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+        PtrResourceRecord record(serviceQName, instanceQName);
+        record.SetTtl(static_cast<uint32_t>(remainingTtlMs / 1000));
+
+        // Answers that do not fit are left out: the packet built so far is still valid, and responders
+        // just send the corresponding records.
+        builder.AddAnswer(record);
+        packetFull = !builder.Ok();
+    });
+}
+
 CHIP_ERROR MinMdnsResolver::FindCommissionableNodes(DiscoveryFilter filter)
 {
     return BrowseNodes(DiscoveryType::kCommissionableNode, filter);
@@ -441,6 +551,12 @@ CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filt
 {
     mDiscoveryType = type;
 
+    if (type != DiscoveryType::kOperational)
+    {
+        // Responses are now parsed as discovered nodes, so node resolutions would not complete anyway.
+        mActiveResolves.Reset();
+    }
+
     mdns::Minimal::FullQName qname;
 
     switch (type)
@@ -486,52 +602,205 @@ CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filt
         return CHIP_ERROR_NO_MEMORY;
     }
 
-    return SendQuery(qname, mdns::Minimal::QType::ANY);
+    mBrowseQName         = qname;
+    mBrowseDiscoveryType = type;
+    mBrowseRetryDelaySec = 0;
+
+    ReturnErrorOnFailure(SendQuery(qname, mdns::Minimal::QType::ANY));
+
+    mBrowseRetryDelaySec = 1;
+    mBrowseQueryDueTime  = System::Clock::GetMonotonicMilliseconds() + 1000;
+    ScheduleRetries();
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type)
 {
-    mDiscoveryType                    = DiscoveryType::kOperational;
+    mDiscoveryType = DiscoveryType::kOperational;
+
+    ResolvedNodeData nodeData;
+    if (LookupCachedNodeId(peerId, nodeData) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(mDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        mDelegate->OnNodeIdResolved(nodeData);
+        return CHIP_NO_ERROR;
+    }
+
+    // A node resolution already in progress keeps its retries as scheduled.
+    VerifyOrReturnError(mActiveResolves.MarkPending(peerId, System::Clock::GetMonotonicMilliseconds()), CHIP_NO_ERROR);
+
+    CHIP_ERROR err = SendResolveQuery(peerId);
+    if (err != CHIP_NO_ERROR)
+    {
+        mActiveResolves.Complete(peerId);
+        return err;
+    }
+
+    ScheduleRetries();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MinMdnsResolver::LookupCachedNodeId(const PeerId & peerId, ResolvedNodeData & nodeData)
+{
+    ReturnErrorOnFailure(sMdnsCache.Lookup(peerId, nodeData.mAddress, nodeData.mPort, nodeData.mInterfaceId));
+    nodeData.mPeerId = peerId;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MinMdnsResolver::AddResolveQuery(QueryBuilder & builder, const PeerId & peerId)
+{
+    char nameBuffer[64] = "";
+
+    // Node and fabricid are encoded in server names.
+    ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId));
+
+    const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+    Query query(instanceQName);
+
+    query
+        .SetClass(QClass::IN)       //
+        .SetType(QType::ANY)        //
+        .SetAnswerViaUnicast(false) //
+        ;
+
+    // NOTE: type above is NOT A or AAAA because the name searched for is
+    // a SRV record. The layout is:
+    //    SRV -> hostname
+    //    Hostname -> A
+    //    Hostname -> AAAA
+    //
+    // Query is sent for ANY and expectation is to receive A/AAAA records
+    // in the additional section of the reply.
+    //
+    // Sending a A/AAAA query will return no results
+    // Sending a SRV query will return the srv only and an additional query
+    // would be needed to resolve the host name to an IP address
+
+    builder.AddQuery(query);
+
+    ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MinMdnsResolver::SendResolveQuery(const PeerId & peerId)
+{
     System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
     ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     QueryBuilder builder(std::move(buffer));
     builder.Header().SetMessageId(0);
 
+    ReturnErrorOnFailure(AddResolveQuery(builder, peerId));
+
+    return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort);
+}
+
+bool MinMdnsResolver::NextPeerToQuery(System::Clock::MonotonicMilliseconds now, PeerId & peerId)
+{
+    // Cached nodes looked up since they were last resolved are resolved again before they expire (RFC 6762
+    // section 5.2), and their queries are then retried as for any other resolution. Nodes nobody looks up
+    // are left to expire. Refreshes never take the place of a resolution requested by a
+    // caller: they are skipped while all the retry entries are in use.
+    while (sMdnsCache.NextPeerToRefresh(peerId))
     {
-        char nameBuffer[64] = "";
+        if (mActiveResolves.MarkRefreshPending(peerId, now))
+        {
+            return true;
+        }
+    }
+
+    return mActiveResolves.NextScheduledPeer(now, peerId);
+}
 
-        // Node and fabricid are encoded in server names.
-        ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId));
+CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries(System::Clock::MonotonicMilliseconds now)
+{
+    PeerId peerId;
+    bool hasPeer = NextPeerToQuery(now, peerId);
 
-        const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
-        Query query(instanceQName);
-
-        query
-            .SetClass(QClass::IN)       //
-            .SetType(QType::ANY)        //
-            .SetAnswerViaUnicast(false) //
-            ;
-
-        // NOTE: type above is NOT A or AAAA because the name searched for is
-        // a SRV record. The layout is:
-        //    SRV -> hostname
-        //    Hostname -> A
-        //    Hostname -> AAAA
-        //
-        // Query is sent for ANY and expectation is to receive A/AAAA records
-        // in the additional section of the reply.
-        //
-        // Sending a A/AAAA query will return no results
-        // Sending a SRV query will return the srv only and an additional query
-        // would be needed to resolve the host name to an IP address
-
-        builder.AddQuery(query);
+    while (hasPeer)
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
+        ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        QueryBuilder builder(std::move(buffer));
+        builder.Header().SetMessageId(0);
+
+        for (size_t i = 0; hasPeer && (i < kMaxResolveQueriesPerPacket); i++)
+        {
+            ReturnErrorOnFailure(AddResolveQuery(builder, peerId));
+            hasPeer = NextPeerToQuery(now, peerId);
+        }
+
+        ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort));
     }
 
-    ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
+    return CHIP_NO_ERROR;
+}
 
-    return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort);
+void MinMdnsResolver::SendPendingQueries()
+{
+    const System::Clock::MonotonicMilliseconds now = System::Clock::GetMonotonicMilliseconds();
+
+    if (mBrowseDiscoveryType != mDiscoveryType)
+    {
+        // Responses to the browse query would not be reported anymore.
+        mBrowseRetryDelaySec = 0;
+    }
+
+    if ((mBrowseRetryDelaySec != 0) && (mBrowseQueryDueTime <= now))
+    {
+        mBrowseRetryDelaySec *= 2;
+        if (mBrowseRetryDelaySec > ActiveResolveAttempts::kMaxRetryDelaySec)
+        {
+            mBrowseRetryDelaySec = 0;
+        }
+        mBrowseQueryDueTime = now + mBrowseRetryDelaySec * 1000;
+
+        LogErrorOnFailure(SendQuery(mBrowseQName, mdns::Minimal::QType::ANY));
+    }
+
+    LogErrorOnFailure(SendPendingResolveQueries(now));
+
+    ScheduleRetries();
+}
+
+void MinMdnsResolver::ScheduleRetries()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    mSystemLayer->CancelTimer(&RetryTimerCallback, this);
+
+    const System::Clock::MonotonicMilliseconds now = System::Clock::GetMonotonicMilliseconds();
+
+    uint32_t delayMs = 0;
+    bool hasRetry    = mActiveResolves.GetTimeUntilNextRetry(now, delayMs);
+
+    if (mBrowseRetryDelaySec != 0)
+    {
+        const uint32_t browseDelayMs = (mBrowseQueryDueTime > now) ? static_cast<uint32_t>(mBrowseQueryDueTime - now) : 0;
+        if (!hasRetry || (browseDelayMs < delayMs))
+        {
+            delayMs = browseDelayMs;
+        }
+        hasRetry = true;
+    }
+
+    uint64_t refreshDelayMs = 0;
+    if (sMdnsCache.GetTimeUntilNextRefresh(refreshDelayMs))
+    {
+        // Refresh delays are below the TTL of cache entries, which fits in 32 bits.
+        if (!hasRetry || (refreshDelayMs < delayMs))
+        {
+            delayMs = static_cast<uint32_t>(refreshDelayMs);
+        }
+        hasRetry = true;
+    }
+
+    if (hasRetry)
+    {
+        LogErrorOnFailure(mSystemLayer->StartTimer(delayMs, &RetryTimerCallback, this));
+    }
 }
 
 MinMdnsResolver gResolver;
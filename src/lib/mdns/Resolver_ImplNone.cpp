@@ -36,6 +36,10 @@ public:
         ChipLogError(Discovery, "Failed to resolve node ID: mDNS resolving not available");
         return CHIP_ERROR_NOT_IMPLEMENTED;
     }
+    CHIP_ERROR LookupCachedNodeId(const PeerId & peerId, ResolvedNodeData & nodeData) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
     CHIP_ERROR FindCommissionableNodes(DiscoveryFilter filter = DiscoveryFilter()) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
     CHIP_ERROR FindCommissioners(DiscoveryFilter filter = DiscoveryFilter()) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
 };
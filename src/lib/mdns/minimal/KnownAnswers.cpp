@@ -0,0 +1,70 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "KnownAnswers.h"
+
+#include <lib/mdns/minimal/RecordData.h>
+#include <lib/mdns/minimal/records/Ptr.h>
+
+namespace mdns {
+namespace Minimal {
+
+void KnownAnswers::OnResource(ResourceType type, const ResourceData & data)
+{
+    if ((type != ResourceType::kAnswer) || (mCount >= kMaxKnownAnswers))
+    {
+        return;
+    }
+    mAnswers[mCount++] = data;
+}
+
+bool KnownAnswers::Contains(const ResourceRecord & record) const
+{
+    if (record.GetType() != QType::PTR)
+    {
+        return false;
+    }
+
+    const FullQName & target = static_cast<const PtrResourceRecord &>(record).GetPtr();
+
+    for (size_t i = 0; i < mCount; i++)
+    {
+        const ResourceData & answer = mAnswers[i];
+
+        // Answers about to expire are sent again so that the querier can refresh them.
+        if ((answer.GetType() != QType::PTR) || (answer.GetTtlSeconds() * 2 < record.GetTtl()))
+        {
+            continue;
+        }
+
+        if (answer.GetName() != record.GetName())
+        {
+            continue;
+        }
+
+        SerializedQNameIterator answerTarget;
+        if (ParsePtrRecord(answer.GetData(), mPacket, &answerTarget) && (answerTarget == target))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace Minimal
+} // namespace mdns
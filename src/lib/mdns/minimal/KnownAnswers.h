@@ -0,0 +1,64 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <lib/mdns/minimal/Parser.h>
+#include <lib/mdns/minimal/records/ResourceRecord.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Collects the known answers of a query: records that the querier already
+/// has and that responders should not send again (RFC 6762 section 7.1).
+///
+/// Known answers reference the packet they were parsed from, which MUST stay
+/// valid while they are used.
+class KnownAnswers : public ParserDelegate
+{
+public:
+    /// Known answers past this count are ignored, i.e. the corresponding
+    /// records are sent anyway.
+    static constexpr size_t kMaxKnownAnswers = 16;
+
+    KnownAnswers(const BytesRange & packet) : mPacket(packet) {}
+
+    size_t Count() const { return mCount; }
+
+    /// Returns whether the given record is listed as a known answer with at
+    /// least half of its TTL remaining, in which case it does not need to be
+    /// sent.
+    ///
+    /// Only PTR records, for which the known answer mechanism is meant, are
+    /// matched: other records are always sent.
+    bool Contains(const ResourceRecord & record) const;
+
+    // ParserDelegate implementation
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnQuery(const QueryData & data) override {}
+    void OnResource(ResourceType type, const ResourceData & data) override;
+
+private:
+    BytesRange mPacket;
+    ResourceData mAnswers[kMaxKnownAnswers];
+    size_t mCount = 0;
+};
+
+} // namespace Minimal
+} // namespace mdns
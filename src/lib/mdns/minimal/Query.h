@@ -17,10 +17,9 @@
 
 #pragma once
 
-#include <lib/support/BufferWriter.h>
-
 #include <lib/mdns/minimal/core/Constants.h>
 #include <lib/mdns/minimal/core/QName.h>
+#include <lib/mdns/minimal/core/RecordWriter.h>
 
 namespace mdns {
 namespace Minimal {
@@ -56,7 +55,7 @@ public:
     ///
     /// @param hdr will be updated with a query count
     /// @param out where to write the query data
-    bool Append(HeaderRef & hdr, chip::Encoding::BigEndian::BufferWriter & out) const
+    bool Append(HeaderRef & hdr, RecordWriter & out) const
     {
         // Questions can only be appended before any other data is added
         if ((hdr.GetAdditionalCount() != 0) || (hdr.GetAnswerCount() != 0) || (hdr.GetAuthorityCount() != 0))
@@ -64,7 +63,7 @@ public:
             return false;
         }
 
-        mQName.Output(out);
+        out.WriteQName(mQName);
 
         out.Put16(static_cast<uint16_t>(mType));
         out.Put16(static_cast<uint16_t>(static_cast<uint16_t>(mClass) | (mAnswerViaUnicast ? kQClassUnicastAnswerFlag : 0)));
@@ -21,15 +21,24 @@
 
 #include <lib/mdns/minimal/Query.h>
 #include <lib/mdns/minimal/core/DnsHeader.h>
+#include <lib/mdns/minimal/core/RecordWriter.h>
+#include <lib/mdns/minimal/records/ResourceRecord.h>
 
 namespace mdns {
 namespace Minimal {
 
+/// Writes a MDNS query into a given packet buffer.
+///
+/// Known answers (RFC 6762 section 7.1) may be added after the questions, so
+/// that responders do not send again records the querier already has.
 class QueryBuilder
 {
 public:
-    QueryBuilder() : mHeader(nullptr) {}
-    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr) { Reset(std::move(packet)); }
+    QueryBuilder() : mHeader(nullptr), mOutput(nullptr, 0), mWriter(&mOutput) {}
+    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr), mOutput(nullptr, 0), mWriter(&mOutput)
+    {
+        Reset(std::move(packet));
+    }
 
     QueryBuilder & Reset(chip::System::PacketBufferHandle && packet)
     {
@@ -40,12 +49,19 @@ public:
         {
             mPacket->SetDataLength(HeaderRef::kSizeBytes);
             mHeader.Clear();
+            mQueryBuildOk = true;
         }
         else
         {
             mQueryBuildOk = false;
         }
 
+        // Compression pointers are offsets from the start of the packet, so the
+        // writer covers the whole packet and starts right after the header.
+        mOutput = chip::Encoding::BigEndian::BufferWriter(mPacket->Start(), mPacket->MaxDataLength());
+        mOutput.Skip(mPacket->DataLength());
+        mWriter.Reset();
+
         mHeader.SetFlags(mHeader.GetFlags().SetQuery());
         return *this;
     }
@@ -55,6 +71,8 @@ public:
     {
         mHeader       = HeaderRef(nullptr);
         mQueryBuildOk = false;
+        mOutput       = chip::Encoding::BigEndian::BufferWriter(nullptr, 0);
+        mWriter.Reset();
         return std::move(mPacket);
     }
 
@@ -67,15 +85,33 @@ public:
             return *this;
         }
 
-        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
+        if (!query.Append(mHeader, mWriter))
+        {
+            mQueryBuildOk = false;
+        }
+        else
+        {
+            mPacket->SetDataLength(static_cast<uint16_t>(mOutput.Needed()));
+        }
+        return *this;
+    }
+
+    /// Adds a record the querier already knows about to the answer section.
+    /// Known answers can only be added after all the queries.
+    QueryBuilder & AddAnswer(const ResourceRecord & record)
+    {
+        if (!mQueryBuildOk)
+        {
+            return *this;
+        }
 
-        if (!query.Append(mHeader, out))
+        if (!record.Append(mHeader, ResourceType::kAnswer, mWriter))
         {
             mQueryBuildOk = false;
         }
         else
         {
-            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+            mPacket->SetDataLength(static_cast<uint16_t>(mOutput.Needed()));
         }
         return *this;
     }
@@ -85,7 +121,9 @@ public:
 private:
     chip::System::PacketBufferHandle mPacket;
     HeaderRef mHeader;
-    bool mQueryBuildOk = true;
+    chip::Encoding::BigEndian::BufferWriter mOutput; // writes the packet, from its start
+    RecordWriter mWriter;                            // writes queries and answers to mOutput
+    bool mQueryBuildOk = false;
 };
 
 } // namespace Minimal
@@ -20,17 +20,24 @@
 #include <system/SystemPacketBuffer.h>
 
 #include <lib/mdns/minimal/core/DnsHeader.h>
+#include <lib/mdns/minimal/core/RecordWriter.h>
 #include <lib/mdns/minimal/records/ResourceRecord.h>
 
 namespace mdns {
 namespace Minimal {
 
 /// Writes a MDNS reply into a given packet buffer.
+///
+/// QNames of the records are compressed: a name ending with a name already
+/// written to the packet refers to it instead of repeating it.
 class ResponseBuilder
 {
 public:
-    ResponseBuilder() : mHeader(nullptr) {}
-    ResponseBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr) { Reset(std::move(packet)); }
+    ResponseBuilder() : mHeader(nullptr), mOutput(nullptr, 0), mWriter(&mOutput) {}
+    ResponseBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr), mOutput(nullptr, 0), mWriter(&mOutput)
+    {
+        Reset(std::move(packet));
+    }
 
     ResponseBuilder & Reset(chip::System::PacketBufferHandle && packet)
     {
@@ -48,6 +55,12 @@ public:
             mBuildOk = false;
         }
 
+        // Compression pointers are offsets from the start of the packet, so the
+        // writer covers the whole packet and starts right after the header.
+        mOutput = chip::Encoding::BigEndian::BufferWriter(mPacket->Start(), mPacket->MaxDataLength());
+        mOutput.Skip(mPacket->DataLength());
+        mWriter.Reset();
+
         mHeader.SetFlags(mHeader.GetFlags().SetResponse());
         return *this;
     }
@@ -57,6 +70,8 @@ public:
     {
         mHeader  = HeaderRef(nullptr);
         mBuildOk = false;
+        mOutput  = chip::Encoding::BigEndian::BufferWriter(nullptr, 0);
+        mWriter.Reset();
         return std::move(mPacket);
     }
 
@@ -77,15 +92,15 @@ public:
             return *this;
         }
 
-        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
-
-        if (!record.Append(mHeader, type, out))
+        // Once a record does not fit, nothing else is written to the packet until it is Reset, so the data
+        // written past the packet data length (and the names remembered for compression in it) are ignored.
+        if (!record.Append(mHeader, type, mWriter))
         {
             mBuildOk = false;
         }
         else
         {
-            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+            mPacket->SetDataLength(static_cast<uint16_t>(mOutput.Needed()));
         }
         return *this;
     }
@@ -97,15 +112,13 @@ public:
             return *this;
         }
 
-        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
-
-        if (!query.Append(mHeader, out))
+        if (!query.Append(mHeader, mOutput))
         {
             mBuildOk = false;
         }
         else
         {
-            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+            mPacket->SetDataLength(static_cast<uint16_t>(mOutput.Needed()));
         }
         return *this;
     }
@@ -116,6 +129,8 @@ public:
 private:
     chip::System::PacketBufferHandle mPacket;
     HeaderRef mHeader;
+    chip::Encoding::BigEndian::BufferWriter mOutput; // writes the packet, from its start
+    RecordWriter mWriter;                            // writes records to mOutput
     bool mBuildOk = false;
 };
 
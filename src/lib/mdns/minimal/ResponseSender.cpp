@@ -19,6 +19,7 @@
 
 #include "QueryReplyFilter.h"
 
+#include <lib/support/RandUtils.h>
 #include <system/SystemClock.h>
 
 #define RETURN_IF_ERROR(err)                                                                                                       \
@@ -44,6 +45,21 @@ constexpr uint16_t kMdnsStandardPort = 5353;
 //    the header.
 constexpr uint16_t kPacketSizeBytes = 512;
 
+/// Finds whether a querier already knows any of the records a responder sends.
+class KnownAnswerCheck : public ResponderDelegate
+{
+public:
+    KnownAnswerCheck(const KnownAnswers * knownAnswers) : mKnownAnswers(knownAnswers) {}
+
+    void AddResponse(const ResourceRecord & record) override { mFound = mFound || mKnownAnswers->Contains(record); }
+
+    bool Found() const { return mFound; }
+
+private:
+    const KnownAnswers * mKnownAnswers;
+    bool mFound = false;
+};
+
 } // namespace
 namespace Internal {
 
@@ -61,64 +77,120 @@ bool ResponseSendingState::IncludeQuery() const
 
 CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder)
 {
-    for (size_t i = 0; i < kMaxQueryResponders; ++i)
+    VerifyOrReturnError(queryResponder != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Responders are appended, so that records are sent in the order their responders were added.
+    QueryResponderBase ** link = &mResponders;
+    while (*link != nullptr)
+    {
+        if (*link == queryResponder)
+        {
+            return CHIP_NO_ERROR;
+        }
+        link = &(*link)->mNextQueryResponder;
+    }
+
+    queryResponder->mNextQueryResponder = nullptr;
+    *link                               = queryResponder;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryResponder)
+{
+    for (QueryResponderBase ** link = &mResponders; *link != nullptr; link = &(*link)->mNextQueryResponder)
     {
-        if (mResponder[i] == nullptr || mResponder[i] == queryResponder)
+        if (*link == queryResponder)
         {
-            mResponder[i] = queryResponder;
+            *link                               = queryResponder->mNextQueryResponder;
+            queryResponder->mNextQueryResponder = nullptr;
             return CHIP_NO_ERROR;
         }
     }
-    return CHIP_ERROR_NO_MEMORY;
+    return CHIP_ERROR_KEY_NOT_FOUND;
 }
 
-CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource)
+CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                                   const KnownAnswers * knownAnswers)
 {
-    mSendState.Reset(messageId, query, querySource);
+    mSendState.Reset(messageId, query, querySource, knownAnswers);
+
+    // Only replies that several responders may send (PTR records are shared) are delayed: a single
+    // responder owns the other records, so these are sent immediately.
+    const bool delayReply = (mSystemLayer != nullptr) && !mSendState.SendUnicast() && !query.IsBootAdvertising() &&
+        ((query.GetType() == QType::PTR) || (query.GetType() == QType::ANY));
+
+    if (delayReply && mHasPendingMulticast && (mPendingMulticastSource.Interface != querySource->Interface))
+    {
+        // Records (e.g. IP addresses) depend on the interface, so replies are aggregated per interface.
+        ReturnErrorOnFailure(SendPendingMulticast());
+        mSendState.Reset(messageId, query, querySource, knownAnswers);
+    }
 
     // Responder has a stateful 'additional replies required' that is used within the response
     // loop. 'no additionals required' is set at the start and additionals are marked as the query
     // reply is built.
-    for (size_t i = 0; i < kMaxQueryResponders; ++i)
+    for (QueryResponderBase * responder = mResponders; responder != nullptr; responder = responder->mNextQueryResponder)
     {
-        if (mResponder[i] != nullptr)
-        {
-            mResponder[i]->ResetAdditionals();
-        }
+        responder->ResetAdditionals();
     }
 
+    const uint64_t kTimeNowMs = chip::System::Clock::GetMonotonicMilliseconds();
+
+    // According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
+    //
+    // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
+    //       broadcasts on one interface to throttle broadcasts on another interface.
+    constexpr uint64_t kOneSecondMs    = 1000;
+    const uint64_t multicastThrottleMs = mSendState.SendUnicast() ? 0 : kTimeNowMs - kOneSecondMs;
+
+    bool hasPendingMulticast = false;
+
     // send all 'Answer' replies
     {
-        const uint64_t kTimeNowMs = chip::System::Clock::GetMonotonicMilliseconds();
-
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
 
-        responseFilter.SetReplyFilter(&queryReplyFilter);
+        responseFilter
+            .SetReplyFilter(&queryReplyFilter) //
+            .SetIncludeOnlyMulticastBeforeMS(multicastThrottleMs);
 
-        if (!mSendState.SendUnicast())
-        {
-            // According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
-            //
-            // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
-            //       broadcasts on one interface to throttle broadcasts on another interface.
-            constexpr uint64_t kOneSecondMs = 1000;
-            responseFilter.SetIncludeOnlyMulticastBeforeMS(kTimeNowMs - kOneSecondMs);
-        }
-        for (size_t i = 0; i < kMaxQueryResponders; ++i)
+        // Unless all records are sent, only the records indexed under the queried name can match it.
+        const bool matchAnyName  = query.IsBootAdvertising();
+        const uint32_t queryHash = query.GetName().Hash();
+
+        for (QueryResponderBase * responder = mResponders; responder != nullptr; responder = responder->mNextQueryResponder)
         {
-            if (mResponder[i] == nullptr)
-            {
-                continue;
-            }
-            for (auto it = mResponder[i]->begin(&responseFilter); it != mResponder[i]->end(); it++)
+            auto first = matchAnyName ? responder->begin(&responseFilter) : responder->begin(&responseFilter, queryHash);
+            for (auto it = first; it != responder->end(); it++)
             {
-                it->responder->AddAllResponses(querySource, this);
-                ReturnErrorOnFailure(mSendState.GetError());
+                mSendState.SetKnownAnswerSuppressed(false);
+                if (!delayReply)
+                {
+                    it->responder->AddAllResponses(querySource, this);
+                    ReturnErrorOnFailure(mSendState.GetError());
+                }
+                else if (knownAnswers != nullptr)
+                {
+                    // Records are only built when the delayed reply is sent, check known answers now.
+                    KnownAnswerCheck knownAnswerCheck(knownAnswers);
+                    it->responder->AddAllResponses(querySource, &knownAnswerCheck);
+                    mSendState.SetKnownAnswerSuppressed(knownAnswerCheck.Found());
+                }
 
-                mResponder[i]->MarkAdditionalRepliesFor(it);
+                if (mSendState.GetKnownAnswerSuppressed())
+                {
+                    // The querier has this answer already, so it most likely has its additional records too.
+                    continue;
+                }
 
-                if (!mSendState.SendUnicast())
+                responder->MarkAdditionalRepliesFor(it);
+
+                if (delayReply)
+                {
+                    it.GetInternal()->pendingMulticastAnswer = true;
+                    hasPendingMulticast                      = true;
+                }
+                else if (!mSendState.SendUnicast())
                 {
                     it->lastMulticastTime = kTimeNowMs;
                 }
@@ -137,21 +209,151 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
         QueryResponderRecordFilter responseFilter;
         responseFilter
             .SetReplyFilter(&queryReplyFilter) //
-            .SetIncludeAdditionalRepliesOnly(true);
-        for (size_t i = 0; i < kMaxQueryResponders; ++i)
+            .SetIncludeAdditionalRepliesOnly(true)
+            .SetIncludeOnlyMulticastBeforeMS(multicastThrottleMs);
+        for (QueryResponderBase * responder = mResponders; responder != nullptr; responder = responder->mNextQueryResponder)
         {
-            if (mResponder[i] == nullptr)
+            if (!responder->HasAdditionals())
             {
                 continue;
             }
-            for (auto it = mResponder[i]->begin(&responseFilter); it != mResponder[i]->end(); it++)
+            for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
             {
+                if (delayReply)
+                {
+                    it.GetInternal()->pendingMulticastAdditional = true;
+                    continue;
+                }
+
                 it->responder->AddAllResponses(querySource, this);
                 ReturnErrorOnFailure(mSendState.GetError());
+
+                if (!mSendState.SendUnicast())
+                {
+                    it->lastMulticastTime = kTimeNowMs;
+                }
             }
         }
     }
 
+    if (hasPendingMulticast)
+    {
+        return SchedulePendingMulticast(querySource);
+    }
+
+    return FlushReply();
+}
+
+CHIP_ERROR ResponseSender::SchedulePendingMulticast(const chip::Inet::IPPacketInfo * querySource)
+{
+    ReturnErrorCodeIf(mHasPendingMulticast, CHIP_NO_ERROR); // answers are sent with the reply already scheduled
+
+    mHasPendingMulticast    = true;
+    mPendingMulticastSource = *querySource;
+
+    const uint32_t delayMs = kMinMulticastDelayMs + chip::GetRandU32() % (kMaxMulticastDelayMs - kMinMulticastDelayMs + 1);
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(delayMs, &PendingMulticastTimeout, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to delay mDNS reply: %s", chip::ErrorStr(err));
+        return SendPendingMulticast();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ResponseSender::PendingMulticastTimeout(chip::System::Layer * systemLayer, void * context)
+{
+    CHIP_ERROR err = static_cast<ResponseSender *>(context)->SendPendingMulticast();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to send delayed mDNS reply: %s", chip::ErrorStr(err));
+    }
+}
+
+void ResponseSender::SetSystemLayer(chip::System::Layer * systemLayer)
+{
+    // A system layer that is shut down drops its timers without firing them, so the
+    // delayed reply would never be sent and later browsing queries never answered.
+    CancelPendingMulticast();
+    mSystemLayer = systemLayer;
+}
+
+void ResponseSender::CancelPendingMulticast()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(&PendingMulticastTimeout, this);
+    }
+    mHasPendingMulticast = false;
+
+    QueryResponderRecordFilter filter;
+    for (QueryResponderBase * responder = mResponders; responder != nullptr; responder = responder->mNextQueryResponder)
+    {
+        for (auto it = responder->begin(&filter); it != responder->end(); it++)
+        {
+            it.GetInternal()->pendingMulticastAnswer     = false;
+            it.GetInternal()->pendingMulticastAdditional = false;
+        }
+    }
+}
+
+CHIP_ERROR ResponseSender::SendPendingMulticast()
+{
+    ReturnErrorCodeIf(!mHasPendingMulticast, CHIP_NO_ERROR); // nothing to send
+
+    mHasPendingMulticast = false;
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(&PendingMulticastTimeout, this);
+    }
+
+    // The reply answers several queries, none of which is included in it.
+    const QueryData query(QType::ANY, QClass::ANY, false /* unicast */);
+    mSendState.Reset(0 /* messageId */, query, &mPendingMulticastSource);
+
+    const uint64_t kTimeNowMs = chip::System::Clock::GetMonotonicMilliseconds();
+    QueryResponderRecordFilter responseFilter;
+
+    for (QueryResponderBase * responder = mResponders; responder != nullptr; responder = responder->mNextQueryResponder)
+    {
+        for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
+        {
+            if (!it.GetInternal()->pendingMulticastAnswer)
+            {
+                continue;
+            }
+
+            it->responder->AddAllResponses(&mPendingMulticastSource, this);
+            ReturnErrorOnFailure(mSendState.GetError());
+            it->lastMulticastTime = kTimeNowMs;
+        }
+    }
+
+    mSendState.SetResourceType(ResourceType::kAdditional);
+    for (QueryResponderBase * responder = mResponders; responder != nullptr; responder = responder->mNextQueryResponder)
+    {
+        for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
+        {
+            Internal::QueryResponderInfo * info = it.GetInternal();
+
+            // Records that are answers already are not repeated as additional data.
+            const bool sendAsAdditional      = info->pendingMulticastAdditional && !info->pendingMulticastAnswer;
+            info->pendingMulticastAnswer     = false;
+            info->pendingMulticastAdditional = false;
+
+            if (!sendAsAdditional)
+            {
+                continue;
+            }
+
+            it->responder->AddAllResponses(&mPendingMulticastSource, this);
+            ReturnErrorOnFailure(mSendState.GetError());
+            it->lastMulticastTime = kTimeNowMs;
+        }
+    }
+
     return FlushReply();
 }
 
@@ -199,6 +401,12 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
 {
     RETURN_IF_ERROR(mSendState.GetError());
 
+    if (mSendState.IsKnownAnswer(record))
+    {
+        mSendState.SetKnownAnswerSuppressed(true);
+        return;
+    }
+
     if (!mResponseBuilder.HasPacketBuffer())
     {
         mSendState.SetError(PrepareNewReplyPacket());
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "KnownAnswers.h"
 #include "Parser.h"
 #include "ResponseBuilder.h"
 #include "Server.h"
@@ -24,6 +25,7 @@
 #include <lib/mdns/minimal/responders/QueryResponder.h>
 
 #include <inet/InetLayer.h>
+#include <system/SystemLayer.h>
 #include <system/SystemPacketBuffer.h>
 
 namespace mdns {
@@ -37,13 +39,16 @@ class ResponseSendingState
 public:
     ResponseSendingState() {}
 
-    void Reset(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * packet)
+    void Reset(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * packet,
+               const KnownAnswers * knownAnswers = nullptr)
     {
-        mMessageId    = messageId;
-        mQuery        = &query;
-        mSource       = packet;
-        mSendError    = CHIP_NO_ERROR;
-        mResourceType = ResourceType::kAnswer;
+        mMessageId             = messageId;
+        mQuery                 = &query;
+        mSource                = packet;
+        mKnownAnswers          = knownAnswers;
+        mSendError             = CHIP_NO_ERROR;
+        mResourceType          = ResourceType::kAnswer;
+        mKnownAnswerSuppressed = false;
     }
 
     void SetResourceType(ResourceType resourceType) { mResourceType = resourceType; }
@@ -60,6 +65,16 @@ public:
 
     const QueryData * GetQuery() const { return mQuery; }
 
+    /// Check if the given record is already known by the querier and should not be sent
+    bool IsKnownAnswer(const ResourceRecord & record) const
+    {
+        return (mKnownAnswers != nullptr) && (mResourceType == ResourceType::kAnswer) && mKnownAnswers->Contains(record);
+    }
+
+    /// Tracks whether a record was suppressed because the querier knows it already
+    void SetKnownAnswerSuppressed(bool suppressed) { mKnownAnswerSuppressed = suppressed; }
+    bool GetKnownAnswerSuppressed() const { return mKnownAnswerSuppressed; }
+
     /// Check if the reply should be sent as a unicast reply
     bool SendUnicast() const;
 
@@ -75,9 +90,11 @@ public:
 private:
     const QueryData * mQuery                 = nullptr;               // query being replied to
     const chip::Inet::IPPacketInfo * mSource = nullptr;               // Where to send the reply (if unicast)
+    const KnownAnswers * mKnownAnswers       = nullptr;               // records the querier already has
     uint32_t mMessageId                      = 0;                     // message id for the reply
     ResourceType mResourceType               = ResourceType::kAnswer; // what is being sent right now
     CHIP_ERROR mSendError                    = CHIP_NO_ERROR;
+    bool mKnownAnswerSuppressed              = false;                 // a known answer was not sent
 };
 
 } // namespace Internal
@@ -86,29 +103,61 @@ private:
 ///
 /// Handles processing the query via a QueryResponderBase and then sending back the reply
 /// using appropriate paths (unicast or multicast) via the given Server.
+///
+/// When a system layer is set, multicast replies to queries that shared records (PTR) may
+/// answer are delayed by a random time, as described in RFC 6762 section 6. The answers to all
+/// the queries received on the same interface meanwhile are then sent in a single reply.
 class ResponseSender : public ResponderDelegate
 {
 public:
-    // TODO(cecille): Template this and set appropriately. Please see issue #8000.
-    static constexpr size_t kMaxQueryResponders = 7;
+    static constexpr uint32_t kMinMulticastDelayMs = 20;
+    static constexpr uint32_t kMaxMulticastDelayMs = 120;
+
     ResponseSender(ServerBase * server) : mServer(server) {}
 
+    /// Adds a query responder whose records are sent in replies. There is no limit on the number of
+    /// query responders, which are linked together. Adding a query responder already added is a no-op.
     CHIP_ERROR AddQueryResponder(QueryResponderBase * queryResponder);
 
+    /// Stops sending the records of the given query responder.
+    CHIP_ERROR RemoveQueryResponder(QueryResponderBase * queryResponder);
+
     /// Send back the response to a particular query
-    CHIP_ERROR Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource);
+    ///
+    /// Answers listed in knownAnswers (if any) are not sent, nor are their additional records.
+    CHIP_ERROR Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                       const KnownAnswers * knownAnswers = nullptr);
 
     // Implementation of ResponderDelegate
     void AddResponse(const ResourceRecord & record) override;
 
     void SetServer(ServerBase * server) { mServer = server; }
 
+    /// Sets the system layer used to delay multicast replies. Replies are sent immediately
+    /// when there is none. Any delayed reply scheduled on the previous system layer is dropped.
+    void SetSystemLayer(chip::System::Layer * systemLayer);
+
+    /// Sends the delayed multicast reply now, if there is one.
+    CHIP_ERROR SendPendingMulticast();
+
+    /// Drops the delayed multicast reply, if there is one, without sending it.
+    void CancelPendingMulticast();
+
 private:
+    static void PendingMulticastTimeout(chip::System::Layer * systemLayer, void * context);
+
+    /// Schedules sending the records marked as pending multicast, unless already scheduled.
+    CHIP_ERROR SchedulePendingMulticast(const chip::Inet::IPPacketInfo * querySource);
+
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
 
     ServerBase * mServer;
-    QueryResponderBase * mResponder[kMaxQueryResponders] = {};
+    chip::System::Layer * mSystemLayer = nullptr;
+    QueryResponderBase * mResponders   = nullptr; // first of the query responders linked through mNextQueryResponder
+
+    bool mHasPendingMulticast = false;                // a delayed multicast reply is scheduled
+    chip::Inet::IPPacketInfo mPendingMulticastSource; // source of the first query the delayed reply answers
 
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
@@ -15,12 +15,29 @@
  *    limitations under the License.
  */
 #include <assert.h>
+#include <ctype.h>
 #include <strings.h>
 
 #include "QName.h"
 
 namespace mdns {
 namespace Minimal {
+namespace {
+
+constexpr uint32_t kHashOffsetBasis = 2166136261u; // 32-bit FNV-1a
+constexpr uint32_t kHashPrime       = 16777619u;
+
+uint32_t HashNamePart(uint32_t hash, QNamePart part)
+{
+    for (const char * c = part; *c != '\0'; c++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(tolower(static_cast<unsigned char>(*c)))) * kHashPrime;
+    }
+    // Separate parts, so that e.g. "ab.c" and "a.bc" differ.
+    return (hash ^ static_cast<uint8_t>('.')) * kHashPrime;
+}
+
+} // namespace
 
 bool SerializedQNameIterator::Next()
 {
@@ -152,6 +169,31 @@ bool SerializedQNameIterator::operator==(const FullQName & other) const
     return ((idx == other.nameCount) && !self.Next());
 }
 
+uint32_t SerializedQNameIterator::Hash() const
+{
+    SerializedQNameIterator self = *this; // allow iteration
+    uint32_t hash                = kHashOffsetBasis;
+
+    while (self.Next())
+    {
+        hash = HashNamePart(hash, self.Value());
+    }
+
+    return hash;
+}
+
+uint32_t FullQName::Hash() const
+{
+    uint32_t hash = kHashOffsetBasis;
+
+    for (size_t i = 0; i < nameCount; i++)
+    {
+        hash = HashNamePart(hash, names[i]);
+    }
+
+    return hash;
+}
+
 bool FullQName::operator==(const FullQName & other) const
 {
     if (nameCount != other.nameCount)
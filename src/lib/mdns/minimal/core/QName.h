@@ -66,6 +66,10 @@ struct FullQName
 
     bool operator==(const FullQName & other) const;
     bool operator!=(const FullQName & other) const { return !(*this == other); }
+
+    /// Case-insensitive hash of the name, equal to the hash of any equal name
+    /// (including SerializedQNameIterator::Hash of an equal serialized name).
+    uint32_t Hash() const;
 };
 
 /// A serialized QNAME is comprised of
@@ -108,6 +112,10 @@ public:
     bool operator==(const FullQName & other) const;
     bool operator!=(const FullQName & other) const { return !(*this == other); }
 
+    /// Case-insensitive hash of the remaining parts of the name, equal to
+    /// FullQName::Hash of an equal name. Does not change iterator state.
+    uint32_t Hash() const;
+
     void Put(chip::Encoding::BigEndian::BufferWriter & out) const
     {
         SerializedQNameIterator copy = *this;
@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "RecordWriter.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+namespace mdns {
+namespace Minimal {
+
+void RecordWriter::Reset()
+{
+    for (auto & offset : mPreviousNames)
+    {
+        offset = kInvalidOffset;
+    }
+}
+
+RecordWriter & RecordWriter::WriteQName(const FullQName & qname)
+{
+    // Offsets of the parts written, which become compression targets once the name is complete.
+    size_t partOffsets[kMaxCachedReferences];
+    size_t partCount = 0;
+
+    for (size_t i = 0; i < qname.nameCount; i++)
+    {
+        FullQName suffix;
+        suffix.names     = qname.names + i;
+        suffix.nameCount = qname.nameCount - i;
+
+        uint16_t previous = FindPreviousName(suffix);
+        if (previous != kInvalidOffset)
+        {
+            mOutput->Put16(static_cast<uint16_t>((kPointerMarker << 8) | previous));
+            break;
+        }
+
+        if (partCount < kMaxCachedReferences)
+        {
+            partOffsets[partCount++] = mOutput->Needed();
+        }
+        mOutput->Put8(static_cast<uint8_t>(strlen(qname.names[i])));
+        mOutput->Put(qname.names[i]);
+
+        if (i + 1 == qname.nameCount)
+        {
+            mOutput->Put8(0); // end of qnames
+        }
+    }
+
+    if (qname.nameCount == 0)
+    {
+        mOutput->Put8(0);
+    }
+
+    // Only names that were fully written can be pointed to.
+    if (mOutput->Fit())
+    {
+        for (size_t i = 0; i < partCount; i++)
+        {
+            RememberName(partOffsets[i]);
+        }
+    }
+
+    return *this;
+}
+
+uint16_t RecordWriter::FindPreviousName(const FullQName & name) const
+{
+    const uint8_t * start = mOutput->Buffer();
+    BytesRange validData(start, start + std::min(mOutput->Needed(), mOutput->Size()));
+
+    for (uint16_t offset : mPreviousNames)
+    {
+        if (offset == kInvalidOffset)
+        {
+            break;
+        }
+
+        SerializedQNameIterator previousName(validData, start + offset);
+        if (previousName == name)
+        {
+            return offset;
+        }
+    }
+
+    return kInvalidOffset;
+}
+
+void RecordWriter::RememberName(size_t offset)
+{
+    if (offset > kMaxReferenceOffset)
+    {
+        return;
+    }
+
+    for (auto & previous : mPreviousNames)
+    {
+        if (previous == kInvalidOffset)
+        {
+            previous = static_cast<uint16_t>(offset);
+            return;
+        }
+    }
+}
+
+} // namespace Minimal
+} // namespace mdns
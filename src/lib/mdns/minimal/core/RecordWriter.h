@@ -0,0 +1,112 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/mdns/minimal/core/QName.h>
+#include <lib/support/BufferWriter.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Writes the content of a DNS message, compressing the QNames it writes.
+///
+/// A QName ending with a QName previously written by the same writer is
+/// written as its leading parts followed by a pointer to the previous
+/// occurrence (RFC 1035 section 4.1.4), so that names such as
+/// "_matterc._udp.local" are only sent once per message.
+///
+/// The underlying buffer writer MUST start at the beginning of the DNS message
+/// (i.e. at the header), as pointers are offsets from the message start.
+class RecordWriter
+{
+public:
+    RecordWriter(chip::Encoding::BigEndian::BufferWriter * output) : mOutput(output) { Reset(); }
+    RecordWriter(const RecordWriter &) = delete;
+    RecordWriter & operator=(const RecordWriter &) = delete;
+
+    /// Forget about all the QNames written so far, e.g. when the underlying
+    /// writer is reset to write a new message.
+    void Reset();
+
+    chip::Encoding::BigEndian::BufferWriter & Writer() { return *mOutput; }
+
+    RecordWriter & Put8(uint8_t value)
+    {
+        mOutput->Put8(value);
+        return *this;
+    }
+
+    RecordWriter & Put16(uint16_t value)
+    {
+        mOutput->Put16(value);
+        return *this;
+    }
+
+    RecordWriter & Put32(uint32_t value)
+    {
+        mOutput->Put32(value);
+        return *this;
+    }
+
+    RecordWriter & Put(const char * value)
+    {
+        mOutput->Put(value);
+        return *this;
+    }
+
+    RecordWriter & Put(const void * buffer, size_t length)
+    {
+        mOutput->Put(buffer, length);
+        return *this;
+    }
+
+    /// Writes the given QName, replacing its longest suffix that was
+    /// previously written by a pointer.
+    RecordWriter & WriteQName(const FullQName & qname);
+
+    size_t Needed() const { return mOutput->Needed(); }
+    bool Fit() const { return mOutput->Fit(); }
+
+private:
+    // Number of name offsets remembered for compression. This covers the
+    // distinct labels of typical CHIP responses (service, sub-types, instance
+    // and host names); names written once the table is full are not used
+    // as compression targets.
+    static constexpr size_t kMaxCachedReferences = 16;
+
+    // Pointers only have 14 bits for the offset.
+    static constexpr size_t kMaxReferenceOffset = 0x3FFF;
+    static constexpr uint16_t kInvalidOffset    = 0xFFFF;
+    static constexpr uint8_t kPointerMarker     = 0xC0;
+
+    /// Returns the offset of a previously written QName equal to the given one,
+    /// or kInvalidOffset if there is none.
+    uint16_t FindPreviousName(const FullQName & name) const;
+
+    /// Remembers that a QName starts at the given offset.
+    void RememberName(size_t offset);
+
+    chip::Encoding::BigEndian::BufferWriter * mOutput;
+    uint16_t mPreviousNames[kMaxCachedReferences];
+};
+
+} // namespace Minimal
+} // namespace mdns
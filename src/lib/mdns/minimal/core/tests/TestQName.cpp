@@ -237,6 +237,34 @@ void CaseInsensitiveFullQNameCompare(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void Hash(nlTestSuite * inSuite, void * inContext)
+{
+    const QNamePart kName[]       = { "some", "test", "local" };
+    const QNamePart kUpperName[]  = { "SOME", "Test", "LOCAL" };
+    const QNamePart kOtherName[]  = { "other", "test", "local" };
+    const QNamePart kJoinedName[] = { "sometest", "local" };
+
+    const uint8_t kSerialized[] = { 4, 's', 'o', 'm', 'e', 4, 'T', 'E', 'S', 'T', 5, 'l', 'o', 'c', 'a', 'l', 0 };
+    const uint8_t kCompressed[] = {
+        5, 'l', 'o', 'c', 'a', 'l', 0,    // local
+        4, 's', 'o', 'm', 'e',            // some
+        4, 't', 'e', 's', 't', 0xC0, 0x00 // test + pointer to local
+    };
+
+    NL_TEST_ASSERT(inSuite, FullQName(kName).Hash() == FullQName(kUpperName).Hash());
+    NL_TEST_ASSERT(inSuite, FullQName(kName).Hash() != FullQName(kOtherName).Hash());
+    NL_TEST_ASSERT(inSuite, FullQName(kName).Hash() != FullQName(kJoinedName).Hash());
+
+    SerializedQNameIterator serialized(BytesRange(kSerialized, kSerialized + sizeof(kSerialized)), kSerialized);
+    NL_TEST_ASSERT(inSuite, serialized.Hash() == FullQName(kName).Hash());
+
+    SerializedQNameIterator compressed(BytesRange(kCompressed, kCompressed + sizeof(kCompressed)), kCompressed + 7);
+    NL_TEST_ASSERT(inSuite, compressed.Hash() == FullQName(kName).Hash());
+
+    // Hashing does not consume the name
+    NL_TEST_ASSERT(inSuite, compressed == FullQName(kName));
+}
+
 } // namespace
 
 // clang-format off
@@ -247,6 +275,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Comparison", Comparison),
     NL_TEST_DEF("CaseInsensitiveSerializedCompare", CaseInsensitiveSerializedCompare),
     NL_TEST_DEF("CaseInsensitiveFullQNameCompare", CaseInsensitiveFullQNameCompare),
+    NL_TEST_DEF("Hash", Hash),
 
     NL_TEST_SENTINEL()
 };
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/mdns/minimal/core/RecordWriter.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace mdns::Minimal;
+using namespace chip::Encoding::BigEndian;
+
+void CompressesSuffixes(nlTestSuite * inSuite, void * inContext)
+{
+    const QNamePart kName1[] = { "some", "test", "local" };
+    const QNamePart kName2[] = { "other", "test", "local" };
+    const QNamePart kName3[] = { "test", "local" };
+    const QNamePart kName4[] = { "some", "test", "local" };
+    const QNamePart kName5[] = { "other", "local" };
+
+    uint8_t dataBuffer[128];
+    BufferWriter output(dataBuffer, sizeof(dataBuffer));
+    RecordWriter writer(&output);
+
+    writer.WriteQName(kName1).WriteQName(kName2).WriteQName(kName3).WriteQName(kName4).WriteQName(kName5);
+
+    const uint8_t expectedOutput[] = {
+        4,    's', 'o', 'm', 'e',      // QNAME part: some
+        4,    't', 'e', 's', 't',      // QNAME part: test
+        5,    'l', 'o', 'c', 'a', 'l', // QNAME part: local
+        0,                             // QNAME ends
+        5,    'o', 't', 'h', 'e', 'r', // QNAME part: other
+        0xC0, 5,                       // pointer to test.local
+        0xC0, 5,                       // pointer to test.local
+        0xC0, 0,                       // pointer to some.test.local
+        5,    'o', 't', 'h', 'e', 'r', // QNAME part: other
+        0xC0, 10,                      // pointer to local
+    };
+
+    NL_TEST_ASSERT(inSuite, output.Fit());
+    NL_TEST_ASSERT(inSuite, output.Needed() == sizeof(expectedOutput));
+    NL_TEST_ASSERT(inSuite, memcmp(dataBuffer, expectedOutput, sizeof(expectedOutput)) == 0);
+}
+
+void ResetForgetsNames(nlTestSuite * inSuite, void * inContext)
+{
+    const QNamePart kName[] = { "test", "local" };
+
+    uint8_t dataBuffer[128];
+    BufferWriter output(dataBuffer, sizeof(dataBuffer));
+    RecordWriter writer(&output);
+
+    writer.WriteQName(kName);
+    NL_TEST_ASSERT(inSuite, output.Needed() == 12);
+
+    writer.WriteQName(kName);
+    NL_TEST_ASSERT(inSuite, output.Needed() == 14);
+
+    writer.Reset();
+    writer.WriteQName(kName);
+    NL_TEST_ASSERT(inSuite, output.Needed() == 26);
+}
+
+void NamesThatDoNotFitAreNotReferenced(nlTestSuite * inSuite, void * inContext)
+{
+    const QNamePart kName[] = { "test", "local" };
+
+    uint8_t dataBuffer[128];
+    BufferWriter output(dataBuffer, 8);
+    RecordWriter writer(&output);
+
+    writer.WriteQName(kName);
+    NL_TEST_ASSERT(inSuite, !output.Fit());
+
+    // The name was cut short, so it is written again rather than pointing into missing data.
+    writer.WriteQName(kName);
+    NL_TEST_ASSERT(inSuite, output.Needed() == 24);
+}
+
+void CompressesTypicalResponse(nlTestSuite * inSuite, void * inContext)
+{
+    // Names of the records sent in a response advertising a commissionable node.
+    const QNamePart kService[]        = { "_matterc", "_udp", "local" };
+    const QNamePart kInstance[]       = { "BE5E69B7F6B7F0AD", "_matterc", "_udp", "local" };
+    const QNamePart kLongSubtype[]    = { "_L3840", "_sub", "_matterc", "_udp", "local" };
+    const QNamePart kShortSubtype[]   = { "_S15", "_sub", "_matterc", "_udp", "local" };
+    const QNamePart kCommissionMode[] = { "_CM", "_sub", "_matterc", "_udp", "local" };
+    const QNamePart kHost[]           = { "E45F010F27530000", "local" };
+    const FullQName kResponseNames[]  = {
+        kService,        kInstance, // PTR
+        kLongSubtype,    kInstance, // PTR
+        kShortSubtype,   kInstance, // PTR
+        kCommissionMode, kInstance, // PTR
+        kInstance,       kHost,     // SRV
+        kInstance,                  // TXT
+        kHost,                      // AAAA
+        kHost,                      // A
+    };
+    constexpr size_t kNameCount = sizeof(kResponseNames) / sizeof(kResponseNames[0]);
+
+    uint8_t uncompressedBuffer[512];
+    BufferWriter uncompressed(uncompressedBuffer, sizeof(uncompressedBuffer));
+
+    uint8_t dataBuffer[512];
+    BufferWriter output(dataBuffer, sizeof(dataBuffer));
+    RecordWriter writer(&output);
+
+    size_t offsets[kNameCount];
+    for (size_t i = 0; i < kNameCount; i++)
+    {
+        kResponseNames[i].Output(uncompressed);
+
+        offsets[i] = output.Needed();
+        writer.WriteQName(kResponseNames[i]);
+    }
+
+    NL_TEST_ASSERT(inSuite, uncompressed.Fit());
+    NL_TEST_ASSERT(inSuite, output.Fit());
+
+    // Every name reads back as written.
+    BytesRange validData(dataBuffer, dataBuffer + output.Needed());
+    for (size_t i = 0; i < kNameCount; i++)
+    {
+        SerializedQNameIterator it(validData, dataBuffer + offsets[i]);
+        NL_TEST_ASSERT(inSuite, it == kResponseNames[i]);
+    }
+
+    // Each name is written up to its first suffix already in the output, then points to it: 21 bytes for the service name,
+    // 19 for the instance name, 14, 7 and 6 for the sub-types, 19 for the host name and 2 for each of the 7 other
+    // occurrences of the instance and host names.
+    NL_TEST_ASSERT(inSuite, output.Needed() == 21 + 19 + 14 + 7 + 6 + 19 + 7 * 2);
+    NL_TEST_ASSERT(inSuite, uncompressed.Needed() > 3 * output.Needed());
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("CompressesSuffixes", CompressesSuffixes),                               //
+    NL_TEST_DEF("ResetForgetsNames", ResetForgetsNames),                                 //
+    NL_TEST_DEF("NamesThatDoNotFitAreNotReferenced", NamesThatDoNotFitAreNotReferenced), //
+    NL_TEST_DEF("CompressesTypicalResponse", CompressesTypicalResponse),                 //
+    NL_TEST_SENTINEL()                                                                   //
+};
+
+} // namespace
+
+int TestRecordWriter(void)
+{
+    nlTestSuite theSuite = { "RecordWriter", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestRecordWriter)
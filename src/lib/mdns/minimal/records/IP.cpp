@@ -20,7 +20,7 @@
 namespace mdns {
 namespace Minimal {
 
-bool IPResourceRecord::WriteData(chip::Encoding::BigEndian::BufferWriter & out) const
+bool IPResourceRecord::WriteData(RecordWriter & out) const
 {
     // IP address is already stored in network byte order, hence raw bytes put
     if (mIPAddress.IsIPv6())
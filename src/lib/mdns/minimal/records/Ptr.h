@@ -30,9 +30,9 @@ public:
     const FullQName & GetPtr() const { return mPtrName; }
 
 protected:
-    bool WriteData(chip::Encoding::BigEndian::BufferWriter & out) const override
+    bool WriteData(RecordWriter & out) const override
     {
-        mPtrName.Output(out);
+        out.WriteQName(mPtrName);
         return out.Fit();
     }
 
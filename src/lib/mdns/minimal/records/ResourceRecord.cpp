@@ -20,7 +20,7 @@
 namespace mdns {
 namespace Minimal {
 
-bool ResourceRecord::Append(HeaderRef & hdr, ResourceType asType, chip::Encoding::BigEndian::BufferWriter & out) const
+bool ResourceRecord::Append(HeaderRef & hdr, ResourceType asType, RecordWriter & out) const
 {
     // order is important based on resource type. First come answers, then authorityAnswers
     // and then additional:
@@ -33,7 +33,7 @@ bool ResourceRecord::Append(HeaderRef & hdr, ResourceType asType, chip::Encoding
         return false;
     }
 
-    mQName.Output(out);
+    out.WriteQName(mQName);
 
     out                                           //
         .Put16(static_cast<uint16_t>(GetType()))  //
@@ -41,8 +41,8 @@ bool ResourceRecord::Append(HeaderRef & hdr, ResourceType asType, chip::Encoding
         .Put32(static_cast<uint32_t>(GetTtl()))   //
         ;
 
-    chip::Encoding::BigEndian::BufferWriter sizeOutput(out); // copy to re-output size
-    out.Put16(0);                                            // dummy, will be replaced later
+    chip::Encoding::BigEndian::BufferWriter sizeOutput(out.Writer()); // copy to re-output size
+    out.Put16(0);                                                     // dummy, will be replaced later
 
     if (!WriteData(out))
     {
@@ -21,8 +21,7 @@
 
 #include <lib/mdns/minimal/core/Constants.h>
 #include <lib/mdns/minimal/core/QName.h>
-
-#include <lib/support/BufferWriter.h>
+#include <lib/mdns/minimal/core/RecordWriter.h>
 
 namespace mdns {
 namespace Minimal {
@@ -57,11 +56,11 @@ public:
 
     /// Append the given record to the underlying output.
     /// Updates header item count on success, does NOT update header on failure.
-    bool Append(HeaderRef & hdr, ResourceType asType, chip::Encoding::BigEndian::BufferWriter & out) const;
+    bool Append(HeaderRef & hdr, ResourceType asType, RecordWriter & out) const;
 
 protected:
     /// Output the data portion of the resource record.
-    virtual bool WriteData(chip::Encoding::BigEndian::BufferWriter & out) const = 0;
+    virtual bool WriteData(RecordWriter & out) const = 0;
 
     ResourceRecord(QType type, FullQName name) : mType(type), mQName(name) {}
 
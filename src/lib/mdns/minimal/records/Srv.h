@@ -40,12 +40,12 @@ public:
     void SetWeight(uint16_t value) { mWeight = value; }
 
 protected:
-    bool WriteData(chip::Encoding::BigEndian::BufferWriter & out) const override
+    bool WriteData(RecordWriter & out) const override
     {
         out.Put16(mPriority);
         out.Put16(mWeight);
         out.Put16(mPort);
-        mServerName.Output(out);
+        out.WriteQName(mServerName);
 
         return out.Fit();
     }
@@ -52,7 +52,7 @@ public:
     const char * const * GetEntries() const { return mEntries; }
 
 protected:
-    bool WriteData(chip::Encoding::BigEndian::BufferWriter & out) const override
+    bool WriteData(RecordWriter & out) const override
     {
         for (size_t i = 0; i < mEntryCount; i++)
         {
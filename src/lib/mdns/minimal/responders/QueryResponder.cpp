@@ -26,8 +26,10 @@ namespace Minimal {
 
 const QNamePart kDnsSdQueryPath[] = { "_services", "_dns-sd", "_udp", "local" };
 
-QueryResponderBase::QueryResponderBase(Internal::QueryResponderInfo * infos, size_t infoSizes) :
-    Responder(QType::PTR, FullQName(kDnsSdQueryPath)), mResponderInfos(infos), mResponderInfoSize(infoSizes)
+QueryResponderBase::QueryResponderBase(Internal::QueryResponderInfo * infos, size_t infoSizes, size_t * nameIndex,
+                                       size_t nameIndexSize) :
+    Responder(QType::PTR, FullQName(kDnsSdQueryPath)),
+    mResponderInfos(infos), mResponderInfoSize(infoSizes), mNameIndex(nameIndex), mNameIndexSize(nameIndexSize)
 {}
 
 void QueryResponderBase::Init()
@@ -36,11 +38,17 @@ void QueryResponderBase::Init()
     {
         mResponderInfos[i].Clear();
     }
+    for (size_t i = 0; i < mNameIndexSize; i++)
+    {
+        mNameIndex[i] = Internal::QueryResponderInfo::kNoRecord;
+    }
+    mAdditionalCount = 0;
 
     if (mResponderInfoSize > 0)
     {
         // reply to queries about services available
         mResponderInfos[0].responder = this;
+        IndexRecord(0);
     }
 
     if (mResponderInfoSize < 2)
@@ -63,6 +71,7 @@ QueryResponderSettings QueryResponderBase::AddResponder(RecordResponder * respon
         {
             mResponderInfos[i].Clear();
             mResponderInfos[i].responder = responder;
+            IndexRecord(i);
 
             return QueryResponderSettings(&mResponderInfos[i]);
         }
@@ -70,25 +79,46 @@ QueryResponderSettings QueryResponderBase::AddResponder(RecordResponder * respon
     return QueryResponderSettings();
 }
 
+void QueryResponderBase::IndexRecord(size_t index)
+{
+    if (mNameIndexSize == 0)
+    {
+        return;
+    }
+
+    const size_t bucket = mResponderInfos[index].responder->GetQName().Hash() % mNameIndexSize;
+
+    mResponderInfos[index].nextWithSameNameHash = mNameIndex[bucket];
+    mNameIndex[bucket]                          = index;
+}
+
 void QueryResponderBase::ResetAdditionals()
 {
+    if (mAdditionalCount == 0)
+    {
+        return; // nothing marked
+    }
 
     for (size_t i = 0; i < mResponderInfoSize; i++)
     {
         mResponderInfos[i].reportNowAsAdditional = false;
     }
+    mAdditionalCount = 0;
 }
 
 size_t QueryResponderBase::MarkAdditional(const FullQName & qname)
 {
-    size_t count = 0;
-    for (size_t i = 0; i < mResponderInfoSize; i++)
+    if (mNameIndexSize == 0)
     {
-        if (mResponderInfos[i].responder == nullptr)
-        {
-            continue; // not a valid entry
-        }
+        return 0;
+    }
 
+    size_t count = 0;
+
+    // only records in the bucket of the name can match it
+    size_t i = mNameIndex[qname.Hash() % mNameIndexSize];
+    for (; i != Internal::QueryResponderInfo::kNoRecord; i = mResponderInfos[i].nextWithSameNameHash)
+    {
         if (mResponderInfos[i].reportNowAsAdditional)
         {
             continue; // already marked
@@ -101,6 +131,7 @@ size_t QueryResponderBase::MarkAdditional(const FullQName & qname)
         }
     }
 
+    mAdditionalCount += count;
     return count;
 }
 
@@ -23,9 +23,13 @@
 
 #include <inet/InetLayer.h>
 
+#include <cstdint>
+
 namespace mdns {
 namespace Minimal {
 
+class ResponseSender;
+
 /// Represents available data (replies) for mDNS queries.
 struct QueryResponderRecord
 {
@@ -39,17 +43,27 @@ namespace Internal {
 /// Internal information for query responder records.
 struct QueryResponderInfo : public QueryResponderRecord
 {
+    static constexpr size_t kNoRecord = SIZE_MAX;
+
     bool reportNowAsAdditional; // report as additional data required
 
     bool alsoReportAdditionalQName = false; // report more data when this record is listed
     FullQName additionalQName;              // if alsoReportAdditionalQName is set, send this extra data
 
+    size_t nextWithSameNameHash = kNoRecord; // next record in the same bucket of the name index
+
+    bool pendingMulticastAnswer     = false; // to be sent as an answer in the delayed multicast reply
+    bool pendingMulticastAdditional = false; // to be sent as additional data in the delayed multicast reply
+
     void Clear()
     {
-        responder                 = nullptr;
-        reportService             = false;
-        reportNowAsAdditional     = false;
-        alsoReportAdditionalQName = false;
+        responder                  = nullptr;
+        reportService              = false;
+        reportNowAsAdditional      = false;
+        alsoReportAdditionalQName  = false;
+        nextWithSameNameHash       = kNoRecord;
+        pendingMulticastAnswer     = false;
+        pendingMulticastAdditional = false;
     }
 };
 
@@ -161,6 +175,9 @@ private:
 
 /// Iterates over an array of QueryResponderRecord items, providing only 'valid' ones, where
 /// valid is based on the provided filter.
+///
+/// The iteration goes either through the whole array, or through the records
+/// of a single bucket of the name index of a QueryResponderBase.
 class QueryResponderIterator
 {
 public:
@@ -174,16 +191,23 @@ public:
     {
         SkipInvalid();
     }
+    /// Iterates over the records linked through nextWithSameNameHash, starting at infos[first].
+    static QueryResponderIterator ForBucket(QueryResponderRecordFilter * recordFilter, Internal::QueryResponderInfo * infos,
+                                            size_t first)
+    {
+        QueryResponderIterator it;
+        it.mFilter      = recordFilter;
+        it.mBucketInfos = infos;
+        it.mCurrent     = RecordAt(infos, first);
+        it.SkipInvalid();
+        return it;
+    }
     QueryResponderIterator(const QueryResponderIterator & other) = default;
     QueryResponderIterator & operator=(const QueryResponderIterator & other) = default;
 
     QueryResponderIterator & operator++()
     {
-        if (mRemaining != 0)
-        {
-            mCurrent++;
-            mRemaining--;
-        }
+        Advance();
         SkipInvalid();
         return *this;
     }
@@ -205,24 +229,49 @@ public:
     const Internal::QueryResponderInfo * GetInternal() const { return mCurrent; }
 
 private:
+    static Internal::QueryResponderInfo * RecordAt(Internal::QueryResponderInfo * infos, size_t index)
+    {
+        return (index == Internal::QueryResponderInfo::kNoRecord) ? nullptr : infos + index;
+    }
+
+    bool AtEnd() const { return (mBucketInfos != nullptr) ? (mCurrent == nullptr) : (mRemaining == 0); }
+
+    void Advance()
+    {
+        if (AtEnd())
+        {
+            return;
+        }
+
+        if (mBucketInfos != nullptr)
+        {
+            mCurrent = RecordAt(mBucketInfos, mCurrent->nextWithSameNameHash);
+        }
+        else
+        {
+            mCurrent++;
+            mRemaining--;
+        }
+    }
+
     /// Skips invalid/not useful values.
-    /// ensures that if mRemaining is 0, mCurrent is nullptr;
+    /// ensures that at the end of the iteration, mCurrent is nullptr;
     void SkipInvalid()
     {
-        while ((mRemaining > 0) && !mFilter->Accept(mCurrent))
+        while (!AtEnd() && !mFilter->Accept(mCurrent))
         {
-            mRemaining--;
-            mCurrent++;
+            Advance();
         }
-        if (mRemaining == 0)
+        if (AtEnd())
         {
             mCurrent = nullptr;
         }
     }
 
     QueryResponderRecordFilter * mFilter;
+    Internal::QueryResponderInfo * mBucketInfos = nullptr; // set when iterating over a bucket of the name index
     Internal::QueryResponderInfo * mCurrent;
-    size_t mRemaining;
+    size_t mRemaining; // records left in the array, unused when iterating over a bucket
 };
 
 /// Responds to mDNS queries.
@@ -233,11 +282,15 @@ private:
 ///
 /// Maintains a stateful list of 'additional replies' that can be marked/unmarked
 /// for query processing
+///
+/// Records are indexed by the hash of their name, so that the records matching
+/// the name of a query are found without going through all of them.
 class QueryResponderBase : public Responder // "_services._dns-sd._udp.local"
 {
 public:
-    /// Builds a new responder with the given storage for the response infos
-    QueryResponderBase(Internal::QueryResponderInfo * infos, size_t infoSizes);
+    /// Builds a new responder with the given storage for the response infos and
+    /// for the buckets of the name index.
+    QueryResponderBase(Internal::QueryResponderInfo * infos, size_t infoSizes, size_t * nameIndex, size_t nameIndexSize);
     virtual ~QueryResponderBase() {}
 
     /// Setup initial settings (clears all infos and sets up dns-sd query replies)
@@ -257,11 +310,25 @@ public:
     {
         return QueryResponderIterator(filter, mResponderInfos, mResponderInfoSize);
     }
+
+    /// Iterates over the records whose name hash is `nameHash` (plus, rarely, records whose name
+    /// hash collides with it). Records still have to be accepted by the filter.
+    QueryResponderIterator begin(QueryResponderRecordFilter * filter, uint32_t nameHash)
+    {
+        if (mNameIndexSize == 0)
+        {
+            return end();
+        }
+        return QueryResponderIterator::ForBucket(filter, mResponderInfos, mNameIndex[nameHash % mNameIndexSize]);
+    }
     QueryResponderIterator end() { return QueryResponderIterator(); }
 
     /// Clear any items marked as 'additional'.
     void ResetAdditionals();
 
+    /// Returns whether any item is marked as 'additional'.
+    bool HasAdditionals() const { return mAdditionalCount > 0; }
+
     /// Marks queries matching this qname as 'to be additionally reported'
     /// @return the number of items marked new as 'additional data'.
     size_t MarkAdditional(const FullQName & qname);
@@ -274,18 +341,28 @@ public:
     void ClearBroadcastThrottle();
 
 private:
+    friend class ResponseSender; // links the query responders it sends replies from
+
+    /// Adds the record at the given index to the name index.
+    void IndexRecord(size_t index);
+
     Internal::QueryResponderInfo * mResponderInfos;
     size_t mResponderInfoSize;
+    size_t * mNameIndex; // first record of each bucket, kNoRecord if the bucket is empty
+    size_t mNameIndexSize;
+    size_t mAdditionalCount                  = 0;
+    QueryResponderBase * mNextQueryResponder = nullptr;
 };
 
 template <size_t kSize>
 class QueryResponder : public QueryResponderBase
 {
 public:
-    QueryResponder() : QueryResponderBase(mData, kSize) { Init(); }
+    QueryResponder() : QueryResponderBase(mData, kSize, mNameIndex, kSize) { Init(); }
 
 private:
     Internal::QueryResponderInfo mData[kSize];
+    size_t mNameIndex[kSize];
 };
 
 } // namespace Minimal
@@ -62,6 +62,16 @@ private:
     std::vector<FullQName> mCaptures;
 };
 
+class NameReplyFilter : public ReplyFilter
+{
+public:
+    NameReplyFilter(const FullQName & qName) : mQName(qName) {}
+    bool Accept(QType qType, QClass qClass, FullQName qname) override { return qname == mQName; }
+
+private:
+    FullQName mQName;
+};
+
 void CanIterateOverResponders(nlTestSuite * inSuite, void * inContext)
 {
     QueryResponder<10> responder;
@@ -169,12 +179,56 @@ void NonDiscoverableService(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void IteratesOverRecordsWithName(nlTestSuite * inSuite, void * inContext)
+{
+    QueryResponder<10> responder;
+
+    EmptyResponder empty1(kName1);
+    EmptyResponder empty2(kName2);
+    EmptyResponder empty3(kName1);
+
+    NL_TEST_ASSERT(inSuite, responder.AddResponder(&empty1).IsValid());
+    NL_TEST_ASSERT(inSuite, responder.AddResponder(&empty2).IsValid());
+    NL_TEST_ASSERT(inSuite, responder.AddResponder(&empty3).IsValid());
+
+    // Records of other names may share the bucket, so the filter is what guarantees matching names.
+    NameReplyFilter replyFilter(kName1);
+    QueryResponderRecordFilter nameFilter;
+    nameFilter.SetReplyFilter(&replyFilter);
+
+    int count = 0;
+    for (auto it = responder.begin(&nameFilter, FullQName(kName1).Hash()); it != responder.end(); it++, count++)
+    {
+        NL_TEST_ASSERT(inSuite, it->responder == &empty1 || it->responder == &empty3);
+    }
+    NL_TEST_ASSERT(inSuite, count == 2);
+
+    // Only the matching records are marked as additional
+    NL_TEST_ASSERT(inSuite, !responder.HasAdditionals());
+    NL_TEST_ASSERT(inSuite, responder.MarkAdditional(FullQName(kName2)) == 1);
+    NL_TEST_ASSERT(inSuite, responder.HasAdditionals());
+
+    QueryResponderRecordFilter additionalFilter;
+    additionalFilter.SetIncludeAdditionalRepliesOnly(true);
+
+    count = 0;
+    for (auto it = responder.begin(&additionalFilter); it != responder.end(); it++, count++)
+    {
+        NL_TEST_ASSERT(inSuite, it->responder == &empty2);
+    }
+    NL_TEST_ASSERT(inSuite, count == 1);
+
+    responder.ResetAdditionals();
+    NL_TEST_ASSERT(inSuite, !responder.HasAdditionals());
+}
+
 const nlTest sTests[] = {
-    NL_TEST_DEF("CanIterateOverResponders", CanIterateOverResponders), //
-    NL_TEST_DEF("RespondsToDnsSdQueries", RespondsToDnsSdQueries),     //
-    NL_TEST_DEF("LimitedStorage", LimitedStorage),                     //
-    NL_TEST_DEF("NonDiscoverableService", NonDiscoverableService),     //
-    NL_TEST_SENTINEL()                                                 //
+    NL_TEST_DEF("CanIterateOverResponders", CanIterateOverResponders),       //
+    NL_TEST_DEF("RespondsToDnsSdQueries", RespondsToDnsSdQueries),           //
+    NL_TEST_DEF("LimitedStorage", LimitedStorage),                           //
+    NL_TEST_DEF("NonDiscoverableService", NonDiscoverableService),           //
+    NL_TEST_DEF("IteratesOverRecordsWithName", IteratesOverRecordsWithName), //
+    NL_TEST_SENTINEL()                                                       //
 };
 
 } // namespace
@@ -102,11 +102,11 @@ public:
         switch (data.GetType())
         {
         case QType::PTR:
-            ParsePtrRecord(data.GetData(), data.GetData(), &target);
+            ParsePtrRecord(data.GetData(), mPacketRange, &target);
             break;
         case QType::SRV: {
             SrvRecord srv;
-            bool srvParseOk = srv.Parse(data.GetData(), data.GetData());
+            bool srvParseOk = srv.Parse(data.GetData(), mPacketRange);
             NL_TEST_ASSERT(mInSuite, srvParseOk);
             if (!srvParseOk)
             {
@@ -168,11 +168,11 @@ public:
             switch (data.GetType())
             {
             case QType::PTR:
-                ParsePtrRecord(data.GetData(), data.GetData(), &dataTarget);
+                ParsePtrRecord(data.GetData(), mPacketRange, &dataTarget);
                 break;
             case QType::SRV: {
                 SrvRecord srv;
-                if (srv.Parse(data.GetData(), data.GetData()))
+                if (srv.Parse(data.GetData(), mPacketRange))
                 {
                     dataTarget = srv.GetName();
                 }
@@ -223,7 +223,9 @@ public:
     DirectSend(chip::System::PacketBufferHandle && data, const chip::Inet::IPAddress & addr, uint16_t port,
                chip::Inet::InterfaceId interface) override
     {
-        ParsePacket(BytesRange(data->Start(), data->Start() + data->TotalLength()), this);
+        // Names in the records may point anywhere in the packet.
+        mPacketRange = BytesRange(data->Start(), data->Start() + data->TotalLength());
+        ParsePacket(mPacketRange, this);
         if (mHeaderFound)
         {
             TestGotAllExpectedPackets();
@@ -311,6 +313,7 @@ private:
     bool mSendCalled              = false;
     int mTotalRecords             = 0;
     FullQName kIgnoreQname        = FullQName(kIgnoreQNameParts);
+    BytesRange mPacketRange; // packet being checked
 
     int GetNumExpectedRecords() const
     {
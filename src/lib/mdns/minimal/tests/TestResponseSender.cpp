@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include <lib/mdns/minimal/QueryBuilder.h>
 #include <lib/mdns/minimal/RecordData.h>
 #include <lib/mdns/minimal/core/FlatAllocatedQName.h>
 #include <lib/mdns/minimal/responders/Ptr.h>
@@ -28,6 +29,7 @@
 
 #include <lib/support/CHIPMem.h>
 #include <lib/support/UnitTestRegistration.h>
+#include <system/SystemLayer.h>
 
 #include <nlunit-test.h>
 
@@ -82,6 +84,68 @@ struct CommonTestElements
     }
 };
 
+constexpr uint16_t kMdnsPort = 5353;
+
+/// Runs timers only when the test fires them.
+class FakeSystemLayer : public System::Layer
+{
+public:
+    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
+    CHIP_ERROR Shutdown() override { return CHIP_NO_ERROR; }
+    bool IsInitialized() const override { return true; }
+
+    CHIP_ERROR StartTimer(uint32_t delayMs, System::TimerCompleteCallback callback, void * appState) override
+    {
+        mDelayMs  = delayMs;
+        mCallback = callback;
+        mAppState = appState;
+        return CHIP_NO_ERROR;
+    }
+
+    void CancelTimer(System::TimerCompleteCallback callback, void * appState) override
+    {
+        if ((mCallback == callback) && (mAppState == appState))
+        {
+            mCallback = nullptr;
+        }
+    }
+
+    CHIP_ERROR ScheduleWork(System::TimerCompleteCallback callback, void * appState) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    bool HasTimer() const { return mCallback != nullptr; }
+    uint32_t GetDelayMs() const { return mDelayMs; }
+
+    void FireTimer()
+    {
+        System::TimerCompleteCallback callback = mCallback;
+        mCallback                              = nullptr;
+        callback(this, mAppState);
+    }
+
+private:
+    System::TimerCompleteCallback mCallback = nullptr;
+    void * mAppState                        = nullptr;
+    uint32_t mDelayMs                       = 0;
+};
+
+/// Checks multicast replies like CheckOnlyServer checks unicast ones.
+class MulticastCheckServer : public CheckOnlyServer
+{
+public:
+    MulticastCheckServer(nlTestSuite * inSuite) : CheckOnlyServer(inSuite) {}
+
+    CHIP_ERROR BroadcastSend(System::PacketBufferHandle && data, uint16_t port, Inet::InterfaceId interface) override
+    {
+        mBroadcastCount++;
+        return DirectSend(std::move(data), Inet::IPAddress::Any, port, interface);
+    }
+
+    size_t GetBroadcastCount() const { return mBroadcastCount; }
+
+private:
+    size_t mBroadcastCount = 0;
+};
+
 void SrvAnyResponseToInstance(nlTestSuite * inSuite, void * inContext)
 {
     CommonTestElements common(inSuite, "test");
@@ -241,33 +305,29 @@ void NoQueryResponder(nlTestSuite * inSuite, void * inContext)
 
 void AddManyQueryResponders(nlTestSuite * inSuite, void * inContext)
 {
-    // TODO(cecille): Fix this test once #8000 gets resolved.
     ResponseSender responseSender(nullptr);
-    QueryResponder<1> q1;
-    QueryResponder<1> q2;
-    QueryResponder<1> q3;
-    QueryResponder<1> q4;
-    QueryResponder<1> q5;
-    QueryResponder<1> q6;
-    QueryResponder<1> q7;
-    QueryResponder<1> q8;
+    QueryResponder<1> responders[16];
+
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
 
     // We should be able to re-add the same query responder as many times as we want.
-    for (size_t i = 0; i < ResponseSender::kMaxQueryResponders + 1; ++i)
+    for (size_t i = 0; i < 3; ++i)
     {
-        NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&q1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&responders[0]) == CHIP_NO_ERROR);
     }
 
-    // There are 7 total
-    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&q2) == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&q3) == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&q4) == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&q5) == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&q6) == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&q7) == CHIP_NO_ERROR);
+    // The number of query responders is not limited.
+    for (auto & responder : responders)
+    {
+        NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&responder) == CHIP_NO_ERROR);
+    }
 
-    // Last one should return a no memory error (no space)
-    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&q8) == CHIP_ERROR_NO_MEMORY);
+    // Each responder was added only once, so it can only be removed once.
+    for (auto & responder : responders)
+    {
+        NL_TEST_ASSERT(inSuite, responseSender.RemoveQueryResponder(&responder) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, responseSender.RemoveQueryResponder(&responder) == CHIP_ERROR_KEY_NOT_FOUND);
+    }
 }
 
 void PtrSrvTxtMultipleRespondersToInstance(nlTestSuite * inSuite, void * inContext)
@@ -336,6 +396,225 @@ void PtrSrvTxtMultipleRespondersToServiceListing(nlTestSuite * inSuite, void * i
     NL_TEST_ASSERT(inSuite, common1.server.GetHeaderFound());
 }
 
+// Builds a query for the service name of the given test elements, listing their PTR record with the given TTL as known answer.
+System::PacketBufferHandle BuildQueryWithKnownAnswer(CommonTestElements & common, uint32_t knownAnswerTtl)
+{
+    QueryBuilder builder(System::PacketBufferHandle::New(256));
+
+    PtrResourceRecord knownAnswer(common.service, common.instance);
+    knownAnswer.SetTtl(knownAnswerTtl);
+
+    builder.AddQuery(Query(common.service).SetType(QType::ANY).SetClass(QClass::IN).SetAnswerViaUnicast(false));
+    builder.AddAnswer(knownAnswer);
+
+    return builder.Ok() ? builder.ReleasePacket() : System::PacketBufferHandle();
+}
+
+void PtrKnownAnswerIsNotSent(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    ResponseSender responseSender(&common.server);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.ptrResponder).SetReportAdditional(common.instance);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    System::PacketBufferHandle query = BuildQueryWithKnownAnswer(common, ResourceRecord::kDefaultTtl);
+    NL_TEST_ASSERT(inSuite, !query.IsNull());
+    if (query.IsNull())
+    {
+        return;
+    }
+
+    BytesRange queryRange(query->Start(), query->Start() + query->DataLength());
+    KnownAnswers knownAnswers(queryRange);
+    NL_TEST_ASSERT(inSuite, ParsePacket(queryRange, &knownAnswers));
+    NL_TEST_ASSERT(inSuite, knownAnswers.Count() == 1);
+
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, query->Start() + ConstHeaderRef::kSizeBytes, queryRange);
+
+    // The querier knows the only answer, so neither it nor its additional records are sent.
+    responseSender.Respond(1, queryData, &common.packetInfo, &knownAnswers);
+    NL_TEST_ASSERT(inSuite, !common.server.GetSendCalled());
+}
+
+void ExpiringPtrKnownAnswerIsSent(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    ResponseSender responseSender(&common.server);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.ptrResponder).SetReportAdditional(common.instance);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    // Less than half of the TTL of the record remains in the querier cache.
+    System::PacketBufferHandle query = BuildQueryWithKnownAnswer(common, ResourceRecord::kDefaultTtl / 2 - 1);
+    NL_TEST_ASSERT(inSuite, !query.IsNull());
+    if (query.IsNull())
+    {
+        return;
+    }
+
+    BytesRange queryRange(query->Start(), query->Start() + query->DataLength());
+    KnownAnswers knownAnswers(queryRange);
+    NL_TEST_ASSERT(inSuite, ParsePacket(queryRange, &knownAnswers));
+
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, query->Start() + ConstHeaderRef::kSizeBytes, queryRange);
+
+    common.server.AddExpectedRecord(&common.ptrRecord);
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+
+    responseSender.Respond(1, queryData, &common.packetInfo, &knownAnswers);
+
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+}
+
+void MulticastReplyIsDelayed(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    MulticastCheckServer server(inSuite);
+    FakeSystemLayer systemLayer;
+    ResponseSender responseSender(&server);
+    responseSender.SetSystemLayer(&systemLayer);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.ptrResponder).SetReportAdditional(common.instance);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    common.service.Output(common.requestBufferWriter);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = kMdnsPort;
+
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(0, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, systemLayer.HasTimer());
+    NL_TEST_ASSERT(inSuite, systemLayer.GetDelayMs() >= ResponseSender::kMinMulticastDelayMs);
+    NL_TEST_ASSERT(inSuite, systemLayer.GetDelayMs() <= ResponseSender::kMaxMulticastDelayMs);
+
+    // The answer and its additional records are sent once the delay expires.
+    server.AddExpectedRecord(&common.ptrRecord);
+    server.AddExpectedRecord(&common.srvRecord);
+    server.AddExpectedRecord(&common.txtRecord);
+    systemLayer.FireTimer();
+
+    NL_TEST_ASSERT(inSuite, server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, server.GetHeaderFound());
+    NL_TEST_ASSERT(inSuite, server.GetBroadcastCount() == 1);
+
+    // Records multicast less than a second ago are not sent again.
+    server.Reset();
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(0, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !systemLayer.HasTimer());
+    NL_TEST_ASSERT(inSuite, !server.GetSendCalled());
+}
+
+void MulticastRepliesAreAggregated(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common1(inSuite, "test1");
+    CommonTestElements common2(inSuite, "test2");
+    MulticastCheckServer server(inSuite);
+    FakeSystemLayer systemLayer;
+    ResponseSender responseSender(&server);
+    responseSender.SetSystemLayer(&systemLayer);
+
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common1.queryResponder) == CHIP_NO_ERROR);
+    common1.queryResponder.AddResponder(&common1.ptrResponder).SetReportAdditional(common1.instance);
+    common1.queryResponder.AddResponder(&common1.srvResponder);
+
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common2.queryResponder) == CHIP_NO_ERROR);
+    common2.queryResponder.AddResponder(&common2.ptrResponder).SetReportAdditional(common2.instance);
+    common2.queryResponder.AddResponder(&common2.srvResponder);
+
+    common1.service.Output(common1.requestBufferWriter);
+    common2.service.Output(common2.requestBufferWriter);
+    QueryData queryData1 = QueryData(QType::ANY, QClass::IN, false, common1.requestNameStart, common1.requestBytesRange);
+    QueryData queryData2 = QueryData(QType::ANY, QClass::IN, false, common2.requestNameStart, common2.requestBytesRange);
+
+    common1.packetInfo.Clear();
+    common1.packetInfo.SrcPort = kMdnsPort;
+
+    // Queries received during the delay are answered by the same reply.
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(0, queryData1, &common1.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(0, queryData2, &common1.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(0, queryData1, &common1.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !server.GetSendCalled());
+
+    server.AddExpectedRecord(&common1.ptrRecord);
+    server.AddExpectedRecord(&common1.srvRecord);
+    server.AddExpectedRecord(&common2.ptrRecord);
+    server.AddExpectedRecord(&common2.srvRecord);
+    systemLayer.FireTimer();
+
+    NL_TEST_ASSERT(inSuite, server.GetHeaderFound());
+    NL_TEST_ASSERT(inSuite, server.GetBroadcastCount() == 1);
+}
+
+void PendingMulticastIsDroppedOnRestart(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    MulticastCheckServer server(inSuite);
+    FakeSystemLayer oldSystemLayer;
+    FakeSystemLayer newSystemLayer;
+    ResponseSender responseSender(&server);
+    responseSender.SetSystemLayer(&oldSystemLayer);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.ptrResponder).SetReportAdditional(common.instance);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    common.service.Output(common.requestBufferWriter);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = kMdnsPort;
+
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(0, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, oldSystemLayer.HasTimer());
+
+    // The old system layer may be shut down without firing its timers: the delayed reply is
+    // dropped and queries received afterwards are answered again.
+    responseSender.SetSystemLayer(&newSystemLayer);
+    NL_TEST_ASSERT(inSuite, !oldSystemLayer.HasTimer());
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(0, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, newSystemLayer.HasTimer());
+    NL_TEST_ASSERT(inSuite, !server.GetSendCalled());
+
+    server.AddExpectedRecord(&common.ptrRecord);
+    server.AddExpectedRecord(&common.srvRecord);
+    newSystemLayer.FireTimer();
+
+    NL_TEST_ASSERT(inSuite, server.GetHeaderFound());
+    NL_TEST_ASSERT(inSuite, server.GetBroadcastCount() == 1);
+}
+
+void UniqueRecordsAreNotDelayed(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    MulticastCheckServer server(inSuite);
+    FakeSystemLayer systemLayer;
+    ResponseSender responseSender(&server);
+    responseSender.SetSystemLayer(&systemLayer);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    common.instance.Output(common.requestBufferWriter);
+    QueryData queryData = QueryData(QType::SRV, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = kMdnsPort;
+
+    // Only this responder has the SRV record, so there is nothing to aggregate.
+    server.AddExpectedRecord(&common.srvRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(0, queryData, &common.packetInfo) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, !systemLayer.HasTimer());
+    NL_TEST_ASSERT(inSuite, server.GetHeaderFound());
+    NL_TEST_ASSERT(inSuite, server.GetBroadcastCount() == 1);
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("SrvAnyResponseToInstance", SrvAnyResponseToInstance),                                       //
     NL_TEST_DEF("SrvTxtAnyResponseToInstance", SrvTxtAnyResponseToInstance),                                 //
@@ -347,6 +626,12 @@ const nlTest sTests[] = {
     NL_TEST_DEF("AddManyQueryResponders", AddManyQueryResponders),                                           //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToInstance", PtrSrvTxtMultipleRespondersToInstance),             //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToServiceListing", PtrSrvTxtMultipleRespondersToServiceListing), //
+    NL_TEST_DEF("PtrKnownAnswerIsNotSent", PtrKnownAnswerIsNotSent),                                         //
+    NL_TEST_DEF("ExpiringPtrKnownAnswerIsSent", ExpiringPtrKnownAnswerIsSent),                               //
+    NL_TEST_DEF("MulticastReplyIsDelayed", MulticastReplyIsDelayed),                                         //
+    NL_TEST_DEF("MulticastRepliesAreAggregated", MulticastRepliesAreAggregated),                             //
+    NL_TEST_DEF("PendingMulticastIsDroppedOnRestart", PendingMulticastIsDroppedOnRestart),                   //
+    NL_TEST_DEF("UniqueRecordsAreNotDelayed", UniqueRecordsAreNotDelayed),                                   //
 
     NL_TEST_SENTINEL() //
 };
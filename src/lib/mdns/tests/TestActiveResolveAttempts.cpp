@@ -0,0 +1,212 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/mdns/ActiveResolveAttempts.h>
+
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Mdns;
+
+PeerId MakePeerId(NodeId nodeId)
+{
+    return PeerId().SetCompressedFabricId(0x1234).SetNodeId(nodeId);
+}
+
+void TestSinglePeerBackoff(nlTestSuite * inSuite, void * inContext)
+{
+    ActiveResolveAttempts attempts;
+    uint32_t delayMs = 0;
+    PeerId peerId;
+
+    NL_TEST_ASSERT(inSuite, !attempts.GetTimeUntilNextRetry(0, delayMs));
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(1), 1000));
+    NL_TEST_ASSERT(inSuite, attempts.IsPending(MakePeerId(1)));
+
+    // Retries are sent 1, 2, 4 and 8 seconds after the previous query.
+    const uint32_t kExpectedDelaysMs[]   = { 1000, 2000, 4000, 8000 };
+    ActiveResolveAttempts::Timestamp now = 1000;
+    for (uint32_t expectedDelayMs : kExpectedDelaysMs)
+    {
+        NL_TEST_ASSERT(inSuite, attempts.GetTimeUntilNextRetry(now, delayMs));
+        NL_TEST_ASSERT(inSuite, delayMs == expectedDelayMs);
+        NL_TEST_ASSERT(inSuite, !attempts.NextScheduledPeer(now + expectedDelayMs - 1, peerId));
+
+        now += expectedDelayMs;
+        NL_TEST_ASSERT(inSuite, attempts.NextScheduledPeer(now, peerId));
+        NL_TEST_ASSERT(inSuite, peerId == MakePeerId(1));
+        NL_TEST_ASSERT(inSuite, !attempts.NextScheduledPeer(now, peerId));
+    }
+
+    // The backoff would exceed the maximum retry delay: the query is not retried anymore.
+    NL_TEST_ASSERT(inSuite, !attempts.IsPending(MakePeerId(1)));
+    NL_TEST_ASSERT(inSuite, !attempts.GetTimeUntilNextRetry(now, delayMs));
+}
+
+void TestCompleteStopsRetries(nlTestSuite * inSuite, void * inContext)
+{
+    ActiveResolveAttempts attempts;
+    uint32_t delayMs = 0;
+    PeerId peerId;
+
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(1), 0));
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(2), 500));
+
+    attempts.Complete(MakePeerId(1));
+    NL_TEST_ASSERT(inSuite, !attempts.IsPending(MakePeerId(1)));
+    NL_TEST_ASSERT(inSuite, attempts.IsPending(MakePeerId(2)));
+
+    NL_TEST_ASSERT(inSuite, attempts.GetTimeUntilNextRetry(0, delayMs));
+    NL_TEST_ASSERT(inSuite, delayMs == 1500);
+    NL_TEST_ASSERT(inSuite, attempts.NextScheduledPeer(5000, peerId));
+    NL_TEST_ASSERT(inSuite, peerId == MakePeerId(2));
+    NL_TEST_ASSERT(inSuite, !attempts.NextScheduledPeer(5000, peerId));
+
+    attempts.Reset();
+    NL_TEST_ASSERT(inSuite, !attempts.IsPending(MakePeerId(2)));
+    NL_TEST_ASSERT(inSuite, !attempts.GetTimeUntilNextRetry(5000, delayMs));
+}
+
+void TestDuplicateResolveIsNotSent(nlTestSuite * inSuite, void * inContext)
+{
+    ActiveResolveAttempts attempts;
+    uint32_t delayMs = 0;
+
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(1), 0));
+    NL_TEST_ASSERT(inSuite, !attempts.MarkPending(MakePeerId(1), 800));
+
+    // The schedule of the first query is kept.
+    NL_TEST_ASSERT(inSuite, attempts.GetTimeUntilNextRetry(800, delayMs));
+    NL_TEST_ASSERT(inSuite, delayMs == 200);
+}
+
+void TestDueRetriesAreSentTogether(nlTestSuite * inSuite, void * inContext)
+{
+    ActiveResolveAttempts attempts;
+    PeerId peerId;
+
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(1), 200));
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(2), 100));
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(3), 300));
+
+    // Earliest due retries come first.
+    NL_TEST_ASSERT(inSuite, attempts.NextScheduledPeer(1300, peerId));
+    NL_TEST_ASSERT(inSuite, peerId == MakePeerId(2));
+    NL_TEST_ASSERT(inSuite, attempts.NextScheduledPeer(1300, peerId));
+    NL_TEST_ASSERT(inSuite, peerId == MakePeerId(1));
+    NL_TEST_ASSERT(inSuite, attempts.NextScheduledPeer(1300, peerId));
+    NL_TEST_ASSERT(inSuite, peerId == MakePeerId(3));
+    NL_TEST_ASSERT(inSuite, !attempts.NextScheduledPeer(1300, peerId));
+}
+
+void TestFullQueueDropsMostRetried(nlTestSuite * inSuite, void * inContext)
+{
+    ActiveResolveAttempts attempts;
+    PeerId peerId;
+
+    for (NodeId i = 0; i < ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(i), 0));
+    }
+
+    // Peer 0 is retried once and now waits for 2 seconds, longer than any other peer.
+    NL_TEST_ASSERT(inSuite, attempts.NextScheduledPeer(1000, peerId));
+    NL_TEST_ASSERT(inSuite, peerId == MakePeerId(0));
+
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(ActiveResolveAttempts::kRetryQueueSize), 1000));
+    NL_TEST_ASSERT(inSuite, !attempts.IsPending(MakePeerId(0)));
+    for (NodeId i = 1; i <= ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, attempts.IsPending(MakePeerId(i)));
+    }
+}
+
+void TestRefreshesHaveLowerPriority(nlTestSuite * inSuite, void * inContext)
+{
+    ActiveResolveAttempts attempts;
+
+    NL_TEST_ASSERT(inSuite, attempts.MarkRefreshPending(MakePeerId(0), 0));
+    NL_TEST_ASSERT(inSuite, !attempts.MarkRefreshPending(MakePeerId(0), 0));
+    for (NodeId i = 1; i < ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(i), 0));
+    }
+
+    // A refresh does not evict anything when the queue is full.
+    const NodeId kRefreshed = ActiveResolveAttempts::kRetryQueueSize;
+    NL_TEST_ASSERT(inSuite, !attempts.MarkRefreshPending(MakePeerId(kRefreshed), 0));
+    NL_TEST_ASSERT(inSuite, !attempts.IsPending(MakePeerId(kRefreshed)));
+
+    // A resolution requested by a caller evicts the refresh rather than another resolution.
+    const NodeId kResolved = ActiveResolveAttempts::kRetryQueueSize + 1;
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(kResolved), 0));
+    NL_TEST_ASSERT(inSuite, !attempts.IsPending(MakePeerId(0)));
+    for (NodeId i = 1; i < ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, attempts.IsPending(MakePeerId(i)));
+    }
+    NL_TEST_ASSERT(inSuite, attempts.IsPending(MakePeerId(kResolved)));
+}
+
+void TestResolveOfRefreshedPeerIsKept(nlTestSuite * inSuite, void * inContext)
+{
+    ActiveResolveAttempts attempts;
+    PeerId peerId;
+
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(1), 0));
+    NL_TEST_ASSERT(inSuite, attempts.MarkRefreshPending(MakePeerId(0), 100));
+    for (NodeId i = 2; i < ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(i), 100));
+    }
+
+    // Peer 1 is retried once and now waits for 2 seconds, longer than any other peer.
+    NL_TEST_ASSERT(inSuite, attempts.NextScheduledPeer(1000, peerId));
+    NL_TEST_ASSERT(inSuite, peerId == MakePeerId(1));
+
+    // A caller now waits for the refreshed peer, so it is no longer evicted first.
+    NL_TEST_ASSERT(inSuite, !attempts.MarkPending(MakePeerId(0), 1000));
+    NL_TEST_ASSERT(inSuite, attempts.MarkPending(MakePeerId(ActiveResolveAttempts::kRetryQueueSize), 1000));
+    NL_TEST_ASSERT(inSuite, attempts.IsPending(MakePeerId(0)));
+    NL_TEST_ASSERT(inSuite, !attempts.IsPending(MakePeerId(1)));
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("SinglePeerBackoff", TestSinglePeerBackoff),                       //
+    NL_TEST_DEF("CompleteStopsRetries", TestCompleteStopsRetries),                 //
+    NL_TEST_DEF("DuplicateResolveIsNotSent", TestDuplicateResolveIsNotSent),       //
+    NL_TEST_DEF("DueRetriesAreSentTogether", TestDueRetriesAreSentTogether),       //
+    NL_TEST_DEF("FullQueueDropsMostRetried", TestFullQueueDropsMostRetried),       //
+    NL_TEST_DEF("RefreshesHaveLowerPriority", TestRefreshesHaveLowerPriority),     //
+    NL_TEST_DEF("ResolveOfRefreshedPeerIsKept", TestResolveOfRefreshedPeerIsKept), //
+    NL_TEST_SENTINEL()                                                             //
+};
+
+} // namespace
+
+int TestActiveResolveAttempts(void)
+{
+    nlTestSuite theSuite = { "ActiveResolveAttempts", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestActiveResolveAttempts)
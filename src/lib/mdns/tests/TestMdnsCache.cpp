@@ -47,7 +47,7 @@ void TestCreate(nlTestSuite * inSuite, void * inContext)
 void TestInsert(nlTestSuite * inSuite, void * inContext)
 {
     const int sizeOfCache = 5;
-    MdnsCache<sizeOfCache> tMdnsCache;
+    MdnsCache<sizeOfCache, Time::Source::kTest> tMdnsCache;
     PeerId peerId;
     int64_t id                        = 0x100;
     uint16_t port                     = 2000;
@@ -72,18 +72,33 @@ void TestInsert(nlTestSuite * inSuite, void * inContext)
         // ml -- why doesn't adding 2 uint16_t give a uint16_t?
         peerId.SetNodeId((NodeId) id + i);
         result = tMdnsCache.Insert(peerId, addr, (uint16_t)(port + i), iface, 1000 * ttl);
-        if (i < sizeOfCache)
+        // once the cache is full, the least recently used entries are evicted
+        NL_TEST_ASSERT(inSuite, result == CHIP_NO_ERROR);
+    }
+
+    for (uint16_t i = 0; i < 10; i++)
+    {
+        peerId.SetNodeId((NodeId) id + i);
+        CHIP_ERROR result = tMdnsCache.Lookup(peerId, addr_out, port_out, iface_out);
+        if (i < 10 - sizeOfCache)
         {
-            NL_TEST_ASSERT(inSuite, result == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, result != CHIP_NO_ERROR);
         }
         else
         {
-            NL_TEST_ASSERT(inSuite, result != CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, result == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, port_out == port + i);
         }
     }
 
     tMdnsCache.DumpCache();
-    sleep(ttl + 1);
+    tMdnsCache.GetTimeSource().SetCurrentMonotonicTimeMs(1000 * (ttl + 1));
+    for (uint16_t i = 0; i < 10; i++)
+    {
+        peerId.SetNodeId((NodeId) id + i);
+        NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peerId, addr_out, port_out, iface_out) != CHIP_NO_ERROR);
+    }
+
     id   = 0x200;
     port = 3000;
     for (uint16_t i = 0; i < sizeOfCache; i++)
@@ -126,7 +141,149 @@ void TestInsert(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peerId, addr_out, port_out, iface_out) != CHIP_NO_ERROR);
 }
 
-static const nlTest sTests[] = { NL_TEST_DEF_FN(TestCreate), NL_TEST_DEF_FN(TestInsert), NL_TEST_SENTINEL() };
+void TestEvictLeastRecentlyUsed(nlTestSuite * inSuite, void * inContext)
+{
+    MdnsCache<3, Time::Source::kTest> tMdnsCache;
+    constexpr Inet::InterfaceId iface = INET_NULL_INTERFACEID;
+    const PeerId peer1                = PeerId().SetCompressedFabricId(1).SetNodeId(1);
+    const PeerId peer2                = PeerId().SetCompressedFabricId(1).SetNodeId(2);
+    const PeerId peer3                = PeerId().SetCompressedFabricId(1).SetNodeId(3);
+    const PeerId peer4                = PeerId().SetCompressedFabricId(1).SetNodeId(4);
+
+    Inet::IPAddress addr;
+    Inet::IPAddress addr_out;
+    uint16_t port_out;
+    Inet::InterfaceId iface_out;
+
+    Inet::IPAddress::FromString("fd00::1", addr);
+
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer1, addr, 5540, iface, 120 * 1000) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer2, addr, 5541, iface, 120 * 1000) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer3, addr, 5542, iface, 120 * 1000) == CHIP_NO_ERROR);
+
+    // peer1 becomes the most recently used, so peer2 is evicted first
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer1, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer4, addr, 5543, iface, 120 * 1000) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer1, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, port_out == 5540);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer2, addr_out, port_out, iface_out) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer3, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer4, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, port_out == 5543);
+
+    // entries freed by a delete are reused without evicting any other entry
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Delete(peer3) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Delete(peer3) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer2, addr, 5541, iface, 120 * 1000) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer1, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer2, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer4, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+}
+
+void TestMultipleAddresses(nlTestSuite * inSuite, void * inContext)
+{
+    MdnsCache<2, Time::Source::kTest> tMdnsCache;
+    constexpr Inet::InterfaceId iface = INET_NULL_INTERFACEID;
+    const PeerId peer                 = PeerId().SetCompressedFabricId(1).SetNodeId(1);
+
+    Inet::IPAddress addrV4;
+    Inet::IPAddress addrV6;
+    Inet::IPAddress addr_out;
+    uint16_t port_out;
+    Inet::InterfaceId iface_out;
+
+    Inet::IPAddress::FromString("10.0.0.1", addrV4);
+    Inet::IPAddress::FromString("fd00::1", addrV6);
+
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer, addrV4, 5540, iface, 120 * 1000) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer, addrV6, 5540, iface, 10 * 1000) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer, addrV6, 5540, iface, 10 * 1000) == CHIP_NO_ERROR);
+
+    size_t addressCount = 0;
+    NL_TEST_ASSERT(inSuite,
+                   tMdnsCache.ForEachAddress(peer, [&](const Inet::IPAddress &, uint16_t, Inet::InterfaceId) {
+                       addressCount++;
+                   }) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, addressCount == 2);
+
+    // IPv6 addresses are preferred
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, addr_out == addrV6);
+
+    // each address expires on its own, while the node remains cached
+    tMdnsCache.GetTimeSource().SetCurrentMonotonicTimeMs(20 * 1000);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, addr_out == addrV4);
+}
+
+void TestRefresh(nlTestSuite * inSuite, void * inContext)
+{
+    MdnsCache<2, Time::Source::kTest> tMdnsCache;
+    constexpr Inet::InterfaceId iface = INET_NULL_INTERFACEID;
+    const PeerId peer                 = PeerId().SetCompressedFabricId(1).SetNodeId(1);
+
+    Inet::IPAddress addr;
+    Inet::IPAddress addr_out;
+    uint16_t port_out;
+    Inet::InterfaceId iface_out;
+    PeerId peer_out;
+    uint64_t delayMs;
+
+    Inet::IPAddress::FromString("fd00::1", addr);
+
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.NextPeerToRefresh(peer_out));
+
+    tMdnsCache.GetTimeSource().SetCurrentMonotonicTimeMs(1000);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer, addr, 5540, iface, 100 * 1000) == CHIP_NO_ERROR);
+
+    // entries nobody looked up are not refreshed
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+
+    // refreshes are due at 80% of the TTL
+    NL_TEST_ASSERT(inSuite, tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+    NL_TEST_ASSERT(inSuite, delayMs == 80 * 1000);
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.NextPeerToRefresh(peer_out));
+
+    tMdnsCache.GetTimeSource().SetCurrentMonotonicTimeMs(81 * 1000);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+    NL_TEST_ASSERT(inSuite, delayMs == 0);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.NextPeerToRefresh(peer_out));
+    NL_TEST_ASSERT(inSuite, peer_out == peer);
+
+    // a peer is refreshed once until it is inserted again
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.NextPeerToRefresh(peer_out));
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+
+    // nor refreshed again once the refresh inserted it, unless it is looked up again
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer, addr, 5540, iface, 100 * 1000) == CHIP_NO_ERROR);
+    tMdnsCache.GetTimeSource().SetCurrentMonotonicTimeMs(170 * 1000);
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.NextPeerToRefresh(peer_out));
+
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+    NL_TEST_ASSERT(inSuite, delayMs == 0);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.NextPeerToRefresh(peer_out));
+    NL_TEST_ASSERT(inSuite, peer_out == peer);
+
+    // expired entries are not refreshed
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Insert(peer, addr, 5540, iface, 100 * 1000) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.Lookup(peer, addr_out, port_out, iface_out) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+    tMdnsCache.GetTimeSource().SetCurrentMonotonicTimeMs(300 * 1000);
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.GetTimeUntilNextRefresh(delayMs));
+    NL_TEST_ASSERT(inSuite, !tMdnsCache.NextPeerToRefresh(peer_out));
+}
+
+static const nlTest sTests[] = { NL_TEST_DEF_FN(TestCreate),
+                                 NL_TEST_DEF_FN(TestInsert),
+                                 NL_TEST_DEF_FN(TestEvictLeastRecentlyUsed),
+                                 NL_TEST_DEF_FN(TestMultipleAddresses),
+                                 NL_TEST_DEF_FN(TestRefresh),
+                                 NL_TEST_SENTINEL() };
 
 int TestMdnsCache(void)
 {
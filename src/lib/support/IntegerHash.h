@@ -0,0 +1,50 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a cheap hash of integer keys, such as endpoint, cluster or session ids, for hash tables and
+ *      summaries kept in memory.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ *  Hashes a 32-bit key, and optionally a second 32-bit value, so that every bit of the result depends on every bit of both.
+ *  Both the low bits (for a modulo or mask) and the high bits (for a shift) of the result can be used to pick a slot.
+ *
+ *  Not meant for keys chosen by an attacker to collide.
+ *
+ *  @param[in] key    The key.
+ *  @param[in] extra  A value hashed along with the key, 0 if there is none.
+ *
+ *  @return  The 32-bit hash.
+ *
+ */
+inline uint32_t IntegerHash(uint32_t key, uint32_t extra = 0)
+{
+    // Fibonacci hashing of the key, then a multiply and fold with the constants of the MurmurHash3 finalizer.
+    uint32_t hash = ((key * 0x9E3779B1u) ^ extra) * 0x85EBCA6Bu;
+    return hash ^ (hash >> 16);
+}
+
+} // namespace chip
@@ -23,10 +23,24 @@
 
 namespace chip {
 
+size_t StaticAllocatorBitmap::CountTrailingZeros(tBitChunkType value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctzl(value));
+#else
+    size_t count = 0;
+    for (; (value & kBit1) == 0; value >>= 1)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
 StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChunkType> * usage, size_t capacity,
                                              size_t elementSize) :
     StaticAllocatorBase(capacity),
-    mElements(storage), mElementSize(elementSize), mUsage(usage)
+    mElements(storage), mElementSize(elementSize), mUsage(usage), mNextFreeWord(0)
 {
     for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
     {
@@ -36,24 +50,32 @@ StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChu
 
 void * StaticAllocatorBitmap::Allocate()
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    const size_t wordCount = WordCount();
+    const size_t startWord = mNextFreeWord.load(std::memory_order_relaxed);
+
+    // Start from the word that most recently had a free slot, so that a mostly full pool does not rescan its full words.
+    for (size_t i = 0; i < wordCount; ++i)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        size_t word = startWord + i;
+        if (word >= wordCount)
+        {
+            word -= wordCount;
+        }
+
+        auto & usage       = mUsage[word];
+        auto value         = usage.load(std::memory_order_relaxed);
+        const auto usable  = UsableBits(word);
+        tBitChunkType free = ~value & usable;
+        while (free != 0)
         {
-            if ((value & (kBit1 << offset)) == 0)
+            const size_t offset = CountTrailingZeros(free);
+            if (usage.compare_exchange_weak(value, value | (kBit1 << offset)))
             {
-                if (usage.compare_exchange_strong(value, value | (kBit1 << offset)))
-                {
-                    mAllocated++;
-                    return At(word * kBitChunkSize + offset);
-                }
-                else
-                {
-                    value = usage.load(std::memory_order_relaxed); // if there is a race, update new usage
-                }
+                mAllocated++;
+                mNextFreeWord.store(word, std::memory_order_relaxed);
+                return At(word * kBitChunkSize + offset);
             }
+            free = ~value & usable; // if there is a race, value now holds the new usage
         }
     }
     return nullptr;
@@ -71,6 +93,7 @@ void StaticAllocatorBitmap::Deallocate(void * element)
     auto value = mUsage[word].fetch_and(~(kBit1 << offset));
     nlASSERT((value & (kBit1 << offset)) != 0); // assert fail when free an unused slot
     mAllocated--;
+    mNextFreeWord.store(word, std::memory_order_relaxed);
 }
 
 size_t StaticAllocatorBitmap::IndexOf(void * element)
@@ -87,15 +110,13 @@ bool StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lamb
 {
     for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        auto value = mUsage[word].load(std::memory_order_relaxed);
+        while (value != 0)
         {
-            if ((value & (kBit1 << offset)) != 0)
-            {
-                if (!lambda(context, At(word * kBitChunkSize + offset)))
-                    return false;
-            }
+            const size_t offset = CountTrailingZeros(value);
+            value &= value - 1; // clear the lowest set bit
+            if (!lambda(context, At(word * kBitChunkSize + offset)))
+                return false;
         }
     }
     return true;
@@ -18,7 +18,7 @@
 
 /**
  * @file
- *   Defines a memory pool class BitMapObjectPool.
+ *   Defines memory pool classes BitMapObjectPool and HeapObjectPool.
  */
 
 #pragma once
@@ -29,6 +29,10 @@
 #include <limits>
 #include <new>
 #include <stddef.h>
+#include <type_traits>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
 
 namespace chip {
 
@@ -63,6 +67,14 @@ public:
     void * Allocate();
     void Deallocate(void * element);
 
+    /// Returns whether \c element points into this allocator's storage.
+    bool Contains(const void * element) const
+    {
+        const uint8_t * begin = static_cast<const uint8_t *>(mElements);
+        const uint8_t * ptr   = static_cast<const uint8_t *>(element);
+        return ptr >= begin && ptr < begin + mElementSize * Capacity();
+    }
+
 protected:
     void * At(size_t index) { return static_cast<uint8_t *>(mElements) + mElementSize * index; }
     size_t IndexOf(void * element);
@@ -71,9 +83,24 @@ protected:
     bool ForEachActiveObjectInner(void * context, Lambda lambda);
 
 private:
+    /// Index of the lowest set bit of a non-zero usage word.
+    static size_t CountTrailingZeros(tBitChunkType value);
+
+    size_t WordCount() const { return (Capacity() + kBitChunkSize - 1) / kBitChunkSize; }
+
+    /// Mask of the bits of usage word \c word that map to elements of the pool.
+    tBitChunkType UsableBits(size_t word) const
+    {
+        const size_t remaining = Capacity() - word * kBitChunkSize;
+        return remaining >= kBitChunkSize ? ~tBitChunkType(0) : (kBit1 << remaining) - 1;
+    }
+
     void * mElements;
     const size_t mElementSize;
     std::atomic<tBitChunkType> * mUsage;
+    // Hint for Allocate(): the usage word that most recently had a free slot. It is only a starting point for the scan, so
+    // relaxed accesses are enough to keep the allocator lock free.
+    std::atomic<size_t> mNextFreeWord;
 };
 
 /**
@@ -160,4 +187,187 @@ private:
     } mData;
 };
 
+/**
+ *  @brief
+ *   A class template used for allocating Objects from the heap.
+ *
+ *   HeapObjectPool provides the CreateObject/ReleaseObject/ForEachActiveObject interface of BitMapObjectPool without a
+ *   compile-time limit on the number of objects. Objects are placed in chunks of kChunkCapacity objects that are allocated
+ *   with Platform::New when all existing chunks are full, and freed once all of their objects have been released (one
+ *   empty chunk is kept for reuse).
+ *
+ *   Unlike BitMapObjectPool, this class is not thread-safe.
+ *
+ *  @tparam     T               a subclass of element to be allocated.
+ *  @tparam     kChunkCapacity  a positive integer number of elements allocated together.
+ */
+template <class T, size_t kChunkCapacity = 32>
+class HeapObjectPool
+{
+public:
+    HeapObjectPool() = default;
+    ~HeapObjectPool()
+    {
+        // Objects still allocated at this point are leaked rather than destroyed, as with BitMapObjectPool.
+        while (mChunks != nullptr)
+        {
+            Chunk * next = mChunks->mNext;
+            Platform::Delete(mChunks);
+            mChunks = next;
+        }
+    }
+
+    HeapObjectPool(const HeapObjectPool &) = delete;
+    HeapObjectPool & operator=(const HeapObjectPool &) = delete;
+
+    size_t Capacity() const { return mChunkCount * kChunkCapacity; }
+    size_t Allocated() const { return mAllocated; }
+    bool Exhausted() const { return false; }
+
+    /// Returns whether \c element points into one of the chunks of this pool.
+    bool Contains(const void * element) const
+    {
+        for (const Chunk * chunk = mChunks; chunk != nullptr; chunk = chunk->mNext)
+        {
+            if (chunk->mPool.Contains(element))
+                return true;
+        }
+        return false;
+    }
+
+    template <typename... Args>
+    T * CreateObject(Args &&... args)
+    {
+        Chunk * chunk = mChunks;
+        while (chunk != nullptr && chunk->mPool.Exhausted())
+        {
+            chunk = chunk->mNext;
+        }
+
+        if (chunk == nullptr)
+        {
+            chunk = Platform::New<Chunk>();
+            if (chunk == nullptr)
+                return nullptr;
+
+            chunk->mNext = mChunks;
+            mChunks      = chunk;
+            mChunkCount++;
+        }
+
+        T * element = chunk->mPool.CreateObject(std::forward<Args>(args)...);
+        if (element != nullptr)
+            mAllocated++;
+        return element;
+    }
+
+    void ReleaseObject(T * element)
+    {
+        if (element == nullptr)
+            return;
+
+        // The element must come from this pool.
+        Chunk * chunk = mChunks;
+        VerifyOrDie(chunk != nullptr);
+        while (!chunk->mPool.Contains(element))
+        {
+            chunk = chunk->mNext;
+            VerifyOrDie(chunk != nullptr);
+        }
+
+        chunk->mPool.ReleaseObject(element);
+        mAllocated--;
+
+        if (chunk->mPool.Allocated() == 0 && mIterationDepth == 0)
+        {
+            FreeEmptyChunks();
+        }
+    }
+
+    template <typename... Args>
+    void ResetObject(T * element, Args &&... args)
+    {
+        element->~T();
+        new (element) T(std::forward<Args>(args)...);
+    }
+
+    /// Frees all empty chunks, including the one kept for reuse, e.g. before the memory allocator shuts down.
+    void ReleaseEmptyChunks() { FreeEmptyChunks(/* keepOne = */ false); }
+
+    /**
+     * @brief
+     *   Run a functor for each active object in the pool
+     *
+     *  @param     function The functor of type `bool (*)(T*)`, return false to break the iteration
+     *  @return    bool     Returns false if broke during iteration
+     *
+     *  The functor may create and release objects. Objects created during the iteration may or may not be visited.
+     */
+    template <typename Function>
+    bool ForEachActiveObject(Function && function)
+    {
+        bool completed = true;
+
+        // Chunks emptied by the functor are freed once the outermost iteration is done with them.
+        mIterationDepth++;
+        for (Chunk * chunk = mChunks; chunk != nullptr && completed; chunk = chunk->mNext)
+        {
+            completed = chunk->mPool.ForEachActiveObject([&function](T * element) { return function(element); });
+        }
+        mIterationDepth--;
+
+        if (mIterationDepth == 0)
+        {
+            FreeEmptyChunks();
+        }
+        return completed;
+    }
+
+private:
+    struct Chunk
+    {
+        BitMapObjectPool<T, kChunkCapacity> mPool;
+        Chunk * mNext = nullptr;
+    };
+
+    // Frees all empty chunks but one, which is kept unless keepOne is false to avoid allocating a chunk again for the next object.
+    void FreeEmptyChunks(bool keepOne = true)
+    {
+        bool keptEmptyChunk = !keepOne;
+        Chunk ** link       = &mChunks;
+        while (*link != nullptr)
+        {
+            Chunk * chunk = *link;
+            if (chunk->mPool.Allocated() == 0 && !keptEmptyChunk)
+            {
+                keptEmptyChunk = true;
+                link           = &chunk->mNext;
+            }
+            else if (chunk->mPool.Allocated() == 0)
+            {
+                *link = chunk->mNext;
+                Platform::Delete(chunk);
+                mChunkCount--;
+            }
+            else
+            {
+                link = &chunk->mNext;
+            }
+        }
+    }
+
+    Chunk * mChunks        = nullptr;
+    size_t mChunkCount     = 0;
+    size_t mAllocated      = 0;
+    size_t mIterationDepth = 0;
+};
+
+/**
+ *  @brief
+ *   Selects the pool used for a set of objects: a HeapObjectPool when kUseHeap is true, so that the number of objects is
+ *   limited only by available memory, or otherwise a BitMapObjectPool with room for N objects.
+ */
+template <class T, size_t N, bool kUseHeap>
+using BitMapOrHeapObjectPool = typename std::conditional<kUseHeap, HeapObjectPool<T>, BitMapObjectPool<T, N>>::type;
+
 } // namespace chip
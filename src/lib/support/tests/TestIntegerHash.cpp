@@ -0,0 +1,100 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for CHIP IntegerHash
+ *
+ */
+
+#include <lib/support/IntegerHash.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <initializer_list>
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr uint32_t kSlotCount = 64;
+
+enum class SlotBits
+{
+    kLow,  // hash % kSlotCount
+    kHigh, // hash >> 26
+};
+
+// Number of the kSlotCount slots hit by kSlotCount keys, starting at firstKey keyStep apart, all hashed with extra + extraStep
+// times their position.
+uint32_t CountUsedSlots(SlotBits slotBits, uint32_t firstKey, uint32_t keyStep, uint32_t extraStep = 0)
+{
+    uint64_t usedSlots = 0;
+    for (uint32_t i = 0; i < kSlotCount; i++)
+    {
+        uint32_t hash = IntegerHash(firstKey + i * keyStep, i * extraStep);
+        usedSlots |= static_cast<uint64_t>(1) << ((slotBits == SlotBits::kHigh) ? (hash >> 26) : (hash % kSlotCount));
+    }
+
+    uint32_t count = 0;
+    for (; usedSlots != 0; usedSlots &= usedSlots - 1)
+    {
+        count++;
+    }
+    return count;
+}
+
+void TestSpread(nlTestSuite * inSuite, void * inContext)
+{
+    // Hashing kSlotCount keys at random would hit about 41 slots. Ids that follow each other, that are a power of two apart,
+    // or that only differ in their high bits as manufacturer specific ids do, must not do much worse.
+    for (SlotBits slotBits : { SlotBits::kLow, SlotBits::kHigh })
+    {
+        NL_TEST_ASSERT(inSuite, CountUsedSlots(slotBits, 0, 1) >= 32);
+        NL_TEST_ASSERT(inSuite, CountUsedSlots(slotBits, 0, 64) >= 32);
+        NL_TEST_ASSERT(inSuite, CountUsedSlots(slotBits, 0x0006, 0x10000) >= 32);
+        NL_TEST_ASSERT(inSuite, CountUsedSlots(slotBits, 0x0006, 0) == 1);
+    }
+}
+
+void TestExtra(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, IntegerHash(6) == IntegerHash(6, 0));
+    NL_TEST_ASSERT(inSuite, IntegerHash(6, 1) != IntegerHash(6, 0));
+    NL_TEST_ASSERT(inSuite, IntegerHash(6, 1) != IntegerHash(1, 6));
+
+    // The extra value spreads the hashes of a key as well as the key itself does.
+    for (SlotBits slotBits : { SlotBits::kLow, SlotBits::kHigh })
+    {
+        NL_TEST_ASSERT(inSuite, CountUsedSlots(slotBits, 0x0006, 0, 1) >= 32);
+        NL_TEST_ASSERT(inSuite, CountUsedSlots(slotBits, 0x0006, 0, 0x100) >= 32);
+    }
+}
+
+const nlTest sTests[] = { NL_TEST_DEF("TestSpread", TestSpread), NL_TEST_DEF("TestExtra", TestExtra), NL_TEST_SENTINEL() };
+
+} // namespace
+
+int TestIntegerHash(void)
+{
+    nlTestSuite theSuite = { "CHIP IntegerHash tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestIntegerHash)
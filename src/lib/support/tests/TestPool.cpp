@@ -32,8 +32,8 @@
 
 namespace chip {
 
-template <class T, size_t N>
-size_t GetNumObjectsInUse(BitMapObjectPool<T, N> & pool)
+template <class Pool>
+size_t GetNumObjectsInUse(Pool & pool)
 {
     size_t count = 0;
     pool.ForEachActiveObject([&count](void *) {
@@ -129,13 +129,166 @@ void TestCreateReleaseStruct(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void TestCreateReleaseAtFillLevels(nlTestSuite * inSuite, void * inContext)
+{
+    // A capacity that is not a multiple of the usage word size also covers the partially used last word.
+    constexpr const size_t size             = 1000;
+    constexpr const size_t kFillPercents[] = { 0, 10, 50, 90, 100 };
+    BitMapObjectPool<uint32_t, size> pool;
+    uint32_t * objs[size];
+
+    for (size_t fillPercent : kFillPercents)
+    {
+        const size_t fill = size * fillPercent / 100;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            objs[i] = pool.CreateObject(static_cast<uint32_t>(i));
+            NL_TEST_ASSERT(inSuite, objs[i] != nullptr);
+        }
+        NL_TEST_ASSERT(inSuite, pool.Exhausted());
+        NL_TEST_ASSERT(inSuite, pool.CreateObject() == nullptr);
+
+        // Release objects in a strided order so that the free slots are spread over all usage words.
+        for (size_t i = 0; i < size - fill; ++i)
+        {
+            const size_t index = (i * 7) % size;
+            pool.ReleaseObject(objs[index]);
+            objs[index] = nullptr;
+        }
+        NL_TEST_ASSERT(inSuite, pool.Allocated() == fill);
+
+        // Every remaining object is visited exactly once.
+        size_t visited = 0;
+        bool valid     = true;
+        pool.ForEachActiveObject([&](uint32_t * obj) {
+            valid = valid && *obj < size && objs[*obj] == obj;
+            ++visited;
+            return true;
+        });
+        NL_TEST_ASSERT(inSuite, valid);
+        NL_TEST_ASSERT(inSuite, visited == fill);
+
+        // Every released slot is found again, wherever the allocation hint was left.
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (objs[i] == nullptr)
+            {
+                objs[i] = pool.CreateObject(static_cast<uint32_t>(i));
+                NL_TEST_ASSERT(inSuite, objs[i] != nullptr);
+            }
+        }
+        NL_TEST_ASSERT(inSuite, pool.Exhausted());
+        NL_TEST_ASSERT(inSuite, pool.CreateObject() == nullptr);
+        NL_TEST_ASSERT(inSuite, std::set<uint32_t *>(objs, objs + size).size() == size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            pool.ReleaseObject(objs[i]);
+        }
+        NL_TEST_ASSERT(inSuite, pool.Allocated() == 0);
+        NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == 0);
+    }
+}
+
+void TestHeapPoolCreateRelease(nlTestSuite * inSuite, void * inContext)
+{
+    struct S
+    {
+        S(std::set<S *> & set) : mSet(set) { mSet.insert(this); }
+        ~S() { mSet.erase(this); }
+        std::set<S *> & mSet;
+    };
+
+    std::set<S *> objs1;
+
+    // Many more objects than fit in one chunk.
+    constexpr const size_t kChunkCapacity = 8;
+    constexpr const size_t size           = 100;
+    HeapObjectPool<S, kChunkCapacity> pool;
+    S * objs2[size];
+    for (size_t i = 0; i < size; ++i)
+    {
+        objs2[i] = pool.CreateObject(objs1);
+        NL_TEST_ASSERT(inSuite, objs2[i] != nullptr);
+        NL_TEST_ASSERT(inSuite, pool.Allocated() == i + 1);
+        NL_TEST_ASSERT(inSuite, !pool.Exhausted());
+    }
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == size);
+    NL_TEST_ASSERT(inSuite, objs1.size() == size);
+    NL_TEST_ASSERT(inSuite, pool.Capacity() >= size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        NL_TEST_ASSERT(inSuite, pool.Contains(objs2[i]));
+    }
+    NL_TEST_ASSERT(inSuite, !pool.Contains(&objs1));
+
+    for (size_t i = 0; i < size; i += 2)
+    {
+        pool.ReleaseObject(objs2[i]);
+    }
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == size / 2);
+    NL_TEST_ASSERT(inSuite, pool.Allocated() == size / 2);
+    NL_TEST_ASSERT(inSuite, objs1.size() == size / 2);
+
+    for (size_t i = 1; i < size; i += 2)
+    {
+        pool.ReleaseObject(objs2[i]);
+    }
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == 0);
+    NL_TEST_ASSERT(inSuite, pool.Allocated() == 0);
+    NL_TEST_ASSERT(inSuite, objs1.empty());
+
+    // Only one empty chunk is kept around.
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == kChunkCapacity);
+
+    pool.ReleaseEmptyChunks();
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == 0);
+}
+
+void TestHeapPoolReleaseDuringIteration(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr const size_t kChunkCapacity = 4;
+    constexpr const size_t size           = 50;
+    HeapObjectPool<uint32_t, kChunkCapacity> pool;
+    for (size_t i = 0; i < size; ++i)
+    {
+        NL_TEST_ASSERT(inSuite, pool.CreateObject(static_cast<uint32_t>(i)) != nullptr);
+    }
+
+    size_t visited = 0;
+    pool.ForEachActiveObject([&](uint32_t * object) {
+        ++visited;
+        pool.ReleaseObject(object);
+        return true;
+    });
+    NL_TEST_ASSERT(inSuite, visited == size);
+    NL_TEST_ASSERT(inSuite, pool.Allocated() == 0);
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == 0);
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == kChunkCapacity);
+
+    // Breaking out of the iteration is reported.
+    NL_TEST_ASSERT(inSuite, pool.CreateObject(0u) != nullptr);
+    NL_TEST_ASSERT(inSuite, pool.CreateObject(1u) != nullptr);
+    visited = 0;
+    NL_TEST_ASSERT(inSuite, !pool.ForEachActiveObject([&](uint32_t *) {
+        ++visited;
+        return false;
+    }));
+    NL_TEST_ASSERT(inSuite, visited == 1);
+}
+
 int Setup(void * inContext)
 {
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
     return SUCCESS;
 }
 
 int Teardown(void * inContext)
 {
+    chip::Platform::MemoryShutdown();
     return SUCCESS;
 }
 
@@ -145,8 +298,13 @@ int Teardown(void * inContext)
 /**
  *   Test Suite. It lists all the test functions.
  */
-static const nlTest sTests[] = { NL_TEST_DEF_FN(TestReleaseNull), NL_TEST_DEF_FN(TestCreateReleaseObject),
-                                 NL_TEST_DEF_FN(TestCreateReleaseStruct), NL_TEST_SENTINEL() };
+static const nlTest sTests[] = { NL_TEST_DEF_FN(TestReleaseNull),
+                                 NL_TEST_DEF_FN(TestCreateReleaseObject),
+                                 NL_TEST_DEF_FN(TestCreateReleaseStruct),
+                                 NL_TEST_DEF_FN(TestCreateReleaseAtFillLevels),
+                                 NL_TEST_DEF_FN(TestHeapPoolCreateRelease),
+                                 NL_TEST_DEF_FN(TestHeapPoolReleaseDuringIteration),
+                                 NL_TEST_SENTINEL() };
 
 int TestPool()
 {
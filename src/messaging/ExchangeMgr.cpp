@@ -102,6 +102,10 @@ CHIP_ERROR ExchangeManager::Shutdown()
         assert(false);
         return true;
     });
+#if CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP
+    // The exchange manager may outlive the memory allocator, give the heap back while it is still there.
+    mContextPool.ReleaseEmptyChunks();
+#endif // CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP
 
     if (mSessionManager != nullptr)
     {
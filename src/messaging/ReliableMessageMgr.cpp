@@ -37,11 +37,12 @@
 namespace chip {
 namespace Messaging {
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry() : rc(nullptr), nextRetransTimeTick(0), sendCount(0) {}
+ReliableMessageMgr::RetransTableEntry::RetransTableEntry() : rc(nullptr), nextRetransTime(0), queueIndex(kNotQueued), sendCount(0)
+{}
 
-ReliableMessageMgr::ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
+ReliableMessageMgr::ReliableMessageMgr(ExchangeContextPool & contextPool) :
     mContextPool(contextPool), mSystemLayer(nullptr), mSessionManager(nullptr), mCurrentTimerExpiry(0),
-    mTimerIntervalShift(CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT)
+    mTimerIntervalShift(CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT), mRetransQueueLength(0)
 {}
 
 ReliableMessageMgr::~ReliableMessageMgr() {}
@@ -90,8 +91,9 @@ void ReliableMessageMgr::TicklessDebugDumpRetransTable(const char * log)
         {
             ChipLogDetail(ExchangeManager,
                           "EC:" ChipLogFormatExchange " MessageCounter:" ChipLogFormatMessageCounter
-                          " NextRetransTimeCtr:%04" PRIX16,
-                          ChipLogValueExchange(entry.rc->GetExchangeContext()), entry.messageCounter, entry.nextRetransTimeTick);
+                          " NextRetransTime:%" PRIu64,
+                          ChipLogValueExchange(entry.rc->GetExchangeContext()), entry.retainedBuf.GetMessageCounter(),
+                          entry.nextRetransTime);
         }
     }
 }
@@ -124,14 +126,27 @@ void ReliableMessageMgr::ExecuteActions()
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries before processing");
 
+    // Take every entry whose retrans timeout has expired off the queue first, so that an entry
+    // rescheduled below is not handled twice in the same pass.
+    const System::Clock::MonotonicMilliseconds now = System::Clock::GetMonotonicMilliseconds();
+    RetransTableEntry * dueEntries[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    size_t dueCount = 0;
+    while (mRetransQueueLength > 0 && mRetransQueue[0]->nextRetransTime <= now)
+    {
+        dueEntries[dueCount++] = mRetransQueue[0];
+        DequeueRetransmission(*mRetransQueue[0]);
+    }
+
     // Retransmit / cancel anything in the retrans table whose retrans timeout
     // has expired
-    for (RetransTableEntry & entry : mRetransTable)
+    for (size_t i = 0; i < dueCount; i++)
     {
+        RetransTableEntry & entry   = *dueEntries[i];
         ReliableMessageContext * rc = entry.rc;
         CHIP_ERROR err              = CHIP_NO_ERROR;
 
-        if (!rc || entry.nextRetransTimeTick != 0)
+        // Handling an earlier entry may have cleared this one, or cleared and reused its slot.
+        if (!rc || entry.queueIndex != kNotQueued)
             continue;
 
         if (entry.retainedBuf.IsNull())
@@ -169,7 +184,8 @@ void ReliableMessageMgr::ExecuteActions()
         if (err == CHIP_NO_ERROR)
         {
             // If the retransmission was successful, update the passive timer
-            entry.nextRetransTimeTick = static_cast<uint16_t>(rc->GetActiveRetransmitTimeoutTick());
+            entry.nextRetransTime = now + (static_cast<uint64_t>(rc->GetActiveRetransmitTimeoutTick()) << mTimerIntervalShift);
+            QueueRetransmission(entry);
 #if !defined(NDEBUG)
             ChipLogDetail(ExchangeManager,
                           "Retransmitted MessageCounter:" ChipLogFormatMessageCounter " on exchange " ChipLogFormatExchange
@@ -220,20 +236,6 @@ void ReliableMessageMgr::ExpireTicks()
         }
     });
 
-    for (RetransTableEntry & entry : mRetransTable)
-    {
-        ReliableMessageContext * rc = entry.rc;
-        if (rc)
-        {
-            // Decrement Retransmit timeout by elapsed timeticks
-            TickProceed(entry.nextRetransTimeTick, deltaTicks);
-#if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks set nextRetransTimeTick to %u",
-                          entry.nextRetransTimeTick);
-#endif
-        } // rc entry is allocated
-    }
-
     // Re-Adjust the base time stamp to the most recent tick boundary
     mTimeStampBase += (deltaTicks << mTimerIntervalShift);
 
@@ -252,6 +254,9 @@ void ReliableMessageMgr::Timeout(System::Layer * aSystemLayer, void * aAppState)
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::Timeout\n");
 #endif
 
+    // The timer has fired, so it is no longer armed for any expiry time
+    manager->mCurrentTimerExpiry = 0;
+
     // Make sure all tick counts are sync'd to the current time
     manager->ExpireTicks();
 
@@ -277,9 +282,10 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
             // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
             ExpireTicks();
 
-            entry.rc          = rc;
-            entry.sendCount   = 0;
-            entry.retainedBuf = EncryptedPacketBufferHandle();
+            entry.rc              = rc;
+            entry.sendCount       = 0;
+            entry.retainedBuf     = EncryptedPacketBufferHandle();
+            entry.nextRetransTime = 0;
 
             *rEntry = &entry;
 
@@ -306,8 +312,9 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
     VerifyOrReturn(entry != nullptr && entry->rc != nullptr,
                    ChipLogError(ExchangeManager, "StartRetransmission was called for invalid entry"));
 
-    entry->nextRetransTimeTick = static_cast<uint16_t>(entry->rc->GetInitialRetransmitTimeoutTick() +
-                                                       GetTickCounterFromTimeDelta(System::Clock::GetMonotonicMilliseconds()));
+    entry->nextRetransTime = System::Clock::GetMonotonicMilliseconds() +
+        (static_cast<uint64_t>(entry->rc->GetInitialRetransmitTimeoutTick()) << mTimerIntervalShift);
+    QueueRetransmission(*entry);
 
     // Check if the timer needs to be started and start it.
     StartTimer();
@@ -319,7 +326,11 @@ void ReliableMessageMgr::PauseRetransmision(ReliableMessageContext * rc, uint32_
     {
         if (entry.rc == rc)
         {
-            entry.nextRetransTimeTick = static_cast<uint16_t>(entry.nextRetransTimeTick + (PauseTimeMillis >> mTimerIntervalShift));
+            if (entry.queueIndex != kNotQueued)
+            {
+                entry.nextRetransTime += PauseTimeMillis;
+                QueueRetransmission(entry);
+            }
             break;
         }
     }
@@ -331,7 +342,11 @@ void ReliableMessageMgr::ResumeRetransmision(ReliableMessageContext * rc)
     {
         if (entry.rc == rc)
         {
-            entry.nextRetransTimeTick = 0;
+            if (entry.queueIndex != kNotQueued)
+            {
+                entry.nextRetransTime = System::Clock::GetMonotonicMilliseconds();
+                QueueRetransmission(entry);
+            }
             break;
         }
     }
@@ -423,6 +438,11 @@ void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & rEntry)
         // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
         ExpireTicks();
 
+        if (rEntry.queueIndex != kNotQueued)
+        {
+            DequeueRetransmission(rEntry);
+        }
+
         rEntry.rc->SetOccupied(false);
         rEntry.rc->ReleaseContext();
         rEntry.rc = nullptr;
@@ -467,31 +487,28 @@ void ReliableMessageMgr::StartTimer()
         }
     });
 
-    for (RetransTableEntry & entry : mRetransTable)
+    System::Clock::MonotonicMilliseconds timerExpiry = 0;
+    if (foundWake)
     {
-        ReliableMessageContext * rc = entry.rc;
-        if (rc)
-        {
-            // When do we need to next wake up for ReliableMessageProtocol retransmit?
-            if (entry.nextRetransTimeTick < nextWakeTimeTick)
-            {
-                nextWakeTimeTick = entry.nextRetransTimeTick;
-                foundWake        = true;
+        // Set timer for next tick boundary - subtract the elapsed time from the current tick
+        timerExpiry = (nextWakeTimeTick << mTimerIntervalShift) + mTimeStampBase;
+    }
+
+    // When do we need to next wake up for ReliableMessageProtocol retransmit?
+    if (mRetransQueueLength > 0 && (!foundWake || mRetransQueue[0]->nextRetransTime < timerExpiry))
+    {
+        timerExpiry = mRetransQueue[0]->nextRetransTime;
+        foundWake   = true;
 #if defined(RMP_TICKLESS_DEBUG)
-                ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer RetransTime %u", nextWakeTimeTick);
+        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer RetransTime %" PRIu64, timerExpiry);
 #endif
-            }
-        }
     }
 
     if (foundWake)
     {
-        // Set timer for next tick boundary - subtract the elapsed time from the current tick
-        System::Clock::MonotonicMilliseconds timerExpiry = (nextWakeTimeTick << mTimerIntervalShift) + mTimeStampBase;
-
 #if defined(RMP_TICKLESS_DEBUG)
-        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer wake at %" PRIu64 " ms (%" PRIu64 " %" PRIu64 ")",
-                      timerExpiry, nextWakeTimeTick, mTimeStampBase);
+        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer wake at %" PRIu64 " ms (%" PRIu64 ")", timerExpiry,
+                      mTimeStampBase);
 #endif
         if (timerExpiry != mCurrentTimerExpiry)
         {
@@ -534,6 +551,86 @@ void ReliableMessageMgr::StopTimer()
     mSystemLayer->CancelTimer(Timeout, this);
 }
 
+void ReliableMessageMgr::QueueRetransmission(RetransTableEntry & entry)
+{
+    if (entry.queueIndex == kNotQueued)
+    {
+        // Every queued entry is a distinct slot of mRetransTable, so the queue cannot overflow.
+        VerifyOrDie(mRetransQueueLength < CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE);
+        PlaceInQueue(&entry, mRetransQueueLength++);
+        SiftUp(entry.queueIndex);
+    }
+    else
+    {
+        // The time of a queued entry changed; restore the heap order in whichever direction it is violated.
+        SiftUp(entry.queueIndex);
+        SiftDown(entry.queueIndex);
+    }
+}
+
+void ReliableMessageMgr::DequeueRetransmission(RetransTableEntry & entry)
+{
+    const size_t index = entry.queueIndex;
+    entry.queueIndex   = kNotQueued;
+
+    mRetransQueueLength--;
+    if (index != mRetransQueueLength)
+    {
+        // Move the last entry into the hole and restore the heap order in whichever direction it is violated.
+        RetransTableEntry * moved = mRetransQueue[mRetransQueueLength];
+        PlaceInQueue(moved, index);
+        SiftUp(index);
+        SiftDown(moved->queueIndex);
+    }
+}
+
+void ReliableMessageMgr::PlaceInQueue(RetransTableEntry * entry, size_t index)
+{
+    mRetransQueue[index] = entry;
+    entry->queueIndex    = index;
+}
+
+void ReliableMessageMgr::SiftUp(size_t index)
+{
+    RetransTableEntry * entry = mRetransQueue[index];
+    while (index > 0)
+    {
+        const size_t parent = (index - 1) / 2;
+        if (mRetransQueue[parent]->nextRetransTime <= entry->nextRetransTime)
+        {
+            break;
+        }
+        PlaceInQueue(mRetransQueue[parent], index);
+        index = parent;
+    }
+    PlaceInQueue(entry, index);
+}
+
+void ReliableMessageMgr::SiftDown(size_t index)
+{
+    RetransTableEntry * entry = mRetransQueue[index];
+    for (;;)
+    {
+        size_t earliest = index * 2 + 1;
+        if (earliest >= mRetransQueueLength)
+        {
+            break;
+        }
+        if (earliest + 1 < mRetransQueueLength &&
+            mRetransQueue[earliest + 1]->nextRetransTime < mRetransQueue[earliest]->nextRetransTime)
+        {
+            earliest++;
+        }
+        if (entry->nextRetransTime <= mRetransQueue[earliest]->nextRetransTime)
+        {
+            break;
+        }
+        PlaceInQueue(mRetransQueue[earliest], index);
+        index = earliest;
+    }
+    PlaceInQueue(entry, index);
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
@@ -42,6 +42,12 @@ namespace Messaging {
 enum class SendMessageFlags : uint16_t;
 class ReliableMessageContext;
 
+/**
+ * Pool holding the exchange contexts of an ExchangeManager, see CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP.
+ */
+using ExchangeContextPool =
+    BitMapOrHeapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP>;
+
 class ReliableMessageMgr
 {
 public:
@@ -54,19 +60,24 @@ public:
      *    acknowledgment back. If the acknowledgment is not received within a
      *    specific timeout, the message would be retransmitted from this table.
      *
+     *    Entries whose retransmission has started are kept in a queue ordered by
+     *    their next retransmission time, so that the due entries and the next
+     *    wakeup time are found without scanning the table.
+     *
      */
     struct RetransTableEntry
     {
         RetransTableEntry();
 
-        ReliableMessageContext * rc;             /**< The context for the stored CHIP message. */
-        EncryptedPacketBufferHandle retainedBuf; /**< The packet buffer holding the CHIP message. */
-        uint16_t nextRetransTimeTick;            /**< A counter representing the next retransmission time for the message. */
-        uint8_t sendCount;                       /**< A counter representing the number of times the message has been sent. */
+        ReliableMessageContext * rc;                          /**< The context for the stored CHIP message. */
+        EncryptedPacketBufferHandle retainedBuf;              /**< The packet buffer holding the CHIP message. */
+        System::Clock::MonotonicMilliseconds nextRetransTime; /**< The time at which the message is next retransmitted. */
+        size_t queueIndex;                                    /**< Position in the retransmission queue, if queued. */
+        uint8_t sendCount; /**< A counter representing the number of times the message has been sent. */
     };
 
 public:
-    ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
+    ReliableMessageMgr(ExchangeContextPool & contextPool);
     ~ReliableMessageMgr();
 
     void Init(chip::System::Layer * systemLayer, SessionManager * sessionManager);
@@ -91,7 +102,7 @@ public:
     uint64_t GetTickCounterFromTimeDelta(uint64_t newTime);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
+     * Iterate through active exchange contexts and the due retrans table entries.  If an
      * action needs to be triggered by ReliableMessageProtocol time facilities,
      * execute that action.
      */
@@ -192,10 +203,9 @@ public:
     void FailRetransTableEntries(ReliableMessageContext * rc, CHIP_ERROR err);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
-     * Determine how many ReliableMessageProtocol ticks we need to sleep before we
-     * need to physically wake the CPU to perform an action.  Set a timer to go off
-     * when we next need to wake the system.
+     * Iterate through active exchange contexts and look up the earliest queued retransmission.
+     * Determine how long we need to sleep before we need to physically wake the CPU to
+     * perform an action.  Set a timer to go off when we next need to wake the system.
      *
      */
     void StartTimer();
@@ -208,11 +218,12 @@ public:
 
     /**
      * Calculate number of virtual ReliableMessageProtocol ticks that have expired
-     * since we last called this function. Iterate through active exchange contexts
-     * and retrans table entries, subtracting expired virtual ticks to synchronize
-     * wakeup times with the current system time. Do not perform any actions beyond
-     * updating tick counts, actions will be performed by the physical
-     * ReliableMessageProtocol timer tick expiry.
+     * since we last called this function. Iterate through active exchange contexts,
+     * subtracting expired virtual ticks from their pending acks to synchronize
+     * wakeup times with the current system time. Retrans table entries hold absolute
+     * times and need no adjustment. Do not perform any actions beyond updating tick
+     * counts, actions will be performed by the physical ReliableMessageProtocol timer
+     * expiry.
      *
      */
     void ExpireTicks();
@@ -224,7 +235,7 @@ public:
 #endif // CHIP_CONFIG_TEST
 
 private:
-    BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
+    ExchangeContextPool & mContextPool;
     chip::System::Layer * mSystemLayer;
     SessionManager * mSessionManager;
     uint64_t mTimeStampBase; // ReliableMessageProtocol timer base value to add offsets to evaluate timeouts
@@ -243,8 +254,18 @@ private:
 
     void TicklessDebugDumpRetransTable(const char * log);
 
+    // Binary min-heap of the entries in mRetransQueue, ordered by nextRetransTime.
+    static constexpr size_t kNotQueued = SIZE_MAX;
+    void QueueRetransmission(RetransTableEntry & entry);
+    void DequeueRetransmission(RetransTableEntry & entry);
+    void PlaceInQueue(RetransTableEntry * entry, size_t index);
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+
     // ReliableMessageProtocol Global tables for timer context
     RetransTableEntry mRetransTable[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    RetransTableEntry * mRetransQueue[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    size_t mRetransQueueLength;
 };
 
 } // namespace Messaging
@@ -280,6 +280,64 @@ void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
     exchange->Close();
 }
 
+void CheckResendOnlyDueMessages(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    MockAppDelegate mockSender;
+    ExchangeContext * slowExchange = ctx.NewExchangeToAlice(&mockSender);
+    ExchangeContext * fastExchange = ctx.NewExchangeToAlice(&mockSender);
+    NL_TEST_ASSERT(inSuite, slowExchange != nullptr);
+    NL_TEST_ASSERT(inSuite, fastExchange != nullptr);
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    slowExchange->GetReliableMessageContext()->SetConfig({
+        1000, // CHIP_CONFIG_MRP_DEFAULT_INITIAL_RETRY_INTERVAL
+        1000, // CHIP_CONFIG_MRP_DEFAULT_ACTIVE_RETRY_INTERVAL
+    });
+    fastExchange->GetReliableMessageContext()->SetConfig({
+        1, // CHIP_CONFIG_MRP_DEFAULT_INITIAL_RETRY_INTERVAL
+        1, // CHIP_CONFIG_MRP_DEFAULT_ACTIVE_RETRY_INTERVAL
+    });
+
+    // Drop the initial message of both exchanges
+    gLoopback.mSentMessageCount    = 0;
+    gLoopback.mNumMessagesToDrop   = 2;
+    gLoopback.mDroppedMessageCount = 0;
+
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+
+    // Send on the slow exchange first, so that the first message to retransmit is not the first one queued.
+    err = slowExchange->SendMessage(Echo::MsgType::EchoRequest, chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                    SendMessageFlags::kExpectResponse);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = fastExchange->SendMessage(Echo::MsgType::EchoRequest, chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                    SendMessageFlags::kExpectResponse);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, gLoopback.mDroppedMessageCount == 2);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 2);
+
+    // 1 tick is 64 ms, sleep 65 ms to trigger the re-transmit of the fast exchange only
+    test_os_sleep_ms(65);
+    ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm);
+
+    // The fast exchange's message was resent and acknowledged, the slow exchange's message is still waiting
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount >= 3);
+    NL_TEST_ASSERT(inSuite, gLoopback.mDroppedMessageCount == 2);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
+
+    rm->ClearRetransTable(slowExchange->GetReliableMessageContext());
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+
+    slowExchange->Close();
+    fastExchange->Close();
+}
+
 void CheckCloseExchangeAndResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -1273,6 +1331,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ReliableMessageMgr::CheckAddClearRetrans", CheckAddClearRetrans),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailRetrans", CheckFailRetrans),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendApplicationMessage", CheckResendApplicationMessage),
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckResendOnlyDueMessages", CheckResendOnlyDueMessages),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckCloseExchangeAndResendApplicationMessage", CheckCloseExchangeAndResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailedMessageRetainOnSend", CheckFailedMessageRetainOnSend),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendApplicationMessageWithPeerExchange", CheckResendApplicationMessageWithPeerExchange),
@@ -46,3 +46,7 @@ struct ChipDeviceEvent;
 #ifndef CHIP_SYSTEM_CONFIG_NUM_TIMERS
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 16
 #endif // CHIP_SYSTEM_CONFIG_NUM_TIMERS
+
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP 1
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
@@ -90,6 +90,26 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 8
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+#ifndef CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP
+#define CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP 1
+#endif // CHIP_CONFIG_EXCHANGE_CONTEXT_POOL_USE_HEAP
+
+#ifndef CHIP_CONFIG_PEER_CONNECTION_POOL_USE_HEAP
+#define CHIP_CONFIG_PEER_CONNECTION_POOL_USE_HEAP 1
+#endif // CHIP_CONFIG_PEER_CONNECTION_POOL_USE_HEAP
+
+#ifndef CHIP_DEVICE_CONTROLLER_DEVICE_POOL_USE_HEAP
+#define CHIP_DEVICE_CONTROLLER_DEVICE_POOL_USE_HEAP 1
+#endif // CHIP_DEVICE_CONTROLLER_DEVICE_POOL_USE_HEAP
+
+#ifndef CHIP_IM_SERVER_POOLS_USE_HEAP
+#define CHIP_IM_SERVER_POOLS_USE_HEAP 1
+#endif // CHIP_IM_SERVER_POOLS_USE_HEAP
+
+#ifndef CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP
+#define CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP 1
+#endif // CHIP_CONFIG_MDNS_OPERATIONAL_RESPONDERS_USE_HEAP
+
 #ifndef CHIP_CONFIG_MAX_ACTIVE_CHANNELS
 #define CHIP_CONFIG_MAX_ACTIVE_CHANNELS 16
 #endif // CHIP_CONFIG_MAX_ACTIVE_CHANNELS
@@ -40,3 +40,17 @@
 
 // On linux platform, we have sys/socket.h, so HAVE_SO_BINDTODEVICE should be set to 1
 #define HAVE_SO_BINDTODEVICE 1
+
+// Linux provides recvmmsg(), so UDP endpoints can drain several datagrams per wakeup.
+#define HAVE_RECVMMSG 1
+
+#ifndef INET_CONFIG_UDP_RECV_BATCH_SIZE
+#define INET_CONFIG_UDP_RECV_BATCH_SIZE 16
+#endif // INET_CONFIG_UDP_RECV_BATCH_SIZE
+
+// Linux provides sendmmsg(), so UDP endpoints can transmit several datagrams per system call.
+#define HAVE_SENDMMSG 1
+
+#ifndef INET_CONFIG_UDP_SEND_BATCH_SIZE
+#define INET_CONFIG_UDP_SEND_BATCH_SIZE 16
+#endif // INET_CONFIG_UDP_SEND_BATCH_SIZE
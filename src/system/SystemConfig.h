@@ -453,6 +453,29 @@ struct LwIPEvent;
 #endif
 #endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_POOL */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) System::Layer implementations keep pending timers in a System::Timer::Heap
+ *      (an indexed 4-ary min-heap with a hash index on the callback and application state, giving O(log n) add and cancel)
+ *      rather than a System::Timer::List (a sorted linked list, with O(n) add and cancel but no extra storage).
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_HASH_BUCKETS
+ *
+ *  @brief
+ *      The number of buckets in the System::Timer::Heap index used to find a timer by callback and application state.
+ *      This must be a power of two.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_HASH_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_HASH_BUCKETS 64
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_HASH_BUCKETS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
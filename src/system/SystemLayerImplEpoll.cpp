@@ -0,0 +1,475 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll() and timerfd.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <errno.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+CHIP_ERROR LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(!mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    ReturnErrorOnFailure(mTimerList.Init());
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+    mEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrReturnError(mEpollFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    mTimerFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (mTimerFd < 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        ::close(mEpollFd);
+        mEpollFd = kInvalidFd;
+        return err;
+    }
+
+    // The timerfd is distinguished from socket watches by a null data pointer.
+    epoll_event event = {};
+    event.events      = EPOLLIN;
+    event.data.ptr    = nullptr;
+    if (::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event) != 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        ::close(mTimerFd);
+        ::close(mEpollFd);
+        mTimerFd = kInvalidFd;
+        mEpollFd = kInvalidFd;
+        return err;
+    }
+    mTimerFdAwakenTime = 0;
+    mEpollTimeout      = -1;
+    mEpollResult       = 0;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Create an event to allow an arbitrary thread to wake the thread in the epoll loop.
+    ReturnErrorOnFailure(mWakeEvent.Open(*this));
+
+    VerifyOrReturnError(mLayerState.Init(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturnError(mLayerState.Shutdown(), CHIP_ERROR_INCORRECT_STATE);
+
+    Timer * timer;
+    while ((timer = mTimerList.PopEarliest()) != nullptr)
+    {
+        timer->Clear();
+        timer->Release();
+    }
+    mWakeEvent.Close(*this);
+
+    ::close(mTimerFd);
+    ::close(mEpollFd);
+    mTimerFd = kInvalidFd;
+    mEpollFd = kInvalidFd;
+
+    mLayerState.Reset(); // Return to uninitialized state to permit re-initialization.
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by writing to the wake event.
+     *
+     * If this is being called from within an I/O event callback, then writing to the wake event can be skipped,
+     * since the I/O thread is already awake.
+     *
+     * Furthermore, we don't care if this write fails as the only reasonably likely failure is that the event is full, in which
+     * case the epoll calling thread is going to wake up anyway.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Send notification to wake up the epoll call.
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CHIP_ERROR LayerImplEpoll::StartTimer(uint32_t delayMilliseconds, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delayMilliseconds = 0);
+
+    CancelTimer(onComplete, appState);
+
+    Timer * timer = Timer::New(*this, delayMilliseconds, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    Timer * timer = mTimerList.Remove(onComplete, appState);
+    VerifyOrReturn(timer != nullptr);
+
+    timer->Clear();
+    timer->Release();
+
+    // A stale timerfd expiration only causes a spurious wakeup, after which PrepareEvents() re-arms it,
+    // so there is no need to wake the event loop here.
+}
+
+CHIP_ERROR LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CancelTimer(onComplete, appState);
+
+    Timer * timer = Timer::New(*this, 0, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Duplicate registration is an error.
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        else if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    // Register the socket once, with no interest; RequestCallbackOnPending*() later modify the interest set.
+    epoll_event event = {};
+    event.events      = 0;
+    event.data.ptr    = watch;
+    VerifyOrReturnError(::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, fd, &event) == 0, CHIP_ERROR_POSIX(errno));
+
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return UpdateWatch(watch, SocketEvents(watch->mPendingIO).Set(SocketEventFlags::kRead));
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return UpdateWatch(watch, SocketEvents(watch->mPendingIO).Set(SocketEventFlags::kWrite));
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return UpdateWatch(watch, SocketEvents(watch->mPendingIO).Clear(SocketEventFlags::kRead));
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    return UpdateWatch(watch, SocketEvents(watch->mPendingIO).Clear(SocketEventFlags::kWrite));
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    // Unlike select(), the kernel stops reporting the socket as soon as it is removed, so no wakeup is needed.
+    // Events already returned by epoll_wait() for this watch are discarded by HandleEvents() since mFD is cleared.
+    if (::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "epoll_ctl(DEL) failed: %s", ErrorStr(CHIP_ERROR_POSIX(errno)));
+    }
+
+    watch->Clear();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateWatch(SocketWatch * watch, SocketEvents pendingIO)
+{
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (pendingIO.Raw() == watch->mPendingIO.Raw())
+    {
+        // No update needed.
+        return CHIP_NO_ERROR;
+    }
+
+    epoll_event event = {};
+    event.events      = EpollEventsFromSocketEvents(pendingIO);
+    event.data.ptr    = watch;
+    VerifyOrReturnError(::epoll_ctl(mEpollFd, EPOLL_CTL_MOD, watch->mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+
+    watch->mPendingIO = pendingIO;
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Convert the requested socket events into an epoll interest mask.
+ */
+uint32_t LayerImplEpoll::EpollEventsFromSocketEvents(SocketEvents requested)
+{
+    uint32_t events = 0;
+    if (requested.Has(SocketEventFlags::kRead))
+    {
+        events |= EPOLLIN;
+    }
+    if (requested.Has(SocketEventFlags::kWrite))
+    {
+        events |= EPOLLOUT;
+    }
+    return events;
+}
+
+/**
+ *  Set the read, write or exception bit flags for a socket based on the events reported by epoll_wait().
+ *
+ *  epoll always reports EPOLLERR and EPOLLHUP, whereas select() reports such conditions as readability or writability.
+ *  To preserve the select() semantics that endpoints rely on, those conditions are reported as the requested events.
+ *
+ *  @param[in]    epollEvents   The events reported by epoll_wait().
+ *
+ *  @param[in]    requested     The events currently requested for the socket.
+ */
+SocketEvents LayerImplEpoll::SocketEventsFromEpollEvents(uint32_t epollEvents, SocketEvents requested)
+{
+    SocketEvents res;
+
+    if (epollEvents & (EPOLLERR | EPOLLHUP))
+    {
+        res = requested;
+    }
+    if ((epollEvents & EPOLLIN) && requested.Has(SocketEventFlags::kRead))
+        res.Set(SocketEventFlags::kRead);
+    if ((epollEvents & EPOLLOUT) && requested.Has(SocketEventFlags::kWrite))
+        res.Set(SocketEventFlags::kWrite);
+    if (epollEvents & EPOLLPRI)
+        res.Set(SocketEventFlags::kExcept);
+
+    return res;
+}
+
+void LayerImplEpoll::ArmTimerFd()
+{
+    Timer * timer = mTimerList.Earliest();
+    if (timer == nullptr)
+    {
+        mEpollTimeout = -1;
+        if (mTimerFdAwakenTime != 0)
+        {
+            // Disarm; there is nothing left to wait for.
+            const itimerspec disarm = {};
+            (void) ::timerfd_settime(mTimerFd, 0, &disarm, nullptr);
+            mTimerFdAwakenTime = 0;
+        }
+        return;
+    }
+
+    const Clock::MonotonicMilliseconds currentTime = Clock::GetMonotonicMilliseconds();
+    const Clock::MonotonicMilliseconds awakenTime  = timer->AwakenTime();
+    if (!Clock::IsEarlier(currentTime, awakenTime))
+    {
+        // Already due; don't block in epoll_wait(). Note that a zero timerfd value would disarm it instead.
+        mEpollTimeout = 0;
+        return;
+    }
+
+    mEpollTimeout = -1;
+    if (awakenTime == mTimerFdAwakenTime)
+    {
+        // The timerfd is already armed for this timer.
+        return;
+    }
+
+    itimerspec spec = {};
+    timeval sleepTime;
+    Clock::MillisecondsToTimeval(awakenTime - currentTime, sleepTime);
+    spec.it_value.tv_sec  = sleepTime.tv_sec;
+    spec.it_value.tv_nsec = static_cast<long>(sleepTime.tv_usec) * static_cast<long>(kNanosecondsPerMicrosecond);
+    if (::timerfd_settime(mTimerFd, 0, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %s", ErrorStr(CHIP_ERROR_POSIX(errno)));
+        mTimerFdAwakenTime = 0;
+        mEpollTimeout      = static_cast<int>(awakenTime - currentTime);
+        return;
+    }
+    mTimerFdAwakenTime = awakenTime;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    ArmTimerFd();
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    do
+    {
+        mEpollResult = ::epoll_wait(mEpollFd, mEpollEvents, kEpollEventsMax, mEpollTimeout);
+    } while (mEpollResult < 0 && errno == EINTR);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (mEpollResult < 0)
+    {
+        ChipLogError(DeviceLayer, "epoll_wait failed: %s\n", ErrorStr(CHIP_ERROR_POSIX(errno)));
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        if (mEpollEvents[i].data.ptr == nullptr)
+        {
+            // The timerfd fired; consume the expiration count so that it is not reported again.
+            uint64_t expirations;
+            (void) ::read(mTimerFd, &expirations, sizeof(expirations));
+            mTimerFdAwakenTime = 0;
+        }
+    }
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    Timer::List expiredTimers(mTimerList.ExtractEarlier(1 + Clock::GetMonotonicMilliseconds()));
+    Timer * timer = nullptr;
+    while ((timer = expiredTimers.PopEarliest()) != nullptr)
+    {
+        timer->HandleComplete();
+    }
+
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        SocketWatch * watch = static_cast<SocketWatch *>(mEpollEvents[i].data.ptr);
+        if (watch == nullptr || watch->mFD == kInvalidFd)
+        {
+            // Either the timerfd, or a socket that stopped being watched by an earlier callback.
+            continue;
+        }
+
+        SocketEvents events = SocketEventsFromEpollEvents(mEpollEvents[i].events, watch->mPendingIO);
+        if (events.HasAny() && watch->mCallback != nullptr)
+        {
+            watch->mCallback(events, watch->mCallbackData);
+        }
+    }
+    mEpollResult = 0;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mCallback     = nullptr;
+    mCallbackData = 0;
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll() and timerfd.
+ */
+
+#pragma once
+
+#include <sys/epoll.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * System::Layer implementation for Linux built on epoll.
+ *
+ * Unlike LayerImplSelect, sockets are registered with the kernel once in StartWatchingSocket() and only modified when the
+ * requested read/write interest changes, so each wakeup costs O(ready sockets) rather than O(watched sockets), and file
+ * descriptors are not limited by FD_SETSIZE. The earliest pending Timer is armed on a timerfd that is watched alongside
+ * the sockets. Watches are level-triggered, matching the select() semantics that endpoints rely on.
+ */
+class LayerImplEpoll : public LayerSocketsLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() { mLayerState.Destroy(); }
+
+    // Layer overrides.
+    CHIP_ERROR Init() override;
+    CHIP_ERROR Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CHIP_ERROR StartTimer(uint32_t delayMilliseconds, TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSocketLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+protected:
+    static SocketEvents SocketEventsFromEpollEvents(uint32_t epollEvents, SocketEvents requested);
+    static uint32_t EpollEventsFromSocketEvents(SocketEvents requested);
+
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_DNS_RESOLVER ? INET_CONFIG_NUM_DNS_RESOLVERS : 0);
+
+    // One extra slot for the timerfd.
+    static constexpr int kEpollEventsMax = kSocketWatchMax + 1;
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+    };
+    SocketWatch mSocketWatchPool[kSocketWatchMax];
+
+    CHIP_ERROR UpdateWatch(SocketWatch * watch, SocketEvents pendingIO);
+    void ArmTimerFd();
+
+    Timer::MutexedList mTimerList;
+
+    int mEpollFd = kInvalidFd;
+    int mTimerFd = kInvalidFd;
+
+    // Expiration time currently programmed into mTimerFd, or 0 if it is disarmed.
+    Clock::MonotonicMilliseconds mTimerFdAwakenTime = 0;
+
+    // Timeout passed to epoll_wait(); 0 when a timer is already due, otherwise -1 since mTimerFd provides the wakeup.
+    int mEpollTimeout = -1;
+
+    // Ready events and the return value from epoll_wait(), carried between WaitForEvents() and HandleEvents().
+    epoll_event mEpollEvents[kEpollEventsMax];
+    int mEpollResult = 0;
+
+    ObjectLifeCycle mLayerState;
+    WakeEvent mWakeEvent;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleSelectThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
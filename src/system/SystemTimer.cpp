@@ -255,9 +255,226 @@ Timer * Timer::List::ExtractEarlier(Clock::MonotonicMilliseconds t)
     return begin;
 }
 
+void Timer::Heap::Reset()
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    mNodes.clear();
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    mCount        = 0;
+    mNextSequence = 0;
+    for (auto & bucket : mBuckets)
+    {
+        bucket = nullptr;
+    }
+}
+
+bool Timer::Heap::IsEarlier(const Timer * first, const Timer * second)
+{
+    if (first->mAwakenTime != second->mAwakenTime)
+    {
+        return Clock::IsEarlier(first->mAwakenTime, second->mAwakenTime);
+    }
+    // Equal completion times fire in insertion order; the sequence comparison tolerates wrap.
+    return static_cast<int32_t>(first->mHeapSequence - second->mHeapSequence) < 0;
+}
+
+size_t Timer::Heap::HashBucket(TimerCompleteCallback onComplete, void * appState)
+{
+    uintptr_t hash = reinterpret_cast<uintptr_t>(appState) ^ (reinterpret_cast<uintptr_t>(onComplete) >> 2);
+    hash ^= hash >> 16;
+    hash *= static_cast<uintptr_t>(0x45d9f3b);
+    hash ^= hash >> 16;
+    return static_cast<size_t>(hash) & (kHashBuckets - 1);
+}
+
+void Timer::Heap::HashInsert(Timer * timer)
+{
+    Timer *& bucket      = mBuckets[HashBucket(timer->mOnComplete, timer->AppState)];
+    timer->mNextInBucket = bucket;
+    bucket               = timer;
+}
+
+void Timer::Heap::HashRemove(Timer * timer)
+{
+    for (Timer ** link = &mBuckets[HashBucket(timer->mOnComplete, timer->AppState)]; *link != nullptr;
+         link          = &(*link)->mNextInBucket)
+    {
+        if (*link == timer)
+        {
+            *link                = timer->mNextInBucket;
+            timer->mNextInBucket = nullptr;
+            return;
+        }
+    }
+}
+
+void Timer::Heap::Place(Timer * timer, size_t index)
+{
+    mNodes[index]     = timer;
+    timer->mHeapIndex = index;
+}
+
+void Timer::Heap::SiftUp(size_t index)
+{
+    Timer * timer = mNodes[index];
+    while (index > 0)
+    {
+        const size_t parent = (index - 1) / kArity;
+        if (!IsEarlier(timer, mNodes[parent]))
+        {
+            break;
+        }
+        Place(mNodes[parent], index);
+        index = parent;
+    }
+    Place(timer, index);
+}
+
+void Timer::Heap::SiftDown(size_t index)
+{
+    Timer * timer = mNodes[index];
+    for (;;)
+    {
+        const size_t firstChild = index * kArity + 1;
+        if (firstChild >= mCount)
+        {
+            break;
+        }
+        const size_t lastChild = (firstChild + kArity < mCount) ? (firstChild + kArity) : mCount;
+        size_t earliest        = firstChild;
+        for (size_t child = firstChild + 1; child < lastChild; child++)
+        {
+            if (IsEarlier(mNodes[child], mNodes[earliest]))
+            {
+                earliest = child;
+            }
+        }
+        if (!IsEarlier(mNodes[earliest], timer))
+        {
+            break;
+        }
+        Place(mNodes[earliest], index);
+        index = earliest;
+    }
+    Place(timer, index);
+}
+
+void Timer::Heap::RemoveAt(size_t index)
+{
+    Timer * remove = mNodes[index];
+    HashRemove(remove);
+
+    mCount--;
+    if (index != mCount)
+    {
+        // Move the last node into the hole and restore the heap property in whichever direction it is violated.
+        Place(mNodes[mCount], index);
+        if (index > 0 && IsEarlier(mNodes[index], mNodes[(index - 1) / kArity]))
+        {
+            SiftUp(index);
+        }
+        else
+        {
+            SiftDown(index);
+        }
+    }
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    mNodes.pop_back();
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    remove->mNextTimer = nullptr;
+}
+
+Timer * Timer::Heap::Add(Timer * add)
+{
+    VerifyOrDie(add != Earliest());
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    mNodes.push_back(add);
+#else
+    // Every timer comes from the fixed pool, so the heap cannot overflow.
+    VerifyOrDie(mCount < CHIP_SYSTEM_CONFIG_NUM_TIMERS);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    add->mHeapSequence = mNextSequence++;
+    add->mNextTimer    = nullptr;
+    Place(add, mCount++);
+    SiftUp(add->mHeapIndex);
+    HashInsert(add);
+    return Earliest();
+}
+
+Timer * Timer::Heap::Remove(Timer * remove)
+{
+    VerifyOrDie(mCount > 0);
+
+    if (remove->mHeapIndex < mCount && mNodes[remove->mHeapIndex] == remove)
+    {
+        RemoveAt(remove->mHeapIndex);
+    }
+    return Earliest();
+}
+
+Timer * Timer::Heap::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    // If several timers match, remove the earliest, as Timer::List does.
+    Timer * match = nullptr;
+    for (Timer * timer = mBuckets[HashBucket(aOnComplete, aAppState)]; timer != nullptr; timer = timer->mNextInBucket)
+    {
+        if (timer->mOnComplete == aOnComplete && timer->AppState == aAppState && (match == nullptr || IsEarlier(timer, match)))
+        {
+            match = timer;
+        }
+    }
+    VerifyOrReturnError(match != nullptr, nullptr);
+
+    RemoveAt(match->mHeapIndex);
+    return match;
+}
+
+Timer * Timer::Heap::PopEarliest()
+{
+    Timer * earliest = Earliest();
+    if (earliest != nullptr)
+    {
+        RemoveAt(0);
+    }
+    return earliest;
+}
+
+Timer * Timer::Heap::PopIfEarlier(Clock::MonotonicMilliseconds t)
+{
+    Timer * earliest = Earliest();
+    if ((earliest == nullptr) || !Clock::IsEarlier(earliest->mAwakenTime, t))
+    {
+        return nullptr;
+    }
+    RemoveAt(0);
+    return earliest;
+}
+
+Timer * Timer::Heap::ExtractEarlier(Clock::MonotonicMilliseconds t)
+{
+    Timer * begin = nullptr;
+    Timer * end   = nullptr;
+    Timer * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        if (end == nullptr)
+        {
+            begin = timer;
+        }
+        else
+        {
+            end->mNextTimer = timer;
+        }
+        end = timer;
+    }
+    return begin;
+}
+
 CHIP_ERROR Timer::MutexedList::Init()
 {
-    mHead = nullptr;
+    Queue::Reset();
 #if CHIP_SYSTEM_CONFIG_NO_LOCKING
     return CHIP_NO_ERROR;
 #else  // CHIP_SYSTEM_CONFIG_NO_LOCKING
@@ -45,6 +45,9 @@
 
 #if CHIP_SYSTEM_CONFIG_USE_TIMER_POOL
 #include <mutex>
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#include <vector>
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 #endif // CHIP_SYSTEM_CONFIG_USE_TIMER_POOL
 
 namespace chip {
@@ -120,17 +123,123 @@ public:
          */
         Timer * Earliest() const { return mHead; }
 
+        /**
+         * Empty the list, without touching the timers it held.
+         */
+        void Reset() { mHead = nullptr; }
+
     protected:
         Timer * mHead;
         List(const List &) = delete;
         List & operator=(const List &) = delete;
     };
+
     /**
-     * List of timers ordered by completion time.
+     * Priority queue of timers ordered by completion time, with the same interface as Timer::List.
+     *
+     * Timers are kept in an indexed 4-ary min-heap, each Timer recording its own position so that it can be removed
+     * without a search, and in an intrusive hash index keyed by (onComplete, appState) so that cancellation by callback
+     * does not scan the queue. Add() and Remove() are O(log n); Earliest() is O(1). Timers with equal completion times
+     * fire in the order in which they were added, as with Timer::List.
+     */
+    class Heap
+    {
+    public:
+        Heap() { Reset(); }
+
+        /**
+         * Add a timer to the queue
+         *
+         * @return  The new earliest timer in the queue. If this is the newly added timer, that implies it is earlier
+         *          than any existing timer.
+         */
+        Timer * Add(Timer * add);
+
+        /**
+         * Remove the given timer from the queue, if present. It is not an error for the timer not to be present.
+         *
+         * @return  The new earliest timer in the queue, or nullptr if the queue is empty.
+         */
+        Timer * Remove(Timer * remove);
+
+        /**
+         * Remove the first timer with the given properties, if present. It is not an error for no such timer to be present.
+         *
+         * @return  The removed timer, or nullptr if the queue contains no matching timer.
+         */
+        Timer * Remove(TimerCompleteCallback onComplete, void * appState);
+
+        /**
+         * Remove and return the earliest timer in the queue.
+         *
+         * @return  The earliest timer, or nullptr if the queue is empty.
+         */
+        Timer * PopEarliest();
+
+        /**
+         * Remove and return the earliest timer in the queue, provided it expires earlier than the given time @a t.
+         *
+         * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+         */
+        Timer * PopIfEarlier(Clock::MonotonicMilliseconds t);
+
+        /**
+         * Remove and return all timers that expire before the given time @a t.
+         *
+         * @return  An ordered linked list (by `mNextTimer`) of all timers that expire before @a t, or nullptr if there are none.
+         */
+        Timer * ExtractEarlier(Clock::MonotonicMilliseconds t);
+
+        /**
+         * Get the earliest timer in the queue.
+         */
+        Timer * Earliest() const { return (mCount > 0) ? mNodes[0] : nullptr; }
+
+        /**
+         * Empty the queue, without touching the timers it held.
+         */
+        void Reset();
+
+    protected:
+        static constexpr size_t kArity       = 4;
+        static constexpr size_t kHashBuckets = CHIP_SYSTEM_CONFIG_TIMER_HASH_BUCKETS;
+        static_assert((kHashBuckets & (kHashBuckets - 1)) == 0, "CHIP_SYSTEM_CONFIG_TIMER_HASH_BUCKETS must be a power of two");
+
+        static bool IsEarlier(const Timer * first, const Timer * second);
+        static size_t HashBucket(TimerCompleteCallback onComplete, void * appState);
+
+        void SiftUp(size_t index);
+        void SiftDown(size_t index);
+        void Place(Timer * timer, size_t index);
+        void RemoveAt(size_t index);
+        void HashInsert(Timer * timer);
+        void HashRemove(Timer * timer);
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        std::vector<Timer *> mNodes;
+#else
+        Timer * mNodes[CHIP_SYSTEM_CONFIG_NUM_TIMERS];
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        size_t mCount;
+        uint32_t mNextSequence;
+        Timer * mBuckets[kHashBuckets];
+
+        Heap(const Heap &) = delete;
+        Heap & operator=(const Heap &) = delete;
+    };
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    using Queue = Heap;
+#else
+    using Queue = List;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    /**
+     * Queue of timers ordered by completion time.
      *
-     * This extends Timer::List to lock all access to the list.
+     * This extends Timer::Queue (a Timer::List or Timer::Heap, per CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP) to lock all access
+     * to the queue.
      */
-    class MutexedList : private List
+    class MutexedList : private Queue
     {
     public:
         MutexedList() = default;
@@ -138,42 +247,42 @@ public:
         bool Empty() const
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return mHead == nullptr;
+            return Queue::Earliest() == nullptr;
         }
         Timer * Add(Timer * add)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::Add(add);
+            return Queue::Add(add);
         }
         Timer * Remove(Timer * remove)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::Remove(remove);
+            return Queue::Remove(remove);
         }
         Timer * Remove(TimerCompleteCallback onComplete, void * appState)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::Remove(onComplete, appState);
+            return Queue::Remove(onComplete, appState);
         }
         Timer * PopEarliest()
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::PopEarliest();
+            return Queue::PopEarliest();
         }
         Timer * PopIfEarlier(Clock::MonotonicMilliseconds t)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::PopIfEarlier(t);
+            return Queue::PopIfEarlier(t);
         }
         Timer * ExtractEarlier(Clock::MonotonicMilliseconds t)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::ExtractEarlier(t);
+            return Queue::ExtractEarlier(t);
         }
         Timer * Earliest() const
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return mHead;
+            return Queue::Earliest();
         }
 
     private:
@@ -227,6 +336,11 @@ private:
     Clock::MonotonicMilliseconds mAwakenTime;
     Timer * mNextTimer;
 
+    // State used while the timer is held in a Timer::Heap.
+    size_t mHeapIndex;
+    uint32_t mHeapSequence;
+    Timer * mNextInBucket;
+
     Layer * mSystemLayer;
 
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
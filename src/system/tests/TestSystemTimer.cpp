@@ -168,6 +168,69 @@ static void CheckStarvation(nlTestSuite * inSuite, void * aContext)
     ServiceEvents(lSys);
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_POOL
+
+void HandleQueuedTimer(Layer * aLayer, void * aState) {}
+
+template <class Queue>
+static void CheckTimerQueue(nlTestSuite * inSuite, Layer & aLayer)
+{
+    static const uint32_t kDelays[] = { 50, 10, 30, 10, 40, 20, 60, 0 };
+    constexpr size_t kNumTimers     = sizeof(kDelays) / sizeof(kDelays[0]);
+    static_assert(kNumTimers <= CHIP_SYSTEM_CONFIG_NUM_TIMERS, "Test needs more timers than the pool provides");
+
+    int tokens[kNumTimers];
+    Timer * timers[kNumTimers];
+    Queue queue;
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i] = Timer::New(aLayer, kDelays[i], HandleQueuedTimer, &tokens[i]);
+        NL_TEST_ASSERT(inSuite, timers[i] != nullptr);
+        queue.Add(timers[i]);
+    }
+    const Clock::MonotonicMilliseconds base = Clock::GetMonotonicMilliseconds();
+
+    NL_TEST_ASSERT(inSuite, queue.Earliest() == timers[7]);
+
+    // Cancellation by callback and state, and by timer.
+    NL_TEST_ASSERT(inSuite, queue.Remove(HandleQueuedTimer, &tokens[1]) == timers[1]);
+    NL_TEST_ASSERT(inSuite, queue.Remove(HandleQueuedTimer, &tokens[1]) == nullptr);
+    NL_TEST_ASSERT(inSuite, queue.Remove(timers[4]) == timers[7]);
+
+    // Expired timers come out in completion order; those with equal times in insertion order.
+    Timer::List expired(queue.ExtractEarlier(base + 35));
+    NL_TEST_ASSERT(inSuite, expired.PopEarliest() == timers[7]);
+    NL_TEST_ASSERT(inSuite, expired.PopEarliest() == timers[3]);
+    NL_TEST_ASSERT(inSuite, expired.PopEarliest() == timers[5]);
+    NL_TEST_ASSERT(inSuite, expired.PopEarliest() == timers[2]);
+    NL_TEST_ASSERT(inSuite, expired.PopEarliest() == nullptr);
+
+    NL_TEST_ASSERT(inSuite, queue.PopIfEarlier(base + 35) == nullptr);
+    NL_TEST_ASSERT(inSuite, queue.PopEarliest() == timers[0]);
+    NL_TEST_ASSERT(inSuite, queue.PopEarliest() == timers[6]);
+    NL_TEST_ASSERT(inSuite, queue.PopEarliest() == nullptr);
+    NL_TEST_ASSERT(inSuite, queue.Earliest() == nullptr);
+
+    for (Timer * timer : timers)
+    {
+        timer->Clear();
+        timer->Release();
+    }
+}
+
+static void CheckTimerList(nlTestSuite * inSuite, void * aContext)
+{
+    CheckTimerQueue<Timer::List>(inSuite, *static_cast<TestContext *>(aContext)->mLayer);
+}
+
+static void CheckTimerHeap(nlTestSuite * inSuite, void * aContext)
+{
+    CheckTimerQueue<Timer::Heap>(inSuite, *static_cast<TestContext *>(aContext)->mLayer);
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_POOL
+
 // Test Suite
 
 /**
@@ -178,6 +241,10 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("Timer::TestOverflow",             CheckOverflow),
     NL_TEST_DEF("Timer::TestTimerStarvation",      CheckStarvation),
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_POOL
+    NL_TEST_DEF("Timer::TestTimerList",            CheckTimerList),
+    NL_TEST_DEF("Timer::TestTimerHeap",            CheckTimerHeap),
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_POOL
     NL_TEST_SENTINEL()
 };
 // clang-format on
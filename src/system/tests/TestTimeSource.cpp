@@ -29,8 +29,10 @@
 
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ErrorStr.h>
+#include <lib/support/TimeUtils.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
+#include <system/SystemClock.h>
 #include <system/TimeSource.h>
 
 namespace {
@@ -63,6 +65,32 @@ void SystemTimeSourceGet(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void SystemTimeSourceUnits(nlTestSuite * inSuite, void * inContext)
+{
+    class MockClock : public chip::System::ClockBase
+    {
+    public:
+        MonotonicMicroseconds GetMonotonicMicroseconds() override { return mTime * chip::kMicrosecondsPerMillisecond; }
+        MonotonicMilliseconds GetMonotonicMilliseconds() override { return mTime; }
+        MonotonicMilliseconds mTime = 0;
+    };
+    MockClock clock;
+
+    chip::System::ClockBase * savedRealClock = chip::System::Internal::gClockBase;
+    chip::System::Internal::gClockBase       = &clock;
+
+    chip::Time::TimeSource<chip::Time::Source::kSystem> source;
+
+    // the system time source counts milliseconds, as the durations its users add to it do
+    clock.mTime = 1234;
+    NL_TEST_ASSERT(inSuite, source.GetCurrentMonotonicTimeMs() == 1234);
+
+    clock.mTime += 1000;
+    NL_TEST_ASSERT(inSuite, source.GetCurrentMonotonicTimeMs() == 2234);
+
+    chip::System::Internal::gClockBase = savedRealClock;
+}
+
 } // namespace
 
 /**
@@ -73,6 +101,7 @@ static const nlTest sTests[] =
 {
     NL_TEST_DEF("TimeSource<Test>::SetAndGet", TestTimeSourceSetAndGet),
     NL_TEST_DEF("TimeSource<System>::SetAndGet", SystemTimeSourceGet),
+    NL_TEST_DEF("TimeSource<System>::Units", SystemTimeSourceUnits),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -56,6 +56,54 @@ using HKDF_sha_crypto = HKDF_sha;
 
 CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
+CryptoContext::~CryptoContext()
+{
+    ClearSecretData(&mKeys[0][0], sizeof(mKeys));
+}
+
+CryptoContext::CryptoContext(const CryptoContext & other) : CryptoContext()
+{
+    *this = other;
+}
+
+CryptoContext & CryptoContext::operator=(const CryptoContext & other)
+{
+    if (this != &other)
+    {
+        mSessionRole  = other.mSessionRole;
+        mKeyAvailable = other.mKeyAvailable;
+        memcpy(mKeys, other.mKeys, sizeof(mKeys));
+
+        mEncryptionCipher.Clear();
+        mDecryptionCipher.Clear();
+        if (mKeyAvailable)
+        {
+            InitCachedCiphers();
+        }
+    }
+
+    return *this;
+}
+
+void CryptoContext::InitCachedCiphers()
+{
+    const size_t taglen = MessageAuthenticationCode::TagLenForSessionType(Header::SessionType::kAESCCMTagLen16);
+
+    // See Encrypt() and Decrypt() for which key protects each direction.
+    const KeyUsage sendKey    = (mSessionRole == SessionRole::kInitiator) ? kI2RKey : kR2IKey;
+    const KeyUsage receiveKey = (mSessionRole == SessionRole::kInitiator) ? kR2IKey : kI2RKey;
+
+    // Failing to set up a cached cipher is not fatal, the message path then keys a cipher per call.
+    if (mEncryptionCipher.Init(AES_CCM_Cipher::Direction::kEncrypt, mKeys[sendKey], kAES_CCM128_Key_Length, kAESCCMIVLen,
+                               taglen) != CHIP_NO_ERROR ||
+        mDecryptionCipher.Init(AES_CCM_Cipher::Direction::kDecrypt, mKeys[receiveKey], kAES_CCM128_Key_Length, kAESCCMIVLen,
+                               taglen) != CHIP_NO_ERROR)
+    {
+        mEncryptionCipher.Clear();
+        mDecryptionCipher.Clear();
+    }
+}
+
 CHIP_ERROR CryptoContext::InitFromSecret(const ByteSpan & secret, const ByteSpan & salt, SessionInfoType infoType, SessionRole role)
 {
     HKDF_sha_crypto mHKDF;
@@ -79,6 +127,8 @@ CHIP_ERROR CryptoContext::InitFromSecret(const ByteSpan & secret, const ByteSpan
     mKeyAvailable = true;
     mSessionRole  = role;
 
+    InitCachedCiphers();
+
     return CHIP_NO_ERROR;
 }
 
@@ -155,8 +205,17 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
         usage = kI2RKey;
     }
 
-    ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mKeys[usage], kAES_CCM128_Key_Length, IV, sizeof(IV),
-                                         output, tag, taglen));
+    // The cached cipher is only keyed for the session type it was set up with, see InitCachedCiphers().
+    if (mEncryptionCipher.IsInitialized() && sessionType == Header::SessionType::kAESCCMTagLen16 &&
+        mEncryptionCipher.GetTagLength() == taglen)
+    {
+        ReturnErrorOnFailure(mEncryptionCipher.Encrypt(input, input_length, AAD, aadLen, IV, sizeof(IV), output, tag, taglen));
+    }
+    else
+    {
+        ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mKeys[usage], kAES_CCM128_Key_Length, IV,
+                                             sizeof(IV), output, tag, taglen));
+    }
 
     mac.SetTag(&header, sessionType, tag, taglen);
 
@@ -190,6 +249,12 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
         usage = kR2IKey;
     }
 
+    if (mDecryptionCipher.IsInitialized() && header.GetSessionType() == Header::SessionType::kAESCCMTagLen16 &&
+        mDecryptionCipher.GetTagLength() == taglen)
+    {
+        return mDecryptionCipher.Decrypt(input, input_length, AAD, aadLen, tag, taglen, IV, sizeof(IV), output);
+    }
+
     return AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mKeys[usage], kAES_CCM128_Key_Length, IV, sizeof(IV),
                            output);
 }
@@ -36,10 +36,11 @@ class DLL_EXPORT CryptoContext
 {
 public:
     CryptoContext();
-    CryptoContext(CryptoContext &&)      = default;
-    CryptoContext(const CryptoContext &) = default;
-    CryptoContext & operator=(const CryptoContext &) = default;
-    CryptoContext & operator=(CryptoContext &&) = default;
+    ~CryptoContext();
+
+    // Copies re-key their own cached ciphers, since cipher state cannot be shared.
+    CryptoContext(const CryptoContext & other);
+    CryptoContext & operator=(const CryptoContext & other);
 
     /**
      *    Whether the current node initiated the session, or it is responded to a session request.
@@ -140,6 +141,13 @@ private:
     bool mKeyAvailable;
     CryptoKey mKeys[KeyUsage::kNumCryptoKeys];
 
+    // Pre-keyed ciphers for the send and receive keys, so that per-message work is limited to the
+    // nonce, AAD and payload. When they are not initialized, Encrypt/Decrypt key a cipher per call.
+    mutable Crypto::AES_CCM_Cipher mEncryptionCipher;
+    mutable Crypto::AES_CCM_Cipher mDecryptionCipher;
+
+    void InitCachedCiphers();
+
     static CHIP_ERROR GetIV(const PacketHeader & header, uint8_t * iv, size_t len);
 
     // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
@@ -17,7 +17,10 @@
 #pragma once
 
 #include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/IntegerHash.h>
+#include <lib/support/Pool.h>
 #include <system/TimeSource.h>
 #include <transport/FabricTable.h>
 #include <transport/SecureSession.h>
@@ -36,11 +39,22 @@ constexpr const uint16_t kAnyKeyId = 0xffff;
  * Intended for:
  *   - handle connection active time and expiration
  *   - allocate and free space for connection states.
+ *
+ * When kUseHeap is set, states are allocated from the heap and kMaxConnectionCount only sizes the pool chunks; otherwise at
+ * most kMaxConnectionCount states can exist at once.
  */
-template <size_t kMaxConnectionCount, Time::Source kTimeSource = Time::Source::kSystem>
+template <size_t kMaxConnectionCount, Time::Source kTimeSource = Time::Source::kSystem, bool kUseHeap = false>
 class SecureSessionTable
 {
 public:
+    ~SecureSessionTable()
+    {
+        mStates.ForEachActiveObject([&](Entry * entry) {
+            mStates.ReleaseObject(entry);
+            return true;
+        });
+    }
+
     /**
      * Allocates a new peer connection state state object out of the internal resource pool.
      *
@@ -55,31 +69,12 @@ public:
     CHECK_RETURN_VALUE
     CHIP_ERROR CreateNewPeerConnectionState(const PeerAddress & address, SecureSession ** state)
     {
-        CHIP_ERROR err = CHIP_ERROR_NO_MEMORY;
-
         if (state)
         {
             *state = nullptr;
         }
 
-        for (size_t i = 0; i < kMaxConnectionCount; i++)
-        {
-            if (!mStates[i].IsInitialized())
-            {
-                mStates[i] = SecureSession(address);
-                mStates[i].SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
-
-                if (state)
-                {
-                    *state = &mStates[i];
-                }
-
-                err = CHIP_NO_ERROR;
-                break;
-            }
-        }
-
-        return err;
+        return AddNewState(mStates.CreateObject(address), state);
     }
 
     /**
@@ -99,38 +94,47 @@ public:
     CHIP_ERROR CreateNewPeerConnectionState(const Optional<NodeId> & peerNode, uint16_t peerSessionId, uint16_t localSessionId,
                                             SecureSession ** state)
     {
-        CHIP_ERROR err = CHIP_ERROR_NO_MEMORY;
+        return CreateNewPeerConnectionState(peerNode, peerSessionId, localSessionId, kUndefinedFabricIndex, state);
+    }
 
+    /**
+     * Allocates a new peer connection state state object out of the internal resource pool.
+     *
+     * @param peerNode represents optional peer Node's ID
+     * @param peerSessionId represents the encryption key ID assigned by peer node
+     * @param localSessionId represents the encryption key ID assigned by local node
+     * @param fabric represents the fabric the peer node belongs to
+     * @param state [out] will contain the connection state if one was available. May be null if no return value is desired.
+     *
+     * @note the newly created state will have an 'active' time set based on the current time source.
+     *
+     * @returns CHIP_NO_ERROR if state could be initialized. May fail if maximum connection count
+     *          has been reached (with CHIP_ERROR_NO_MEMORY).
+     */
+    CHECK_RETURN_VALUE
+    CHIP_ERROR CreateNewPeerConnectionState(const Optional<NodeId> & peerNode, uint16_t peerSessionId, uint16_t localSessionId,
+                                            FabricIndex fabric, SecureSession ** state)
+    {
         if (state)
         {
             *state = nullptr;
         }
 
-        for (size_t i = 0; i < kMaxConnectionCount; i++)
+        Entry * entry = mStates.CreateObject();
+        if (entry != nullptr)
         {
-            if (!mStates[i].IsInitialized())
-            {
-                mStates[i] = SecureSession();
-                mStates[i].SetPeerSessionId(peerSessionId);
-                mStates[i].SetLocalSessionId(localSessionId);
-                mStates[i].SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
-
-                if (peerNode.ValueOr(kUndefinedNodeId) != kUndefinedNodeId)
-                {
-                    mStates[i].SetPeerNodeId(peerNode.Value());
-                }
-
-                if (state)
-                {
-                    *state = &mStates[i];
-                }
+            entry->SetPeerSessionId(peerSessionId);
+            entry->SetLocalSessionId(localSessionId);
 
-                err = CHIP_NO_ERROR;
-                break;
+            if (peerNode.ValueOr(kUndefinedNodeId) != kUndefinedNodeId)
+            {
+                entry->SetPeerNodeId(peerNode.Value());
             }
+
+            entry->SetFabricIndex(fabric);
         }
 
-        return err;
+        return AddNewState(entry, state);
     }
 
     /**
@@ -144,23 +148,7 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionState(const PeerAddress & address, SecureSession * begin)
     {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (iter->GetPeerAddress() == address)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
+        return FindNextState(begin, [&address](SecureSession & candidate) { return candidate.GetPeerAddress() == address; });
     }
 
     /**
@@ -175,27 +163,9 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionState(NodeId nodeId, SecureSession * begin)
     {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (iter->GetPeerNodeId() == nodeId)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
+        return FindNextState(begin, [nodeId](SecureSession & candidate) {
+            return candidate.IsInitialized() && candidate.GetPeerNodeId() == nodeId;
+        });
     }
 
     /**
@@ -211,31 +181,10 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionState(Optional<NodeId> nodeId, uint16_t peerSessionId, SecureSession * begin)
     {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (peerSessionId == kAnyKeyId || iter->GetPeerSessionId() == peerSessionId)
-            {
-                if (nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || iter->GetPeerNodeId() == kUndefinedNodeId ||
-                    iter->GetPeerNodeId() == nodeId.Value())
-                {
-                    state = iter;
-                    break;
-                }
-            }
-        }
-        return state;
+        return FindNextState(begin, [nodeId, peerSessionId](SecureSession & candidate) {
+            return candidate.IsInitialized() && (peerSessionId == kAnyKeyId || candidate.GetPeerSessionId() == peerSessionId) &&
+                MatchesPeerNode(candidate, nodeId);
+        });
     }
 
     /**
@@ -249,30 +198,16 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionState(uint16_t keyId, SecureSession * begin)
     {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        VerifyOrDie(begin == nullptr || (begin >= iter && begin < &mStates[kMaxConnectionCount]));
+        auto matches = [keyId](SecureSession & candidate) {
+            return candidate.IsInitialized() && candidate.GetLocalSessionId() == keyId;
+        };
 
-        if (begin != nullptr)
+        if (begin == nullptr)
         {
-            iter = begin + 1;
+            return FindIndexedState(mLocalSessionIdIndex, HashLocalSessionId(keyId), matches);
         }
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-
-            if (iter->GetLocalSessionId() == keyId)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
+        return FindNextState(begin, matches);
     }
 
     /**
@@ -288,31 +223,33 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionStateByLocalKey(Optional<NodeId> nodeId, uint16_t localSessionId, SecureSession * begin)
     {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
+        auto matches = [nodeId, localSessionId](SecureSession & candidate) {
+            return candidate.IsInitialized() && candidate.GetLocalSessionId() == localSessionId &&
+                MatchesPeerNode(candidate, nodeId);
+        };
 
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
+        if (begin == nullptr)
         {
-            iter = begin + 1;
+            return FindIndexedState(mLocalSessionIdIndex, HashLocalSessionId(localSessionId), matches);
         }
 
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (iter->GetLocalSessionId() == localSessionId)
-            {
-                if (nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || iter->GetPeerNodeId() == kUndefinedNodeId ||
-                    iter->GetPeerNodeId() == nodeId.Value())
-                {
-                    state = iter;
-                    break;
-                }
-            }
-        }
-        return state;
+        return FindNextState(begin, matches);
+    }
+
+    /**
+     * Get the first peer connection state that matches the given fabric index and peer Node Id.
+     *
+     * @param fabric The fabric index to match
+     * @param nodeId The peer Node Id to match
+     *
+     * @return the state found, nullptr if not found
+     */
+    CHECK_RETURN_VALUE
+    SecureSession * FindPeerConnectionStateByNode(FabricIndex fabric, NodeId nodeId)
+    {
+        return FindIndexedState(mPeerNodeIndex, HashPeerNode(fabric, nodeId), [fabric, nodeId](SecureSession & candidate) {
+            return candidate.IsInitialized() && candidate.GetFabricIndex() == fabric && candidate.GetPeerNodeId() == nodeId;
+        });
     }
 
     /**
@@ -325,18 +262,9 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionStateByFabric(FabricIndex fabric)
     {
-        for (auto & state : mStates)
-        {
-            if (!state.IsInitialized())
-            {
-                continue;
-            }
-            if (state.GetFabricIndex() == fabric)
-            {
-                return &state;
-            }
-        }
-        return nullptr;
+        return FindNextState(nullptr, [fabric](SecureSession & candidate) {
+            return candidate.IsInitialized() && candidate.GetFabricIndex() == fabric;
+        });
     }
 
     /// Convenience method to mark a peer connection state as active
@@ -347,7 +275,11 @@ public:
     void MarkConnectionExpired(SecureSession * state, Callback callback)
     {
         callback(*state);
-        *state = SecureSession(PeerAddress::Uninitialized());
+
+        Entry * entry = static_cast<Entry *>(state);
+        mLocalSessionIdIndex.Remove(entry->mLocalSessionIdHash, entry);
+        mPeerNodeIndex.Remove(entry->mPeerNodeHash, entry);
+        mStates.ReleaseObject(entry);
     }
 
     /**
@@ -361,29 +293,265 @@ public:
     {
         const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
 
-        for (size_t i = 0; i < kMaxConnectionCount; i++)
-        {
-            if (!mStates[i].GetPeerAddress().IsInitialized())
+        mStates.ForEachActiveObject([&](Entry * entry) {
+            if (!entry->GetPeerAddress().IsInitialized())
             {
-                continue; // not an active connection
+                return true; // not an active connection
             }
 
-            uint64_t connectionActiveTime = mStates[i].GetLastActivityTimeMs();
+            uint64_t connectionActiveTime = entry->GetLastActivityTimeMs();
             if (connectionActiveTime + maxIdleTimeMs >= currentTime)
             {
-                continue; // not expired
+                return true; // not expired
             }
 
-            MarkConnectionExpired(&mStates[i], callback);
-        }
+            MarkConnectionExpired(entry, callback);
+            return true;
+        });
     }
 
     /// Allows access to the underlying time source used for keeping track of connection active time
     Time::TimeSource<kTimeSource> & GetTimeSource() { return mTimeSource; }
 
 private:
+    /// A pooled session, along with the keys it was indexed under so that it can be removed even after being modified.
+    class Entry : public SecureSession
+    {
+    public:
+        using SecureSession::SecureSession;
+
+        uint32_t mLocalSessionIdHash = 0;
+        uint32_t mPeerNodeHash       = 0;
+    };
+
+    /**
+     * Open-addressing hash index from a session key to the pooled sessions with that key.
+     *
+     * Entries are placed by linear probing and removed by shifting later entries of the same probe run back, so lookups stop
+     * at the first empty bucket. Different keys may share a hash; callers confirm each candidate against the session itself.
+     * With a bounded pool the buckets are a fixed array; with a heap pool they are heap allocated and doubled as needed.
+     */
+    class SessionIndex
+    {
+    public:
+        ~SessionIndex()
+        {
+            if (kUseHeap)
+            {
+                Platform::MemoryFree(mHeapBuckets);
+            }
+        }
+
+        CHECK_RETURN_VALUE
+        CHIP_ERROR Insert(uint32_t hash, Entry * entry)
+        {
+            // Keep at most half of the buckets in use, which keeps probe runs short.
+            if (2 * (mCount + 1) > mBucketCount)
+            {
+                ReturnErrorOnFailure(Grow());
+            }
+
+            Place(hash, entry);
+            mCount++;
+            return CHIP_NO_ERROR;
+        }
+
+        void Remove(uint32_t hash, Entry * entry)
+        {
+            VerifyOrReturn(mCount > 0);
+
+            Bucket * buckets  = Buckets();
+            const size_t mask = mBucketCount - 1;
+            size_t bucket     = hash & mask;
+            while (buckets[bucket].mEntry != entry)
+            {
+                VerifyOrReturn(buckets[bucket].mEntry != nullptr);
+                bucket = (bucket + 1) & mask;
+            }
+
+            // Move back any following entry whose home bucket is not between the hole and its current position.
+            size_t hole = bucket;
+            for (size_t next = (hole + 1) & mask; buckets[next].mEntry != nullptr; next = (next + 1) & mask)
+            {
+                const size_t home = buckets[next].mHash & mask;
+                if (((next - home) & mask) >= ((next - hole) & mask))
+                {
+                    buckets[hole] = buckets[next];
+                    hole          = next;
+                }
+            }
+            buckets[hole].mEntry = nullptr;
+            mCount--;
+        }
+
+        /// Calls function(entry) for every entry indexed under the given hash.
+        template <typename Function>
+        void ForEachEntry(uint32_t hash, Function function) const
+        {
+            VerifyOrReturn(mCount > 0);
+
+            const Bucket * buckets = Buckets();
+            const size_t mask      = mBucketCount - 1;
+            for (size_t bucket = hash & mask; buckets[bucket].mEntry != nullptr; bucket = (bucket + 1) & mask)
+            {
+                if (buckets[bucket].mHash == hash)
+                {
+                    function(buckets[bucket].mEntry);
+                }
+            }
+        }
+
+    private:
+        struct Bucket
+        {
+            Entry * mEntry;
+            uint32_t mHash;
+        };
+
+        static constexpr size_t RoundUpToPowerOfTwo(size_t value, size_t power = 1)
+        {
+            return power >= value ? power : RoundUpToPowerOfTwo(value, power * 2);
+        }
+
+        static constexpr size_t kStaticBucketCount      = kUseHeap ? 1 : RoundUpToPowerOfTwo(2 * kMaxConnectionCount);
+        static constexpr size_t kInitialHeapBucketCount = RoundUpToPowerOfTwo(2 * kMaxConnectionCount);
+
+        Bucket * Buckets() { return kUseHeap ? mHeapBuckets : mStaticBuckets; }
+        const Bucket * Buckets() const { return kUseHeap ? mHeapBuckets : mStaticBuckets; }
+
+        void Place(uint32_t hash, Entry * entry)
+        {
+            Bucket * buckets  = Buckets();
+            const size_t mask = mBucketCount - 1;
+            size_t bucket     = hash & mask;
+            while (buckets[bucket].mEntry != nullptr)
+            {
+                bucket = (bucket + 1) & mask;
+            }
+            buckets[bucket].mEntry = entry;
+            buckets[bucket].mHash  = hash;
+        }
+
+        CHIP_ERROR Grow()
+        {
+            // A bounded pool never holds more sessions than its fixed buckets were sized for.
+            VerifyOrReturnError(kUseHeap, CHIP_ERROR_NO_MEMORY);
+
+            const size_t newBucketCount = (mBucketCount == 0) ? kInitialHeapBucketCount : 2 * mBucketCount;
+            Bucket * newBuckets         = static_cast<Bucket *>(Platform::MemoryCalloc(newBucketCount, sizeof(Bucket)));
+            VerifyOrReturnError(newBuckets != nullptr, CHIP_ERROR_NO_MEMORY);
+
+            Bucket * oldBuckets         = mHeapBuckets;
+            const size_t oldBucketCount = mBucketCount;
+            mHeapBuckets                = newBuckets;
+            mBucketCount                = newBucketCount;
+
+            for (size_t i = 0; i < oldBucketCount; i++)
+            {
+                if (oldBuckets[i].mEntry != nullptr)
+                {
+                    Place(oldBuckets[i].mHash, oldBuckets[i].mEntry);
+                }
+            }
+            Platform::MemoryFree(oldBuckets);
+            return CHIP_NO_ERROR;
+        }
+
+        Bucket mStaticBuckets[kStaticBucketCount] = {};
+        Bucket * mHeapBuckets                     = nullptr;
+        size_t mBucketCount                       = kUseHeap ? 0 : kStaticBucketCount;
+        size_t mCount                             = 0;
+    };
+
+    static uint32_t HashLocalSessionId(uint16_t localSessionId) { return IntegerHash(localSessionId); }
+
+    static uint32_t HashPeerNode(FabricIndex fabric, NodeId nodeId)
+    {
+        const uint64_t hash = (nodeId ^ (static_cast<uint64_t>(fabric) << 56)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<uint32_t>(hash >> 32);
+    }
+
+    static bool MatchesPeerNode(SecureSession & candidate, const Optional<NodeId> & nodeId)
+    {
+        return nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || candidate.GetPeerNodeId() == kUndefinedNodeId ||
+            candidate.GetPeerNodeId() == nodeId.Value();
+    }
+
+    /// Stamps and indexes a freshly allocated entry, releasing it again if it cannot be indexed.
+    CHIP_ERROR AddNewState(Entry * entry, SecureSession ** state)
+    {
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        entry->SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
+        entry->mLocalSessionIdHash = HashLocalSessionId(entry->GetLocalSessionId());
+        entry->mPeerNodeHash       = HashPeerNode(entry->GetFabricIndex(), entry->GetPeerNodeId());
+
+        CHIP_ERROR err = mLocalSessionIdIndex.Insert(entry->mLocalSessionIdHash, entry);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = mPeerNodeIndex.Insert(entry->mPeerNodeHash, entry);
+            if (err != CHIP_NO_ERROR)
+            {
+                mLocalSessionIdIndex.Remove(entry->mLocalSessionIdHash, entry);
+            }
+        }
+
+        if (err != CHIP_NO_ERROR)
+        {
+            mStates.ReleaseObject(entry);
+            return err;
+        }
+
+        if (state)
+        {
+            *state = entry;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /// Returns the first pooled state after begin (or from the start when begin is nullptr) that satisfies the predicate.
+    template <typename Predicate>
+    SecureSession * FindNextState(SecureSession * begin, Predicate matches)
+    {
+        SecureSession * state = nullptr;
+        bool searching        = (begin == nullptr);
+        mStates.ForEachActiveObject([&](Entry * entry) {
+            if (searching && matches(*entry))
+            {
+                state = entry;
+                return false;
+            }
+            if (entry == begin)
+            {
+                searching = true;
+            }
+            return true;
+        });
+        return state;
+    }
+
+    /// Returns the lowest addressed state indexed under the given hash that satisfies the predicate, so that the result does not
+    /// depend on the order of the index buckets.
+    template <typename Predicate>
+    SecureSession * FindIndexedState(const SessionIndex & index, uint32_t hash, Predicate matches)
+    {
+        SecureSession * state = nullptr;
+        index.ForEachEntry(hash, [&](Entry * candidate) {
+            if ((state == nullptr || candidate < state) && matches(*candidate))
+            {
+                state = candidate;
+            }
+        });
+        return state;
+    }
+
     Time::TimeSource<kTimeSource> mTimeSource;
-    SecureSession mStates[kMaxConnectionCount];
+    BitMapOrHeapObjectPool<Entry, kMaxConnectionCount, kUseHeap> mStates;
+
+    // Secondary indices over mStates, maintained when a state is created or expired. Lookups through them assume that a
+    // session's local session id, fabric and peer node id are not changed after it is created.
+    SessionIndex mLocalSessionIdIndex;
+    SessionIndex mPeerNodeIndex;
 };
 
 } // namespace Transport
@@ -226,19 +226,12 @@ void SessionManager::ExpirePairing(SessionHandle session)
 
 void SessionManager::ExpireAllPairings(NodeId peerNodeId, FabricIndex fabric)
 {
-    SecureSession * state = mPeerConnections.FindPeerConnectionState(peerNodeId, nullptr);
+    SecureSession * state = mPeerConnections.FindPeerConnectionStateByNode(fabric, peerNodeId);
     while (state != nullptr)
     {
-        if (fabric == state->GetFabricIndex())
-        {
-            mPeerConnections.MarkConnectionExpired(
-                state, [this](const Transport::SecureSession & state1) { HandleConnectionExpired(state1); });
-            state = mPeerConnections.FindPeerConnectionState(peerNodeId, nullptr);
-        }
-        else
-        {
-            state = mPeerConnections.FindPeerConnectionState(peerNodeId, state);
-        }
+        mPeerConnections.MarkConnectionExpired(
+            state, [this](const Transport::SecureSession & state1) { HandleConnectionExpired(state1); });
+        state = mPeerConnections.FindPeerConnectionStateByNode(fabric, peerNodeId);
     }
 }
 
@@ -272,12 +265,10 @@ CHIP_ERROR SessionManager::NewPairing(const Optional<Transport::PeerAddress> & p
     ChipLogDetail(Inet, "New secure session created for device 0x" ChipLogFormatX64 ", key %d!!", ChipLogValueX64(peerNodeId),
                   peerSessionId);
     state = nullptr;
-    ReturnErrorOnFailure(
-        mPeerConnections.CreateNewPeerConnectionState(Optional<NodeId>::Value(peerNodeId), peerSessionId, localSessionId, &state));
+    ReturnErrorOnFailure(mPeerConnections.CreateNewPeerConnectionState(Optional<NodeId>::Value(peerNodeId), peerSessionId,
+                                                                       localSessionId, fabric, &state));
     ReturnErrorCodeIf(state == nullptr, CHIP_ERROR_NO_MEMORY);
 
-    state->SetFabricIndex(fabric);
-
     if (peerAddr.HasValue() && peerAddr.Value().GetIPAddress() != Inet::IPAddress::Any)
     {
         state->SetPeerAddress(peerAddr.Value());
@@ -291,7 +291,9 @@ private:
 
     System::Layer * mSystemLayer = nullptr;
     Transport::UnauthenticatedSessionTable<CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE> mUnauthenticatedSessions;
-    Transport::SecureSessionTable<CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE> mPeerConnections; // < Active connections to other peers
+    Transport::SecureSessionTable<CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE, Time::Source::kSystem,
+                                  CHIP_CONFIG_PEER_CONNECTION_POOL_USE_HEAP>
+        mPeerConnections; // < Active connections to other peers
     State mState;                                                                          // < Initialization state of the object
 
     SessionManagerDelegate * mCB                                       = nullptr;
@@ -58,6 +58,8 @@ CHIP_ERROR UDP::Init(UdpListenParameters & params)
     SuccessOrExit(err);
 
     mUDPEndpointType = params.GetAddressType();
+    mSystemLayer     = params.GetInetLayer()->SystemLayer();
+    mSendBatching    = params.GetSendBatching() && (kSendQueueSize > 1);
 
     mState = State::kInitialized;
 
@@ -85,6 +87,14 @@ uint16_t UDP::GetBoundPort()
 
 void UDP::Close()
 {
+    if (mSystemLayer != nullptr)
+    {
+        // Do not drop messages that were accepted for sending.
+        FlushSendQueue();
+        mSystemLayer->CancelTimer(HandleSendQueueFlush, this);
+        mSystemLayer = nullptr;
+    }
+
     if (mUDPEndPoint)
     {
         // Udp endpoint is only non null if udp endpoint is initialized and listening
@@ -108,7 +118,65 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     addrInfo.DestPort    = address.GetPort();
     addrInfo.Interface   = address.GetInterface();
 
-    return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
+    if (!mSendBatching)
+    {
+        return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
+    }
+
+    if (mSendQueueLength == kSendQueueSize)
+    {
+        FlushSendQueue();
+    }
+
+    if (mSendQueueLength == 0)
+    {
+        // Flush once the handlers running in this event loop iteration have had a chance to queue their messages too. If
+        // the flush cannot be scheduled, fall back to sending right away.
+        CHIP_ERROR err = mSystemLayer->ScheduleWork(HandleSendQueueFlush, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
+        }
+    }
+
+    mSendQueueInfo[mSendQueueLength] = addrInfo;
+    mSendQueue[mSendQueueLength]     = std::move(msgBuf);
+    mSendQueueLength++;
+
+    return CHIP_NO_ERROR;
+}
+
+void UDP::FlushSendQueue()
+{
+    size_t queued = 0;
+
+    while (queued < mSendQueueLength)
+    {
+        size_t sent    = 0;
+        CHIP_ERROR err = CHIP_ERROR_INCORRECT_STATE;
+
+        if (mUDPEndPoint != nullptr)
+        {
+            err = mUDPEndPoint->SendMsgs(&mSendQueueInfo[queued], &mSendQueue[queued], mSendQueueLength - queued, sent);
+        }
+
+        queued += sent;
+
+        if (err != CHIP_NO_ERROR && queued < mSendQueueLength)
+        {
+            // Drop the message that failed and carry on with the rest, as if each had been sent separately.
+            ChipLogError(Inet, "Failed to send queued UDP message: %s", ErrorStr(err));
+            mSendQueue[queued] = nullptr;
+            queued++;
+        }
+    }
+
+    mSendQueueLength = 0;
+}
+
+void UDP::HandleSendQueueFlush(System::Layer * systemLayer, void * appState)
+{
+    static_cast<UDP *>(appState)->FlushSendQueue();
 }
 
 void UDP::OnUdpReceive(Inet::IPEndPointBasis * endPoint, System::PacketBufferHandle && buffer, const Inet::IPPacketInfo * pktInfo)
@@ -31,6 +31,7 @@
 #include <inet/IPEndPointBasis.h>
 #include <inet/InetInterface.h>
 #include <lib/core/CHIPCore.h>
+#include <system/SystemLayer.h>
 #include <transport/raw/Base.h>
 
 namespace chip {
@@ -70,11 +71,20 @@ public:
         return *this;
     }
 
+    bool GetSendBatching() const { return mSendBatching; }
+    UdpListenParameters & SetSendBatching(bool enable)
+    {
+        mSendBatching = enable;
+
+        return *this;
+    }
+
 private:
     Inet::InetLayer * mLayer         = nullptr;                   ///< Associated inet layer
     Inet::IPAddressType mAddressType = Inet::kIPAddressType_IPv6; ///< type of listening socket
     uint16_t mListenPort             = CHIP_PORT;                 ///< UDP listen port
     Inet::InterfaceId mInterfaceId   = INET_NULL_INTERFACEID;     ///< Interface to listen on
+    bool mSendBatching               = false;                     ///< Queue sends and flush them once per event loop iteration
 };
 
 /** Implements a transport using UDP. */
@@ -112,8 +122,22 @@ public:
      */
     void Close() override;
 
+    /**
+     * Send a message to the given UDP peer.
+     *
+     * @details
+     *   The message is sent immediately unless send batching was enabled through UdpListenParameters::SetSendBatching().
+     *   With batching, the message is queued and transmitted, together with the other messages queued during the same event
+     *   loop iteration, from work scheduled on the System::Layer; errors from such deferred sends are only logged, so
+     *   batching should only be enabled by callers that do not rely on the send error.
+     */
     CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf) override;
 
+    /**
+     * Transmit any messages queued by SendMessage() immediately.
+     */
+    void FlushSendQueue();
+
     bool CanSendToPeer(const Transport::PeerAddress & address) override
     {
         return (mState == State::kInitialized) && (address.GetTransportType() == Type::kUdp) &&
@@ -125,9 +149,20 @@ private:
     static void OnUdpReceive(Inet::IPEndPointBasis * endPoint, System::PacketBufferHandle && buffer,
                              const Inet::IPPacketInfo * pktInfo);
 
+    static void HandleSendQueueFlush(System::Layer * systemLayer, void * appState);
+
+    static constexpr size_t kSendQueueSize = INET_CONFIG_UDP_SEND_BATCH_SIZE;
+
     Inet::UDPEndPoint * mUDPEndPoint     = nullptr;                                     ///< UDP socket used by the transport
     Inet::IPAddressType mUDPEndpointType = Inet::IPAddressType::kIPAddressType_Unknown; ///< Socket listening type
     State mState                         = State::kNotReady;                            ///< State of the UDP transport
+    System::Layer * mSystemLayer         = nullptr;                                     ///< Layer running the send queue flush
+    bool mSendBatching                   = false;                                       ///< Whether SendMessage() queues
+
+    // Messages queued by SendMessage() that have not been flushed yet.
+    Inet::IPPacketInfo mSendQueueInfo[kSendQueueSize];
+    System::PacketBufferHandle mSendQueue[kSendQueueSize];
+    size_t mSendQueueLength = 0;
 };
 
 } // namespace Transport
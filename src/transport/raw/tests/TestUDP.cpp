@@ -169,6 +169,116 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+/////////////////////////// Batched send test
+
+void CheckMessageBurstTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr int kBurstSize = 2 * INET_CONFIG_UDP_SEND_BATCH_SIZE + 1;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(
+        Transport::UdpListenParameters(&ctx.GetInetLayer()).SetAddressType(addr.Type()).SetListenPort(0).SetSendBatching(true));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSessionManager(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+    // Queue more messages than fit in one batch; they must all be delivered.
+    for (int i = 0; i < kBurstSize; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        err = header.EncodeBeforeData(buffer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        err = udp.SendMessage(Transport::PeerAddress::UDP(addr, udp.GetBoundPort()), std::move(buffer));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    ctx.DriveIOUntil(1000 /* ms */, []() { return ReceiveHandlerCallCount == kBurstSize; });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == kBurstSize);
+}
+
+#if INET_CONFIG_ENABLE_IPV4
+void CheckMessageBurstTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckMessageBurstTest(inSuite, inContext, addr);
+}
+
+void CheckMessageBurstFailureTest4(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // One more message than the send queue holds, so that queuing the last one flushes a full queue.
+    constexpr int kQueueSize = INET_CONFIG_UDP_SEND_BATCH_SIZE;
+    constexpr int kBurstSize = kQueueSize + 1;
+
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+
+    // Messages to an IPv6 destination cannot be sent by an IPv4 endpoint: fail the second message of the queue and the
+    // last one, whose failure ends the flush.
+    IPAddress badAddr;
+    IPAddress::FromString("::1", badAddr);
+    auto isBad = [](int i) { return i == 1 || i == kQueueSize - 1; };
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(
+        Transport::UdpListenParameters(&ctx.GetInetLayer()).SetAddressType(addr.Type()).SetListenPort(0).SetSendBatching(true));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSessionManager(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+    int expected = 0;
+    for (int i = 0; i < kBurstSize; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        err = header.EncodeBeforeData(buffer);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        err = udp.SendMessage(Transport::PeerAddress::UDP(isBad(i) ? badAddr : addr, udp.GetBoundPort()), std::move(buffer));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        expected += isBad(i) ? 0 : 1;
+    }
+
+    // Only the failed messages are dropped; every other queued message is still delivered.
+    ctx.DriveIOUntil(1000 /* ms */, [expected]() { return ReceiveHandlerCallCount == expected; });
+    ctx.DriveIOUntil(100 /* ms */, []() { return false; });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == expected);
+}
+#endif
+
 // Test Suite
 
 /**
@@ -178,12 +288,14 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
 static const nlTest sTests[] =
 {
 #if INET_CONFIG_ENABLE_IPV4
-    NL_TEST_DEF("Simple Init Test IPV4",   CheckSimpleInitTest4),
-    NL_TEST_DEF("Message Self Test IPV4",  CheckMessageTest4),
+    NL_TEST_DEF("Simple Init Test IPV4",           CheckSimpleInitTest4),
+    NL_TEST_DEF("Message Self Test IPV4",          CheckMessageTest4),
+    NL_TEST_DEF("Message Burst Test IPV4",         CheckMessageBurstTest4),
+    NL_TEST_DEF("Message Burst Failure Test IPV4", CheckMessageBurstFailureTest4),
 #endif
 
-    NL_TEST_DEF("Simple Init Test IPV6",   CheckSimpleInitTest6),
-    NL_TEST_DEF("Message Self Test IPV6",  CheckMessageTest6),
+    NL_TEST_DEF("Simple Init Test IPV6",           CheckSimpleInitTest6),
+    NL_TEST_DEF("Message Self Test IPV6",          CheckMessageTest6),
 
     NL_TEST_SENTINEL()
 };
@@ -22,6 +22,7 @@
  *      the SecureSessionTable class within the transport layer
  *
  */
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ErrorStr.h>
 #include <lib/support/UnitTestRegistration.h>
@@ -284,6 +285,126 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !connections.FindPeerConnectionState(kPeer3Addr, nullptr));
 }
 
+void TestFindByFabricAndNodeId(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    SecureSession * state1 = nullptr;
+    SecureSession * state2 = nullptr;
+    SecureSessionTable<3, Time::Source::kTest> connections;
+
+    err = connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer1NodeId), 1, 2, 1, &state1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer1NodeId), 3, 4, 2, &state2);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByNode(1, kPeer1NodeId) == state1);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByNode(2, kPeer1NodeId) == state2);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByNode(3, kPeer1NodeId) == nullptr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByNode(1, kPeer2NodeId) == nullptr);
+
+    connections.MarkConnectionExpired(state1, [](const SecureSession &) {});
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByNode(1, kPeer1NodeId) == nullptr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByNode(2, kPeer1NodeId) == state2);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Missing(), 2, nullptr) == nullptr);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Missing(), 4, nullptr) == state2);
+}
+
+template <bool kUseHeap>
+void CheckIndexedLookupMatchesScan(nlTestSuite * inSuite)
+{
+    // A heap backed table is sized below the number of sessions to exercise growing the pool and its indices.
+    constexpr size_t kSessionCount = 64;
+    SecureSessionTable<kUseHeap ? 16 : kSessionCount, Time::Source::kTest, kUseHeap> connections;
+    SecureSession * states[kSessionCount];
+    bool active[kSessionCount];
+
+    // Fill the table, with some local session ids and nodes shared between sessions.
+    for (size_t i = 0; i < kSessionCount; i++)
+    {
+        const uint16_t localSessionId = static_cast<uint16_t>((i * 37) % 48);
+        const NodeId nodeId           = 100 + i % 20;
+        const FabricIndex fabric      = static_cast<FabricIndex>(1 + i % 3);
+
+        CHIP_ERROR err = connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(nodeId), static_cast<uint16_t>(i),
+                                                                  localSessionId, fabric, &states[i]);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        active[i] = (err == CHIP_NO_ERROR);
+    }
+
+    // Churn: expire every third session and refill some of the freed space with new keys.
+    for (size_t i = 0; i < kSessionCount; i += 3)
+    {
+        connections.MarkConnectionExpired(states[i], [](const SecureSession &) {});
+        active[i] = false;
+    }
+    for (size_t i = 0; i < kSessionCount; i += 6)
+    {
+        CHIP_ERROR err = connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(200 + i), static_cast<uint16_t>(i),
+                                                                  static_cast<uint16_t>(1000 + i), 1, &states[i]);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        active[i] = (err == CHIP_NO_ERROR);
+    }
+
+    // Every indexed lookup must return the lowest addressed match of a scan over all active sessions.
+    auto findExpected = [&](auto matches) {
+        SecureSession * expected = nullptr;
+        for (size_t i = 0; i < kSessionCount; i++)
+        {
+            if (active[i] && matches(*states[i]) && (expected == nullptr || states[i] < expected))
+            {
+                expected = states[i];
+            }
+        }
+        return expected;
+    };
+
+    for (uint16_t localSessionId = 0; localSessionId < 1100; localSessionId++)
+    {
+        SecureSession * expected =
+            findExpected([localSessionId](SecureSession & state) { return state.GetLocalSessionId() == localSessionId; });
+        NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(localSessionId, nullptr) == expected);
+        NL_TEST_ASSERT(inSuite,
+                       connections.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Missing(), localSessionId, nullptr) ==
+                           expected);
+    }
+
+    for (NodeId nodeId = 100; nodeId < 300; nodeId++)
+    {
+        for (FabricIndex fabric = 1; fabric <= 3; fabric++)
+        {
+            SecureSession * expected = findExpected([nodeId, fabric](SecureSession & state) {
+                return state.GetPeerNodeId() == nodeId && state.GetFabricIndex() == fabric;
+            });
+            NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionStateByNode(fabric, nodeId) == expected);
+        }
+    }
+}
+
+void TestIndexedLookupMatchesScan(nlTestSuite * inSuite, void * inContext)
+{
+    CheckIndexedLookupMatchesScan<false>(inSuite);
+}
+
+void TestHeapIndexedLookupMatchesScan(nlTestSuite * inSuite, void * inContext)
+{
+    CheckIndexedLookupMatchesScan<true>(inSuite);
+}
+
+int Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
+    return SUCCESS;
+}
+
+int Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
 } // namespace
 
 // clang-format off
@@ -293,6 +414,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("FindByPeerAddress", TestFindByAddress),
     NL_TEST_DEF("FindByNodeId", TestFindByNodeId),
     NL_TEST_DEF("FindByKeyId", TestFindByKeyId),
+    NL_TEST_DEF("FindByFabricAndNodeId", TestFindByFabricAndNodeId),
+    NL_TEST_DEF("IndexedLookupMatchesScan", TestIndexedLookupMatchesScan),
+    NL_TEST_DEF("HeapIndexedLookupMatchesScan", TestHeapIndexedLookupMatchesScan),
     NL_TEST_DEF("ExpireConnections", TestExpireConnections),
     NL_TEST_SENTINEL()
 };
@@ -300,7 +424,7 @@ static const nlTest sTests[] =
 
 int TestPeerConnectionsFn(void)
 {
-    nlTestSuite theSuite = { "Transport-SecureSessionTable", &sTests[0], nullptr, nullptr };
+    nlTestSuite theSuite = { "Transport-SecureSessionTable", &sTests[0], Setup, Teardown };
     nlTestRunner(&theSuite, nullptr);
     return nlTestRunnerStats(&theSuite);
 }
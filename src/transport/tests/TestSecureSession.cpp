@@ -26,7 +26,9 @@
 
 #include <lib/core/CHIPCore.h>
 #include <transport/CryptoContext.h>
+#include <transport/SecureMessageCodec.h>
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <stdarg.h>
@@ -151,6 +153,78 @@ void SecureChannelDecryptTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
 }
 
+namespace {
+
+const char kTestSalt[] = "Test Salt";
+
+void InitChannelPair(nlTestSuite * inSuite, CryptoContext & initiator, CryptoContext & responder)
+{
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   initiator.Init(keypair, keypair2.Pubkey(), ByteSpan(Uint8::from_const_char(kTestSalt), sizeof(kTestSalt)),
+                                  CryptoContext::SessionInfoType::kSessionEstablishment,
+                                  CryptoContext::SessionRole::kInitiator) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   responder.Init(keypair2, keypair.Pubkey(), ByteSpan(Uint8::from_const_char(kTestSalt), sizeof(kTestSalt)),
+                                  CryptoContext::SessionInfoType::kSessionEstablishment,
+                                  CryptoContext::SessionRole::kResponder) == CHIP_NO_ERROR);
+}
+
+System::PacketBufferHandle BuildChain(const uint8_t * data, size_t length, size_t chunkSize, uint16_t tailroom)
+{
+    System::PacketBufferHandle head;
+    for (size_t offset = 0; offset < length; offset += chunkSize)
+    {
+        size_t count                    = (length - offset < chunkSize) ? length - offset : chunkSize;
+        System::PacketBufferHandle next = System::PacketBufferHandle::NewWithData(&data[offset], count, tailroom);
+        if (next.IsNull())
+        {
+            return System::PacketBufferHandle();
+        }
+        if (head.IsNull())
+        {
+            head = std::move(next);
+        }
+        else
+        {
+            head->AddToEnd(std::move(next));
+        }
+    }
+    return head;
+}
+
+} // namespace
+
+void SecureMessageCodecChainTest(nlTestSuite * inSuite, void * inContext)
+{
+    Transport::SecureSession sender;
+    Transport::SecureSession receiver;
+    InitChannelPair(inSuite, sender.GetCryptoContext(), receiver.GetCryptoContext());
+
+    uint8_t payload[256];
+    NL_TEST_ASSERT(inSuite, DRBG_get_bytes(payload, sizeof(payload)) == CHIP_NO_ERROR);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::Id(VendorId::Common, 0x1234), 0x56);
+
+    // The transports send a single buffer per message, so chains are rejected before anything is
+    // encrypted and before a message counter is used up.
+    PacketHeader packetHeader;
+    LocalSessionMessageCounter counter;
+    const uint32_t initialCounter    = counter.Value();
+    System::PacketBufferHandle chain = BuildChain(payload, sizeof(payload), sizeof(payload) / 3 + 1, kMaxTagLen);
+    NL_TEST_ASSERT(inSuite, !chain.IsNull() && chain->HasChainedBuffer());
+    NL_TEST_ASSERT(inSuite,
+                   SecureMessageCodec::Encode(&sender, payloadHeader, packetHeader, chain, counter) ==
+                       CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    NL_TEST_ASSERT(inSuite, counter.Value() == initialCounter);
+}
+
 // Test Suite
 
 /**
@@ -162,18 +236,39 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Init",    SecureChannelInitTest),
     NL_TEST_DEF("Encrypt", SecureChannelEncryptTest),
     NL_TEST_DEF("Decrypt", SecureChannelDecryptTest),
+    NL_TEST_DEF("CodecChain", SecureMessageCodecChainTest),
 
     NL_TEST_SENTINEL()
 };
 // clang-format on
 
+/**
+ *  Set up the test suite.
+ */
+int TestSecureSession_Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
+    return SUCCESS;
+}
+
+/**
+ *  Tear down the test suite.
+ */
+int TestSecureSession_Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
 // clang-format off
 static nlTestSuite sSuite =
 {
     "Test-CHIP-CryptoContext",
     &sTests[0],
-    nullptr,
-    nullptr
+    TestSecureSession_Setup,
+    TestSecureSession_Teardown
 };
 // clang-format on
 
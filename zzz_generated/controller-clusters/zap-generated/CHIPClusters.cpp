@@ -62,7 +62,7 @@ CHIP_ERROR AccountLoginCluster::GetSetupPIN(Callback::Cancelable * onSuccessCall
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, AccountLogin::Commands::Ids::GetSetupPIN,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -81,7 +81,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -103,7 +103,7 @@ CHIP_ERROR AccountLoginCluster::Login(Callback::Cancelable * onSuccessCallback,
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, AccountLogin::Commands::Ids::Login,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -124,7 +124,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -162,7 +162,7 @@ CHIP_ERROR AdministratorCommissioningCluster::OpenBasicCommissioningWindow(Callb
                                          AdministratorCommissioning::Commands::Ids::OpenBasicCommissioningWindow,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -181,7 +181,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -207,7 +207,7 @@ CHIP_ERROR AdministratorCommissioningCluster::OpenCommissioningWindow(Callback::
                                          AdministratorCommissioning::Commands::Ids::OpenCommissioningWindow,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -236,7 +236,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -259,7 +259,7 @@ CHIP_ERROR AdministratorCommissioningCluster::RevokeCommissioning(Callback::Canc
                                          AdministratorCommissioning::Commands::Ids::RevokeCommissioning,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -276,7 +276,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -312,7 +312,7 @@ CHIP_ERROR ApplicationBasicCluster::ChangeStatus(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ApplicationBasic::Commands::Ids::ChangeStatus,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -331,7 +331,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -451,7 +451,7 @@ CHIP_ERROR ApplicationLauncherCluster::LaunchApp(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ApplicationLauncher::Commands::Ids::LaunchApp,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -474,7 +474,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -546,7 +546,7 @@ CHIP_ERROR AudioOutputCluster::RenameOutput(Callback::Cancelable * onSuccessCall
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, AudioOutput::Commands::Ids::RenameOutput,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -567,7 +567,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -589,7 +589,7 @@ CHIP_ERROR AudioOutputCluster::SelectOutput(Callback::Cancelable * onSuccessCall
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, AudioOutput::Commands::Ids::SelectOutput,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -608,7 +608,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -669,7 +669,7 @@ CHIP_ERROR BarrierControlCluster::BarrierControlGoToPercent(Callback::Cancelable
                                          BarrierControl::Commands::Ids::BarrierControlGoToPercent,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -688,7 +688,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -710,7 +710,7 @@ CHIP_ERROR BarrierControlCluster::BarrierControlStop(Callback::Cancelable * onSu
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, BarrierControl::Commands::Ids::BarrierControlStop,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -727,7 +727,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -810,7 +810,7 @@ CHIP_ERROR BasicCluster::MfgSpecificPing(Callback::Cancelable * onSuccessCallbac
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Basic::Commands::Ids::MfgSpecificPing,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -827,7 +827,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1244,7 +1244,7 @@ CHIP_ERROR BindingCluster::Bind(Callback::Cancelable * onSuccessCallback, Callba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Binding::Commands::Ids::Bind,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1269,7 +1269,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1292,7 +1292,7 @@ CHIP_ERROR BindingCluster::Unbind(Callback::Cancelable * onSuccessCallback, Call
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Binding::Commands::Ids::Unbind,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1317,7 +1317,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1553,7 +1553,7 @@ CHIP_ERROR ColorControlCluster::ColorLoopSet(Callback::Cancelable * onSuccessCal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::ColorLoopSet,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1584,7 +1584,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1606,7 +1606,7 @@ CHIP_ERROR ColorControlCluster::EnhancedMoveHue(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::EnhancedMoveHue,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1631,7 +1631,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1654,7 +1654,7 @@ CHIP_ERROR ColorControlCluster::EnhancedMoveToHue(Callback::Cancelable * onSucce
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::EnhancedMoveToHue,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1681,7 +1681,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1706,7 +1706,7 @@ CHIP_ERROR ColorControlCluster::EnhancedMoveToHueAndSaturation(Callback::Cancela
                                          ColorControl::Commands::Ids::EnhancedMoveToHueAndSaturation,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1733,7 +1733,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1756,7 +1756,7 @@ CHIP_ERROR ColorControlCluster::EnhancedStepHue(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::EnhancedStepHue,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1783,7 +1783,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1805,7 +1805,7 @@ CHIP_ERROR ColorControlCluster::MoveColor(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::MoveColor,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1830,7 +1830,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1854,7 +1854,7 @@ CHIP_ERROR ColorControlCluster::MoveColorTemperature(Callback::Cancelable * onSu
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::MoveColorTemperature,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1883,7 +1883,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1905,7 +1905,7 @@ CHIP_ERROR ColorControlCluster::MoveHue(Callback::Cancelable * onSuccessCallback
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::MoveHue,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1930,7 +1930,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -1952,7 +1952,7 @@ CHIP_ERROR ColorControlCluster::MoveSaturation(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::MoveSaturation,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -1977,7 +1977,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2000,7 +2000,7 @@ CHIP_ERROR ColorControlCluster::MoveToColor(Callback::Cancelable * onSuccessCall
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::MoveToColor,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2027,7 +2027,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2051,7 +2051,7 @@ CHIP_ERROR ColorControlCluster::MoveToColorTemperature(Callback::Cancelable * on
                                          ColorControl::Commands::Ids::MoveToColorTemperature,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2076,7 +2076,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2099,7 +2099,7 @@ CHIP_ERROR ColorControlCluster::MoveToHue(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::MoveToHue,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2126,7 +2126,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2150,7 +2150,7 @@ CHIP_ERROR ColorControlCluster::MoveToHueAndSaturation(Callback::Cancelable * on
                                          ColorControl::Commands::Ids::MoveToHueAndSaturation,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2177,7 +2177,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2200,7 +2200,7 @@ CHIP_ERROR ColorControlCluster::MoveToSaturation(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::MoveToSaturation,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2225,7 +2225,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2248,7 +2248,7 @@ CHIP_ERROR ColorControlCluster::StepColor(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::StepColor,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2275,7 +2275,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2299,7 +2299,7 @@ CHIP_ERROR ColorControlCluster::StepColorTemperature(Callback::Cancelable * onSu
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::StepColorTemperature,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2330,7 +2330,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2353,7 +2353,7 @@ CHIP_ERROR ColorControlCluster::StepHue(Callback::Cancelable * onSuccessCallback
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::StepHue,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2380,7 +2380,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2403,7 +2403,7 @@ CHIP_ERROR ColorControlCluster::StepSaturation(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::StepSaturation,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2430,7 +2430,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -2452,7 +2452,7 @@ CHIP_ERROR ColorControlCluster::StopMoveStep(Callback::Cancelable * onSuccessCal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ColorControl::Commands::Ids::StopMoveStep,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -2473,7 +2473,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3450,7 +3450,7 @@ CHIP_ERROR ContentLauncherCluster::LaunchContent(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ContentLauncher::Commands::Ids::LaunchContent,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3471,7 +3471,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3493,7 +3493,7 @@ CHIP_ERROR ContentLauncherCluster::LaunchURL(Callback::Cancelable * onSuccessCal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, ContentLauncher::Commands::Ids::LaunchURL,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3514,7 +3514,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3638,7 +3638,7 @@ CHIP_ERROR DiagnosticLogsCluster::RetrieveLogsRequest(Callback::Cancelable * onS
                                          DiagnosticLogs::Commands::Ids::RetrieveLogsRequest,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3661,7 +3661,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3685,7 +3685,7 @@ CHIP_ERROR DoorLockCluster::ClearAllPins(Callback::Cancelable * onSuccessCallbac
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::ClearAllPins,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3702,7 +3702,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3723,7 +3723,7 @@ CHIP_ERROR DoorLockCluster::ClearAllRfids(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::ClearAllRfids,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3740,7 +3740,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3762,7 +3762,7 @@ CHIP_ERROR DoorLockCluster::ClearHolidaySchedule(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::ClearHolidaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3781,7 +3781,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3803,7 +3803,7 @@ CHIP_ERROR DoorLockCluster::ClearPin(Callback::Cancelable * onSuccessCallback, C
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::ClearPin,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3822,7 +3822,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3844,7 +3844,7 @@ CHIP_ERROR DoorLockCluster::ClearRfid(Callback::Cancelable * onSuccessCallback,
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::ClearRfid,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3863,7 +3863,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3885,7 +3885,7 @@ CHIP_ERROR DoorLockCluster::ClearWeekdaySchedule(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::ClearWeekdaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3906,7 +3906,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3928,7 +3928,7 @@ CHIP_ERROR DoorLockCluster::ClearYeardaySchedule(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::ClearYeardaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3949,7 +3949,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -3971,7 +3971,7 @@ CHIP_ERROR DoorLockCluster::GetHolidaySchedule(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::GetHolidaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -3990,7 +3990,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4012,7 +4012,7 @@ CHIP_ERROR DoorLockCluster::GetLogRecord(Callback::Cancelable * onSuccessCallbac
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::GetLogRecord,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4031,7 +4031,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4053,7 +4053,7 @@ CHIP_ERROR DoorLockCluster::GetPin(Callback::Cancelable * onSuccessCallback, Cal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::GetPin,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4072,7 +4072,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4094,7 +4094,7 @@ CHIP_ERROR DoorLockCluster::GetRfid(Callback::Cancelable * onSuccessCallback, Ca
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::GetRfid,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4113,7 +4113,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4135,7 +4135,7 @@ CHIP_ERROR DoorLockCluster::GetUserType(Callback::Cancelable * onSuccessCallback
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::GetUserType,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4154,7 +4154,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4176,7 +4176,7 @@ CHIP_ERROR DoorLockCluster::GetWeekdaySchedule(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::GetWeekdaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4197,7 +4197,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4219,7 +4219,7 @@ CHIP_ERROR DoorLockCluster::GetYeardaySchedule(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::GetYeardaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4240,7 +4240,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4262,7 +4262,7 @@ CHIP_ERROR DoorLockCluster::LockDoor(Callback::Cancelable * onSuccessCallback, C
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::LockDoor,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4281,7 +4281,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4304,7 +4304,7 @@ CHIP_ERROR DoorLockCluster::SetHolidaySchedule(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::SetHolidaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4329,7 +4329,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4351,7 +4351,7 @@ CHIP_ERROR DoorLockCluster::SetPin(Callback::Cancelable * onSuccessCallback, Cal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::SetPin,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4376,7 +4376,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4398,7 +4398,7 @@ CHIP_ERROR DoorLockCluster::SetRfid(Callback::Cancelable * onSuccessCallback, Ca
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::SetRfid,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4423,7 +4423,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4445,7 +4445,7 @@ CHIP_ERROR DoorLockCluster::SetUserType(Callback::Cancelable * onSuccessCallback
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::SetUserType,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4466,7 +4466,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4489,7 +4489,7 @@ CHIP_ERROR DoorLockCluster::SetWeekdaySchedule(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::SetWeekdaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4520,7 +4520,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4542,7 +4542,7 @@ CHIP_ERROR DoorLockCluster::SetYeardaySchedule(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::SetYeardaySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4567,7 +4567,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4589,7 +4589,7 @@ CHIP_ERROR DoorLockCluster::UnlockDoor(Callback::Cancelable * onSuccessCallback,
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::UnlockDoor,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4608,7 +4608,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4630,7 +4630,7 @@ CHIP_ERROR DoorLockCluster::UnlockWithTimeout(Callback::Cancelable * onSuccessCa
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, DoorLock::Commands::Ids::UnlockWithTimeout,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4651,7 +4651,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -4889,7 +4889,7 @@ CHIP_ERROR EthernetNetworkDiagnosticsCluster::ResetCounts(Callback::Cancelable *
                                          EthernetNetworkDiagnostics::Commands::Ids::ResetCounts,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -4906,7 +4906,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5079,7 +5079,7 @@ CHIP_ERROR GeneralCommissioningCluster::ArmFailSafe(Callback::Cancelable * onSuc
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, GeneralCommissioning::Commands::Ids::ArmFailSafe,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5102,7 +5102,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5125,7 +5125,7 @@ CHIP_ERROR GeneralCommissioningCluster::CommissioningComplete(Callback::Cancelab
                                          GeneralCommissioning::Commands::Ids::CommissioningComplete,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5142,7 +5142,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5166,7 +5166,7 @@ CHIP_ERROR GeneralCommissioningCluster::SetRegulatoryConfig(Callback::Cancelable
                                          GeneralCommissioning::Commands::Ids::SetRegulatoryConfig,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5191,7 +5191,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5344,7 +5344,7 @@ CHIP_ERROR GroupsCluster::AddGroup(Callback::Cancelable * onSuccessCallback, Cal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Groups::Commands::Ids::AddGroup,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5365,7 +5365,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5387,7 +5387,7 @@ CHIP_ERROR GroupsCluster::AddGroupIfIdentifying(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Groups::Commands::Ids::AddGroupIfIdentifying,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5408,7 +5408,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5430,7 +5430,7 @@ CHIP_ERROR GroupsCluster::GetGroupMembership(Callback::Cancelable * onSuccessCal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Groups::Commands::Ids::GetGroupMembership,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5451,7 +5451,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5472,7 +5472,7 @@ CHIP_ERROR GroupsCluster::RemoveAllGroups(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Groups::Commands::Ids::RemoveAllGroups,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5489,7 +5489,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5511,7 +5511,7 @@ CHIP_ERROR GroupsCluster::RemoveGroup(Callback::Cancelable * onSuccessCallback,
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Groups::Commands::Ids::RemoveGroup,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5530,7 +5530,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5552,7 +5552,7 @@ CHIP_ERROR GroupsCluster::ViewGroup(Callback::Cancelable * onSuccessCallback, Ca
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Groups::Commands::Ids::ViewGroup,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5571,7 +5571,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5619,7 +5619,7 @@ CHIP_ERROR IdentifyCluster::Identify(Callback::Cancelable * onSuccessCallback, C
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Identify::Commands::Ids::Identify,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5638,7 +5638,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5659,7 +5659,7 @@ CHIP_ERROR IdentifyCluster::IdentifyQuery(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Identify::Commands::Ids::IdentifyQuery,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5676,7 +5676,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5741,7 +5741,7 @@ CHIP_ERROR KeypadInputCluster::SendKey(Callback::Cancelable * onSuccessCallback,
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, KeypadInput::Commands::Ids::SendKey,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5760,7 +5760,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5796,7 +5796,7 @@ CHIP_ERROR LevelControlCluster::Move(Callback::Cancelable * onSuccessCallback, C
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LevelControl::Commands::Ids::Move,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5821,7 +5821,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5843,7 +5843,7 @@ CHIP_ERROR LevelControlCluster::MoveToLevel(Callback::Cancelable * onSuccessCall
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LevelControl::Commands::Ids::MoveToLevel,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5868,7 +5868,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5891,7 +5891,7 @@ CHIP_ERROR LevelControlCluster::MoveToLevelWithOnOff(Callback::Cancelable * onSu
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LevelControl::Commands::Ids::MoveToLevelWithOnOff,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5912,7 +5912,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5934,7 +5934,7 @@ CHIP_ERROR LevelControlCluster::MoveWithOnOff(Callback::Cancelable * onSuccessCa
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LevelControl::Commands::Ids::MoveWithOnOff,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -5955,7 +5955,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -5978,7 +5978,7 @@ CHIP_ERROR LevelControlCluster::Step(Callback::Cancelable * onSuccessCallback, C
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LevelControl::Commands::Ids::Step,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6005,7 +6005,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6027,7 +6027,7 @@ CHIP_ERROR LevelControlCluster::StepWithOnOff(Callback::Cancelable * onSuccessCa
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LevelControl::Commands::Ids::StepWithOnOff,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6050,7 +6050,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6072,7 +6072,7 @@ CHIP_ERROR LevelControlCluster::Stop(Callback::Cancelable * onSuccessCallback, C
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LevelControl::Commands::Ids::Stop,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6093,7 +6093,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6114,7 +6114,7 @@ CHIP_ERROR LevelControlCluster::StopWithOnOff(Callback::Cancelable * onSuccessCa
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LevelControl::Commands::Ids::StopWithOnOff,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6131,7 +6131,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6197,7 +6197,7 @@ CHIP_ERROR LowPowerCluster::Sleep(Callback::Cancelable * onSuccessCallback, Call
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, LowPower::Commands::Ids::Sleep,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6214,7 +6214,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6249,7 +6249,7 @@ CHIP_ERROR MediaInputCluster::HideInputStatus(Callback::Cancelable * onSuccessCa
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaInput::Commands::Ids::HideInputStatus,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6266,7 +6266,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6288,7 +6288,7 @@ CHIP_ERROR MediaInputCluster::RenameInput(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaInput::Commands::Ids::RenameInput,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6309,7 +6309,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6331,7 +6331,7 @@ CHIP_ERROR MediaInputCluster::SelectInput(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaInput::Commands::Ids::SelectInput,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6350,7 +6350,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6371,7 +6371,7 @@ CHIP_ERROR MediaInputCluster::ShowInputStatus(Callback::Cancelable * onSuccessCa
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaInput::Commands::Ids::ShowInputStatus,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6388,7 +6388,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6448,7 +6448,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaFastForward(Callback::Cancelable * onSucce
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaFastForward,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6465,7 +6465,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6486,7 +6486,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaNext(Callback::Cancelable * onSuccessCallb
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaNext,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6503,7 +6503,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6524,7 +6524,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaPause(Callback::Cancelable * onSuccessCall
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaPause,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6541,7 +6541,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6562,7 +6562,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaPlay(Callback::Cancelable * onSuccessCallb
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaPlay,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6579,7 +6579,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6600,7 +6600,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaPrevious(Callback::Cancelable * onSuccessC
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaPrevious,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6617,7 +6617,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6638,7 +6638,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaRewind(Callback::Cancelable * onSuccessCal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaRewind,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6655,7 +6655,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6677,7 +6677,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaSeek(Callback::Cancelable * onSuccessCallb
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaSeek,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6696,7 +6696,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6718,7 +6718,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaSkipBackward(Callback::Cancelable * onSucc
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaSkipBackward,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6737,7 +6737,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6759,7 +6759,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaSkipForward(Callback::Cancelable * onSucce
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaSkipForward,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6778,7 +6778,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6799,7 +6799,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaStartOver(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaStartOver,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6816,7 +6816,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6837,7 +6837,7 @@ CHIP_ERROR MediaPlaybackCluster::MediaStop(Callback::Cancelable * onSuccessCallb
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, MediaPlayback::Commands::Ids::MediaStop,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -6854,7 +6854,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -6988,7 +6988,7 @@ CHIP_ERROR NetworkCommissioningCluster::AddThreadNetwork(Callback::Cancelable *
                                          NetworkCommissioning::Commands::Ids::AddThreadNetwork,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7011,7 +7011,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7035,7 +7035,7 @@ CHIP_ERROR NetworkCommissioningCluster::AddWiFiNetwork(Callback::Cancelable * on
                                          NetworkCommissioning::Commands::Ids::AddWiFiNetwork,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7060,7 +7060,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7084,7 +7084,7 @@ CHIP_ERROR NetworkCommissioningCluster::DisableNetwork(Callback::Cancelable * on
                                          NetworkCommissioning::Commands::Ids::DisableNetwork,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7107,7 +7107,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7131,7 +7131,7 @@ CHIP_ERROR NetworkCommissioningCluster::EnableNetwork(Callback::Cancelable * onS
                                          NetworkCommissioning::Commands::Ids::EnableNetwork,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7154,7 +7154,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7178,7 +7178,7 @@ CHIP_ERROR NetworkCommissioningCluster::GetLastNetworkCommissioningResult(Callba
                                          NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7197,7 +7197,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7221,7 +7221,7 @@ CHIP_ERROR NetworkCommissioningCluster::RemoveNetwork(Callback::Cancelable * onS
                                          NetworkCommissioning::Commands::Ids::RemoveNetwork,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7244,7 +7244,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7267,7 +7267,7 @@ CHIP_ERROR NetworkCommissioningCluster::ScanNetworks(Callback::Cancelable * onSu
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, NetworkCommissioning::Commands::Ids::ScanNetworks,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7290,7 +7290,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7315,7 +7315,7 @@ CHIP_ERROR NetworkCommissioningCluster::UpdateThreadNetwork(Callback::Cancelable
                                          NetworkCommissioning::Commands::Ids::UpdateThreadNetwork,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7338,7 +7338,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7362,7 +7362,7 @@ CHIP_ERROR NetworkCommissioningCluster::UpdateWiFiNetwork(Callback::Cancelable *
                                          NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7387,7 +7387,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7437,7 +7437,7 @@ CHIP_ERROR OtaSoftwareUpdateProviderCluster::ApplyUpdateRequest(Callback::Cancel
                                          OtaSoftwareUpdateProvider::Commands::Ids::ApplyUpdateRequest,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7458,7 +7458,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7482,7 +7482,7 @@ CHIP_ERROR OtaSoftwareUpdateProviderCluster::NotifyUpdateApplied(Callback::Cance
                                          OtaSoftwareUpdateProvider::Commands::Ids::NotifyUpdateApplied,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7503,7 +7503,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7530,7 +7530,7 @@ CHIP_ERROR OtaSoftwareUpdateProviderCluster::QueryImage(Callback::Cancelable * o
                                          OtaSoftwareUpdateProvider::Commands::Ids::QueryImage,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7565,7 +7565,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7604,7 +7604,7 @@ CHIP_ERROR OtaSoftwareUpdateRequestorCluster::AnnounceOtaProvider(Callback::Canc
                                          OtaSoftwareUpdateRequestor::Commands::Ids::AnnounceOtaProvider,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7629,7 +7629,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7775,7 +7775,7 @@ CHIP_ERROR OnOffCluster::Off(Callback::Cancelable * onSuccessCallback, Callback:
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, OnOff::Commands::Ids::Off,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7792,7 +7792,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7814,7 +7814,7 @@ CHIP_ERROR OnOffCluster::OffWithEffect(Callback::Cancelable * onSuccessCallback,
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, OnOff::Commands::Ids::OffWithEffect,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7835,7 +7835,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7856,7 +7856,7 @@ CHIP_ERROR OnOffCluster::On(Callback::Cancelable * onSuccessCallback, Callback::
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, OnOff::Commands::Ids::On,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7873,7 +7873,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7894,7 +7894,7 @@ CHIP_ERROR OnOffCluster::OnWithRecallGlobalScene(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, OnOff::Commands::Ids::OnWithRecallGlobalScene,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7911,7 +7911,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7933,7 +7933,7 @@ CHIP_ERROR OnOffCluster::OnWithTimedOff(Callback::Cancelable * onSuccessCallback
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, OnOff::Commands::Ids::OnWithTimedOff,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7956,7 +7956,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -7977,7 +7977,7 @@ CHIP_ERROR OnOffCluster::Toggle(Callback::Cancelable * onSuccessCallback, Callba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, OnOff::Commands::Ids::Toggle,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -7994,7 +7994,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -8224,7 +8224,7 @@ CHIP_ERROR OperationalCredentialsCluster::AddNOC(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, OperationalCredentials::Commands::Ids::AddNOC,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -8251,7 +8251,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -8275,7 +8275,7 @@ CHIP_ERROR OperationalCredentialsCluster::AddTrustedRootCertificate(Callback::Ca
                                          OperationalCredentials::Commands::Ids::AddTrustedRootCertificate,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -8294,7 +8294,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -8317,7 +8317,7 @@ CHIP_ERROR OperationalCredentialsCluster::OpCSRRequest(Callback::Cancelable * on
                                          OperationalCredentials::Commands::Ids::OpCSRRequest,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -8336,7 +8336,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -8359,7 +8359,7 @@ CHIP_ERROR OperationalCredentialsCluster::RemoveFabric(Callback::Cancelable * on
                                          OperationalCredentials::Commands::Ids::RemoveFabric,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -8378,7 +8378,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -8402,7 +8402,7 @@ CHIP_ERROR OperationalCredentialsCluster::RemoveTrustedRootCertificate(Callback:
                                          OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -8421,7 +8421,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -8444,7 +8444,7 @@ CHIP_ERROR OperationalCredentialsCluster::UpdateFabricLabel(Callback::Cancelable
                                          OperationalCredentials::Commands::Ids::UpdateFabricLabel,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -8463,7 +8463,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -8486,7 +8486,7 @@ CHIP_ERROR OperationalCredentialsCluster::UpdateNOC(Callback::Cancelable * onSuc
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, OperationalCredentials::Commands::Ids::UpdateNOC,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -8507,7 +8507,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -8988,7 +8988,7 @@ CHIP_ERROR ScenesCluster::AddScene(Callback::Cancelable * onSuccessCallback, Cal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Scenes::Commands::Ids::AddScene,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9019,7 +9019,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9041,7 +9041,7 @@ CHIP_ERROR ScenesCluster::GetSceneMembership(Callback::Cancelable * onSuccessCal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Scenes::Commands::Ids::GetSceneMembership,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9060,7 +9060,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9082,7 +9082,7 @@ CHIP_ERROR ScenesCluster::RecallScene(Callback::Cancelable * onSuccessCallback,
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Scenes::Commands::Ids::RecallScene,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9105,7 +9105,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9127,7 +9127,7 @@ CHIP_ERROR ScenesCluster::RemoveAllScenes(Callback::Cancelable * onSuccessCallba
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Scenes::Commands::Ids::RemoveAllScenes,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9146,7 +9146,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9168,7 +9168,7 @@ CHIP_ERROR ScenesCluster::RemoveScene(Callback::Cancelable * onSuccessCallback,
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Scenes::Commands::Ids::RemoveScene,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9189,7 +9189,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9211,7 +9211,7 @@ CHIP_ERROR ScenesCluster::StoreScene(Callback::Cancelable * onSuccessCallback, C
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Scenes::Commands::Ids::StoreScene,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9232,7 +9232,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9254,7 +9254,7 @@ CHIP_ERROR ScenesCluster::ViewScene(Callback::Cancelable * onSuccessCallback, Ca
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Scenes::Commands::Ids::ViewScene,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9275,7 +9275,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9372,7 +9372,7 @@ CHIP_ERROR SoftwareDiagnosticsCluster::ResetWatermarks(Callback::Cancelable * on
                                          SoftwareDiagnostics::Commands::Ids::ResetWatermarks,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9389,7 +9389,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9494,7 +9494,7 @@ CHIP_ERROR TvChannelCluster::ChangeChannel(Callback::Cancelable * onSuccessCallb
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TvChannel::Commands::Ids::ChangeChannel,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9513,7 +9513,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9536,7 +9536,7 @@ CHIP_ERROR TvChannelCluster::ChangeChannelByNumber(Callback::Cancelable * onSucc
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TvChannel::Commands::Ids::ChangeChannelByNumber,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9557,7 +9557,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9579,7 +9579,7 @@ CHIP_ERROR TvChannelCluster::SkipChannel(Callback::Cancelable * onSuccessCallbac
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TvChannel::Commands::Ids::SkipChannel,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9598,7 +9598,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9670,7 +9670,7 @@ CHIP_ERROR TargetNavigatorCluster::NavigateTarget(Callback::Cancelable * onSucce
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TargetNavigator::Commands::Ids::NavigateTarget,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9691,7 +9691,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9808,7 +9808,7 @@ CHIP_ERROR TestClusterCluster::Test(Callback::Cancelable * onSuccessCallback, Ca
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TestCluster::Commands::Ids::Test,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9825,7 +9825,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9847,7 +9847,7 @@ CHIP_ERROR TestClusterCluster::TestAddArguments(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TestCluster::Commands::Ids::TestAddArguments,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9868,7 +9868,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9889,7 +9889,7 @@ CHIP_ERROR TestClusterCluster::TestNotHandled(Callback::Cancelable * onSuccessCa
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TestCluster::Commands::Ids::TestNotHandled,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9906,7 +9906,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9927,7 +9927,7 @@ CHIP_ERROR TestClusterCluster::TestSpecific(Callback::Cancelable * onSuccessCall
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TestCluster::Commands::Ids::TestSpecific,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9944,7 +9944,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -9966,7 +9966,7 @@ CHIP_ERROR TestClusterCluster::TestUnknownCommand(Callback::Cancelable * onSucce
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, TestCluster::Commands::Ids::TestUnknownCommand,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -9983,7 +9983,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -10693,7 +10693,7 @@ CHIP_ERROR ThermostatCluster::ClearWeeklySchedule(Callback::Cancelable * onSucce
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Thermostat::Commands::Ids::ClearWeeklySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -10710,7 +10710,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -10731,7 +10731,7 @@ CHIP_ERROR ThermostatCluster::GetRelayStatusLog(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Thermostat::Commands::Ids::GetRelayStatusLog,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -10748,7 +10748,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -10770,7 +10770,7 @@ CHIP_ERROR ThermostatCluster::GetWeeklySchedule(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Thermostat::Commands::Ids::GetWeeklySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -10791,7 +10791,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -10814,7 +10814,7 @@ CHIP_ERROR ThermostatCluster::SetWeeklySchedule(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Thermostat::Commands::Ids::SetWeeklySchedule,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -10839,7 +10839,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -10861,7 +10861,7 @@ CHIP_ERROR ThermostatCluster::SetpointRaiseLower(Callback::Cancelable * onSucces
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, Thermostat::Commands::Ids::SetpointRaiseLower,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -10882,7 +10882,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -11382,7 +11382,7 @@ CHIP_ERROR ThreadNetworkDiagnosticsCluster::ResetCounts(Callback::Cancelable * o
                                          ThreadNetworkDiagnostics::Commands::Ids::ResetCounts,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -11399,7 +11399,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -12218,7 +12218,7 @@ CHIP_ERROR WiFiNetworkDiagnosticsCluster::ResetCounts(Callback::Cancelable * onS
                                          WiFiNetworkDiagnostics::Commands::Ids::ResetCounts,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -12235,7 +12235,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -12330,7 +12330,7 @@ CHIP_ERROR WindowCoveringCluster::DownOrClose(Callback::Cancelable * onSuccessCa
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, WindowCovering::Commands::Ids::DownOrClose,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -12347,7 +12347,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -12370,7 +12370,7 @@ CHIP_ERROR WindowCoveringCluster::GoToLiftPercentage(Callback::Cancelable * onSu
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, WindowCovering::Commands::Ids::GoToLiftPercentage,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -12391,7 +12391,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -12413,7 +12413,7 @@ CHIP_ERROR WindowCoveringCluster::GoToLiftValue(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, WindowCovering::Commands::Ids::GoToLiftValue,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -12432,7 +12432,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -12455,7 +12455,7 @@ CHIP_ERROR WindowCoveringCluster::GoToTiltPercentage(Callback::Cancelable * onSu
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, WindowCovering::Commands::Ids::GoToTiltPercentage,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -12476,7 +12476,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -12498,7 +12498,7 @@ CHIP_ERROR WindowCoveringCluster::GoToTiltValue(Callback::Cancelable * onSuccess
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, WindowCovering::Commands::Ids::GoToTiltValue,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -12517,7 +12517,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -12538,7 +12538,7 @@ CHIP_ERROR WindowCoveringCluster::StopMotion(Callback::Cancelable * onSuccessCal
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, WindowCovering::Commands::Ids::StopMotion,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -12555,7 +12555,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
@@ -12576,7 +12576,7 @@ CHIP_ERROR WindowCoveringCluster::UpOrOpen(Callback::Cancelable * onSuccessCallb
     app::CommandPathParams cmdParams = { mEndpoint, /* group id */ 0, mClusterId, WindowCovering::Commands::Ids::UpOrOpen,
                                          (app::CommandPathFlags::kEndpointIdValid) };
 
-    SuccessOrExit(err = app::InteractionModelEngine::GetInstance()->NewCommandSender(&sender));
+    SuccessOrExit(err = mDevice->NewCommandSender(&sender));
 
     SuccessOrExit(err = sender->PrepareCommand(cmdParams));
 
@@ -12593,7 +12593,7 @@ exit:
     // On error, we are responsible to close the sender.
     if (err != CHIP_NO_ERROR && sender != nullptr)
     {
-        sender->Shutdown();
+        mDevice->ReleaseCommandSender(sender);
     }
     return err;
 }
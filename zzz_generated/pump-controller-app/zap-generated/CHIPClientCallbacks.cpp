@@ -113,8 +113,9 @@ namespace {
     Callback::Cancelable * onSuccessCallback = nullptr;                                                                            \
     Callback::Cancelable * onFailureCallback = nullptr;                                                                            \
     NodeId sourceIdentifier                  = reinterpret_cast<NodeId>(commandObj);                                               \
-    /* #6559: Currently, we only have one commands for the IMInvokeCommands and to a device, so the seqNum is always set to 0. */  \
-    CHIP_ERROR err = gCallbacks.GetResponseCallback(sourceIdentifier, 0, &onSuccessCallback, &onFailureCallback);                  \
+    /* The callbacks of each command of the request are filed under the index of the command, see AddIMResponseHandler. */         \
+    CHIP_ERROR err = gCallbacks.GetResponseCallback(sourceIdentifier, commandObj->GetCurrentCommandIndex(), &onSuccessCallback,    \
+                                                    &onFailureCallback);                                                           \
                                                                                                                                    \
     if (CHIP_NO_ERROR != err)                                                                                                      \
     {                                                                                                                              \